@@ -0,0 +1,134 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <oddsource/network/interfaces/AddressList.hpp>
+#include <oddsource/network/interfaces/IpAddress.hpp>
+#include "main.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace OddSource::Interfaces;
+
+/**
+ * Measures loading an allow or deny list of mixed IPv4 and IPv6 networks, once by constructing an
+ * IPv4Address or IPv6Address for every line (as callers did before AddressList) and once with an
+ * AddressList on one thread and on one thread per hardware thread.
+ */
+class BenchmarkAddressList : public Benchmarks::Benchmark
+{
+public:
+    BenchmarkAddressList() = default;
+
+    void
+    run() override
+    {
+        for ( ::std::size_t const entries : { 1'000u, 200'000u } )
+        {
+            ::std::string text;
+            for ( ::std::size_t i{ 0 }; i < entries; ++i )
+            {
+                if ( i % 4 == 3 )
+                {
+                    text += "2001:db8:" + to_hex( i & 0xffff ) + ":" + to_hex( i >> 16 ) + "::/64\n";
+                }
+                else
+                {
+                    text += "10." + ::std::to_string( i >> 16 & 0xff ) + "." + ::std::to_string( i >> 8 & 0xff ) +
+                            "." + ::std::to_string( i & 0xff ) + "/32\n";
+                }
+            }
+            ::std::string const suffix( "/entries:" + ::std::to_string( entries ) );
+
+            this->measure( "objects" + suffix, [ &text ]
+            {
+                ::std::vector< IPv4Address > ipv4;
+                ::std::vector< IPv6Address > ipv6;
+                ::std::string_view rest( text );
+                while ( !rest.empty() )
+                {
+                    auto const line( rest.substr( 0, rest.find( '\n' ) ) );
+                    rest.remove_prefix( ::std::min( rest.length(), line.length() + 1 ) );
+                    auto const address( line.substr( 0, line.find( '/' ) ) );
+                    if ( address.find( ':' ) != ::std::string_view::npos )
+                    {
+                        ipv6.emplace_back( address );
+                    }
+                    else
+                    {
+                        ipv4.emplace_back( address );
+                    }
+                }
+                Benchmarks::do_not_optimize( ipv4.size() + ipv6.size() );
+            } );
+
+            this->measure( "address_list" + suffix, [ &text ]
+            {
+                AddressList const list( text );
+                Benchmarks::do_not_optimize( list.ipv4_addresses().size() );
+            } );
+
+            AddressListOptions options;
+            options.threads = 0;
+            this->measure( "address_list_threads" + suffix, [ &text, &options ]
+            {
+                AddressList const list( text, options );
+                Benchmarks::do_not_optimize( list.ipv4_addresses().size() );
+            } );
+        }
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Benchmark >
+    create()
+    {
+        return std::make_unique< BenchmarkAddressList >();
+    }
+
+private:
+    static
+    ::std::string
+    to_hex(
+        ::std::size_t const value )
+    {
+        char hex[ 17 ];
+        ::std::snprintf( hex, sizeof( hex ), "%zx", value );
+        return hex;
+    }
+
+    static
+    void
+    measure(
+        ::std::string const & name,
+        ::std::function< void() > const & function )
+    {
+        ::std::uint32_t batchSize{ 0 };
+        auto samples( Benchmark::sample( function, batchSize ) );
+        Benchmark::report( name, ::std::move( samples ), batchSize );
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Benchmarks::Benchmark::Registrar< BenchmarkAddressList > registrar( "BenchmarkAddressList" );
+}
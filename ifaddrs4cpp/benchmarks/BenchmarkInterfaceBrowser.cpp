@@ -0,0 +1,127 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <oddsource/network/interfaces/Interfaces.hpp>
+#include "main.h"
+
+#include <iostream>
+
+using namespace OddSource::Interfaces;
+
+/**
+ * Compares building a full snapshot with looking up a single interface, and measures finding an
+ * interface in a snapshot that was already built. Run it on hosts (or in network namespaces) with
+ * different numbers of interfaces: the snapshot cost grows with the interface count, while the
+ * Netlink lookup cost stays flat.
+ */
+class BenchmarkInterfaceBrowser : public Benchmarks::Benchmark
+{
+public:
+    BenchmarkInterfaceBrowser()
+        : _browser(),
+          _target( this->_browser.get_interfaces().back() )
+    {
+        Benchmark::console() << "  (" << this->_browser.get_interfaces().size() << " interfaces, looking up "
+                              << this->_target->name() << ")" << ::std::endl;
+
+        add_benchmark( bench_get_interface_index );
+        add_benchmark( bench_get_interface_name );
+        add_benchmark( bench_snapshot_portable );
+        add_benchmark( bench_lookup_name_portable );
+#ifdef ODDSOURCE_IS_LINUX
+        add_benchmark( bench_snapshot_netlink );
+        add_benchmark( bench_lookup_name_netlink );
+        add_benchmark( bench_lookup_index_netlink );
+#endif /* ODDSOURCE_IS_LINUX */
+    }
+
+    void
+    bench_get_interface_index()
+    {
+        Benchmarks::do_not_optimize( this->_browser.get_interface( this->_target->index() ) );
+    }
+
+    void
+    bench_get_interface_name()
+    {
+        Benchmarks::do_not_optimize( this->_browser.get_interface( this->_target->name() ) );
+    }
+
+    void
+    bench_snapshot_portable()
+    {
+        InterfaceBrowser const browser( EnumerationBackend::Portable );
+        Benchmarks::do_not_optimize( browser.get_interfaces().size() );
+    }
+
+    void
+    bench_lookup_name_portable()
+    {
+        Benchmarks::do_not_optimize(
+            InterfaceBrowser::lookup( this->_target->name(), options( EnumerationBackend::Portable ) ) );
+    }
+
+#ifdef ODDSOURCE_IS_LINUX
+    void
+    bench_snapshot_netlink()
+    {
+        InterfaceBrowser const browser( EnumerationBackend::Netlink );
+        Benchmarks::do_not_optimize( browser.get_interfaces().size() );
+    }
+
+    void
+    bench_lookup_name_netlink()
+    {
+        Benchmarks::do_not_optimize(
+            InterfaceBrowser::lookup( this->_target->name(), options( EnumerationBackend::Netlink ) ) );
+    }
+
+    void
+    bench_lookup_index_netlink()
+    {
+        Benchmarks::do_not_optimize(
+            InterfaceBrowser::lookup( this->_target->index(), options( EnumerationBackend::Netlink ) ) );
+    }
+#endif /* ODDSOURCE_IS_LINUX */
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Benchmark >
+    create()
+    {
+        return std::make_unique< BenchmarkInterfaceBrowser >();
+    }
+
+private:
+    static
+    EnumerationOptions
+    options(
+        EnumerationBackend const backend )
+    {
+        EnumerationOptions options;
+        options.backend = backend;
+        return options;
+    }
+
+    InterfaceBrowser const _browser;
+    ::std::shared_ptr< Interface const > const _target;
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Benchmarks::Benchmark::Registrar< BenchmarkInterfaceBrowser > registrar( "BenchmarkInterfaceBrowser" );
+}
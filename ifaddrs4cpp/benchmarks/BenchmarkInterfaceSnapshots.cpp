@@ -0,0 +1,175 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <oddsource/network/interfaces/InterfaceSnapshots.hpp>
+#include "main.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OddSource::Interfaces;
+
+/**
+ * Measures how reading the published snapshot scales with the number of reader threads, while a
+ * writer publishes a new snapshot every millisecond. A Reader should keep the same per-read cost at
+ * every thread count; load(), which locks and copies a shared pointer, is shown for comparison.
+ */
+class BenchmarkInterfaceSnapshots : public Benchmarks::Benchmark
+{
+public:
+    BenchmarkInterfaceSnapshots()
+        : _snapshots(),
+          _reader( this->_snapshots )
+    {
+        add_benchmark( bench_reader_get );
+        add_benchmark( bench_load );
+    }
+
+    void
+    bench_reader_get()
+    {
+        Benchmarks::do_not_optimize( this->_reader.get().get_interfaces().size() );
+    }
+
+    void
+    bench_load()
+    {
+        Benchmarks::do_not_optimize( this->_snapshots.load()->get_interfaces().size() );
+    }
+
+    void
+    run() override
+    {
+        Benchmark::run();
+
+        unsigned const cores( ::std::max( ::std::thread::hardware_concurrency(), 1u ) );
+        for ( unsigned threads{ 1 }; ; threads = ::std::min( threads * 2, cores ) )
+        {
+            this->scale( "reader_get", threads, [ this ]
+            {
+                InterfaceSnapshots::Reader reader( this->_snapshots );
+                return [ reader ]() mutable
+                {
+                    Benchmarks::do_not_optimize( reader.get().get_interfaces().size() );
+                };
+            } );
+            this->scale( "load", threads, [ this ]
+            {
+                return [ this ]
+                {
+                    Benchmarks::do_not_optimize( this->_snapshots.load()->get_interfaces().size() );
+                };
+            } );
+            if ( threads == cores )
+            {
+                break;
+            }
+        }
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Benchmark >
+    create()
+    {
+        return std::make_unique< BenchmarkInterfaceSnapshots >();
+    }
+
+private:
+    /**
+     * Runs the given number of reader threads for a fixed time while publishing, and prints the
+     * aggregate read throughput and the time per read in each thread.
+     */
+    template< class MakeRead >
+    void
+    scale(
+        char const * name,
+        unsigned const threads,
+        MakeRead const & makeRead )
+    {
+        using clock = ::std::chrono::steady_clock;
+        static constexpr ::std::chrono::milliseconds const DURATION{ 250 };
+
+        ::std::atomic< bool > start{ false };
+        ::std::atomic< bool > stop{ false };
+        ::std::atomic< ::std::uint64_t > reads{ 0 };
+        ::std::vector< ::std::uint64_t > counts( threads, 0 );
+        ::std::vector< ::std::thread > readers;
+        for ( unsigned t{ 0 }; t < threads; ++t )
+        {
+            readers.emplace_back( [ &, t, read = makeRead() ]() mutable
+            {
+                while ( !start.load( ::std::memory_order_acquire ) )
+                {
+                    ::std::this_thread::yield();
+                }
+                ::std::uint64_t count{ 0 };
+                while ( !stop.load( ::std::memory_order_relaxed ) )
+                {
+                    for ( int i{ 0 }; i < 256; ++i )
+                    {
+                        read();
+                    }
+                    count += 256;
+                }
+                counts[ t ] = count;
+                reads.fetch_add( count, ::std::memory_order_relaxed );
+            } );
+        }
+
+        auto const pSnapshot( this->_snapshots.load() );
+        auto const began( clock::now() );
+        start.store( true, ::std::memory_order_release );
+        while ( clock::now() - began < DURATION )
+        {
+            ::std::this_thread::sleep_for( ::std::chrono::milliseconds( 1 ) );
+            this->_snapshots.publish( pSnapshot );
+        }
+        stop = true;
+        for ( auto & thread : readers )
+        {
+            thread.join();
+        }
+        auto const elapsed( ::std::chrono::duration< double, ::std::nano >( clock::now() - began ).count() );
+
+        double const total( static_cast< double >( reads.load() ) );
+        Benchmark::console() << "  ::" << ::std::left << ::std::setw( 24 ) << name
+                              << " threads " << ::std::setw( 8 ) << threads << ::std::right << ::std::fixed << ::std::setprecision( 1 )
+                              << " total " << ::std::setw( 10 ) << total / elapsed * 1'000.0 << " M reads/s" << ::std::endl;
+
+        // one sample per thread, so the percentiles show how evenly the threads progressed
+        ::std::vector< double > samples;
+        for ( auto const count : counts )
+        {
+            samples.push_back( elapsed / static_cast< double >( ::std::max< ::std::uint64_t >( count, 1 ) ) );
+        }
+        Benchmark::report( ::std::string( name ) + "/threads:" + ::std::to_string( threads ), samples, 256 );
+    }
+
+    InterfaceSnapshots _snapshots;
+    InterfaceSnapshots::Reader _reader;
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Benchmarks::Benchmark::Registrar< BenchmarkInterfaceSnapshots > registrar( "BenchmarkInterfaceSnapshots" );
+}
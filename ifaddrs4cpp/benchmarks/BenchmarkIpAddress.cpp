@@ -0,0 +1,302 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <oddsource/network/interfaces/IpAddress.hpp>
+#include <oddsource/network/interfaces/detail/ip_codec.hpp>
+#include "main.h"
+
+#include <cstring>
+#include <string>
+
+#ifdef ODDSOURCE_IS_WINDOWS
+#include <oddsource/network/interfaces/detail/winsock_includes.h>
+#else /* ODDSOURCE_IS_WINDOWS */
+#include <arpa/inet.h>
+#endif /* ODDSOURCE_IS_WINDOWS */
+
+using namespace OddSource::Interfaces;
+
+/**
+ * Measures the cost of creating, formatting, and copying IP addresses, which every enumeration pays
+ * once per address. Construction from binary data includes formatting the string representation. The codec_*
+ * and libc_* benchmarks compare the library's text codecs with the inet_pton and inet_ntop calls they replaced,
+ * including the null-terminated copy inet_pton needs.
+ */
+class BenchmarkIpAddress : public Benchmarks::Benchmark
+{
+public:
+    BenchmarkIpAddress()
+        : _ipv4( "192.168.42.117" ),
+          _ipv6( "2001:db8:85a3::8a2e:370:7334" ),
+          _ipv6Scoped( "fe80::1c2b:3aff:fe4d:5e6f%1" ),
+          _ipv6Bytes()
+    {
+        ::std::memcpy( this->_ipv6Bytes, static_cast< in6_addr const * >( this->_ipv6 ), sizeof( this->_ipv6Bytes ) );
+        add_benchmark( bench_ipv4_parse );
+        add_benchmark( bench_ipv4_parse_nothrow );
+        add_benchmark( bench_ipv4_parse_invalid_throwing );
+        add_benchmark( bench_ipv4_parse_invalid_nothrow );
+        add_benchmark( bench_ipv4_from_binary );
+        add_benchmark( bench_ipv4_to_string );
+        add_benchmark( bench_ipv4_copy );
+        add_benchmark( bench_ipv6_parse );
+        add_benchmark( bench_ipv6_parse_scoped );
+        add_benchmark( bench_ipv6_parse_scoped_nothrow );
+        add_benchmark( bench_ipv6_parse_invalid_throwing );
+        add_benchmark( bench_ipv6_parse_invalid_nothrow );
+        add_benchmark( bench_ipv6_from_binary );
+        add_benchmark( bench_ipv6_to_string );
+        add_benchmark( bench_ipv6_copy );
+        add_benchmark( bench_ipv4_codec_parse );
+        add_benchmark( bench_ipv4_libc_parse );
+        add_benchmark( bench_ipv4_codec_format );
+        add_benchmark( bench_ipv4_libc_format );
+        add_benchmark( bench_ipv6_codec_parse );
+        add_benchmark( bench_ipv6_libc_parse );
+        add_benchmark( bench_ipv6_codec_format );
+        add_benchmark( bench_ipv6_libc_format );
+        add_benchmark( bench_ipv6_hex_digits_scalar );
+#ifdef ODDSOURCE_HAS_SSSE3
+        add_benchmark( bench_ipv6_hex_digits_ssse3 );
+#endif /* ODDSOURCE_HAS_SSSE3 */
+    }
+
+    void
+    bench_ipv4_parse()
+    {
+        IPv4Address const address( "192.168.42.117" );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_ipv4_parse_nothrow()
+    {
+        Benchmarks::do_not_optimize( IPv4Address::parse( "192.168.42.117" ) );
+    }
+
+    void
+    bench_ipv4_parse_invalid_throwing()
+    {
+        try
+        {
+            IPv4Address const address( "192.168.42.317" );
+            Benchmarks::do_not_optimize( address );
+        }
+        catch ( InvalidIPAddress const & e )
+        {
+            Benchmarks::do_not_optimize( e );
+        }
+    }
+
+    void
+    bench_ipv4_parse_invalid_nothrow()
+    {
+        Benchmarks::do_not_optimize( IPv4Address::parse( "192.168.42.317" ) );
+    }
+
+    void
+    bench_ipv4_from_binary()
+    {
+        IPv4Address const address( static_cast< in_addr const * >( this->_ipv4 ) );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_ipv4_to_string()
+    {
+        Benchmarks::do_not_optimize( static_cast< ::std::string >( this->_ipv4 ) );
+    }
+
+    void
+    bench_ipv4_copy()
+    {
+        IPv4Address const address( this->_ipv4 );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_ipv6_parse()
+    {
+        IPv6Address const address( "2001:db8:85a3::8a2e:370:7334" );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_ipv6_parse_scoped()
+    {
+        IPv6Address const address( "fe80::1c2b:3aff:fe4d:5e6f%1" );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_ipv6_parse_scoped_nothrow()
+    {
+        Benchmarks::do_not_optimize( IPv6Address::parse( "fe80::1c2b:3aff:fe4d:5e6f%1" ) );
+    }
+
+    void
+    bench_ipv6_parse_invalid_throwing()
+    {
+        try
+        {
+            IPv6Address const address( "2001:db8:85a3::8a2e::7334" );
+            Benchmarks::do_not_optimize( address );
+        }
+        catch ( InvalidIPAddress const & e )
+        {
+            Benchmarks::do_not_optimize( e );
+        }
+    }
+
+    void
+    bench_ipv6_parse_invalid_nothrow()
+    {
+        Benchmarks::do_not_optimize( IPv6Address::parse( "2001:db8:85a3::8a2e::7334" ) );
+    }
+
+    void
+    bench_ipv6_from_binary()
+    {
+        IPv6Address const address( static_cast< in6_addr const * >( this->_ipv6 ) );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_ipv6_to_string()
+    {
+        Benchmarks::do_not_optimize( static_cast< ::std::string >( this->_ipv6 ) );
+    }
+
+    void
+    bench_ipv6_copy()
+    {
+        IPv6Address const address( this->_ipv6Scoped );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_ipv4_codec_parse()
+    {
+        in_addr data{};
+        Benchmarks::do_not_optimize( detail::parseIPv4( "192.168.42.117", data ) );
+        Benchmarks::do_not_optimize( data );
+    }
+
+    void
+    bench_ipv4_libc_parse()
+    {
+        ::std::string_view const repr( "192.168.42.117" );
+        char chars[ 64 ];
+        ::std::memcpy( chars, repr.data(), repr.length() );
+        chars[ repr.length() ] = '\0';
+        in_addr data{};
+        Benchmarks::do_not_optimize( inet_pton( AF_INET, chars, &data ) );
+        Benchmarks::do_not_optimize( data );
+    }
+
+    void
+    bench_ipv4_codec_format()
+    {
+        char chars[ INET_ADDRSTRLEN ];
+        Benchmarks::do_not_optimize( detail::formatIPv4( *static_cast< in_addr const * >( this->_ipv4 ), chars ) );
+        Benchmarks::do_not_optimize( chars );
+    }
+
+    void
+    bench_ipv4_libc_format()
+    {
+        char chars[ INET_ADDRSTRLEN ];
+        Benchmarks::do_not_optimize( inet_ntop( AF_INET, static_cast< in_addr const * >( this->_ipv4 ), chars,
+                                                sizeof( chars ) ) );
+        Benchmarks::do_not_optimize( chars );
+    }
+
+    void
+    bench_ipv6_codec_parse()
+    {
+        in6_addr data{};
+        Benchmarks::do_not_optimize( detail::parseIPv6( "2001:db8:85a3::8a2e:370:7334", data ) );
+        Benchmarks::do_not_optimize( data );
+    }
+
+    void
+    bench_ipv6_libc_parse()
+    {
+        ::std::string_view const repr( "2001:db8:85a3::8a2e:370:7334" );
+        char chars[ 64 ];
+        ::std::memcpy( chars, repr.data(), repr.length() );
+        chars[ repr.length() ] = '\0';
+        in6_addr data{};
+        Benchmarks::do_not_optimize( inet_pton( AF_INET6, chars, &data ) );
+        Benchmarks::do_not_optimize( data );
+    }
+
+    void
+    bench_ipv6_codec_format()
+    {
+        char chars[ INET6_ADDRSTRLEN ];
+        Benchmarks::do_not_optimize( detail::formatIPv6( *static_cast< in6_addr const * >( this->_ipv6 ), chars ) );
+        Benchmarks::do_not_optimize( chars );
+    }
+
+    void
+    bench_ipv6_libc_format()
+    {
+        char chars[ INET6_ADDRSTRLEN ];
+        Benchmarks::do_not_optimize( inet_ntop( AF_INET6, static_cast< in6_addr const * >( this->_ipv6 ), chars,
+                                                sizeof( chars ) ) );
+        Benchmarks::do_not_optimize( chars );
+    }
+
+    void
+    bench_ipv6_hex_digits_scalar()
+    {
+        char hex[ 32 ];
+        detail::hexDigits( this->_ipv6Bytes, hex );
+        Benchmarks::do_not_optimize( hex );
+    }
+
+#ifdef ODDSOURCE_HAS_SSSE3
+    void
+    bench_ipv6_hex_digits_ssse3()
+    {
+        char hex[ 32 ];
+        detail::hexDigitsSsse3( this->_ipv6Bytes, hex );
+        Benchmarks::do_not_optimize( hex );
+    }
+#endif /* ODDSOURCE_HAS_SSSE3 */
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Benchmark >
+    create()
+    {
+        return std::make_unique< BenchmarkIpAddress >();
+    }
+
+private:
+    IPv4Address const _ipv4;
+    IPv6Address const _ipv6;
+    IPv6Address const _ipv6Scoped;
+    ::std::uint8_t _ipv6Bytes[ 16 ];
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Benchmarks::Benchmark::Registrar< BenchmarkIpAddress > registrar( "BenchmarkIpAddress" );
+}
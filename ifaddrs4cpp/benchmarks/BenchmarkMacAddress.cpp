@@ -0,0 +1,161 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <oddsource/network/interfaces/MacAddress.hpp>
+#include "main.h"
+
+#include <string>
+#include <string_view>
+
+using namespace OddSource::Interfaces;
+
+/**
+ * Measures the cost of creating, formatting, and copying MAC addresses. Construction from binary
+ * data does not format the string representation; bench_format measures both together.
+ */
+class BenchmarkMacAddress : public Benchmarks::Benchmark
+{
+public:
+    BenchmarkMacAddress()
+        : _mac( "a4:83:e7:2e:a1:67" )
+    {
+        add_benchmark( bench_parse );
+        add_benchmark( bench_parse_eui64 );
+        add_benchmark( bench_parse_nothrow );
+        add_benchmark( bench_parse_cisco );
+        add_benchmark( bench_parse_bare );
+        add_benchmark( bench_parse_all );
+        add_benchmark( bench_parse_invalid_throwing );
+        add_benchmark( bench_parse_invalid_nothrow );
+        add_benchmark( bench_from_binary );
+        add_benchmark( bench_format );
+        add_benchmark( bench_to_string );
+        add_benchmark( bench_copy );
+    }
+
+    void
+    bench_parse()
+    {
+        MacAddress const address( "a4:83:e7:2e:a1:67" );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_parse_eui64()
+    {
+        MacAddress const address( "a4:83:e7:ff:fe:2e:a1:67" );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_parse_nothrow()
+    {
+        Benchmarks::do_not_optimize( MacAddress::parse( "a4:83:e7:2e:a1:67" ) );
+    }
+
+    void
+    bench_parse_cisco()
+    {
+        Benchmarks::do_not_optimize( MacAddress::parse( "a483.e72e.a167" ) );
+    }
+
+    void
+    bench_parse_bare()
+    {
+        Benchmarks::do_not_optimize( MacAddress::parse( "a483e72ea167" ) );
+    }
+
+    // per batch of BATCH_SIZE strings, in a mix of formats, without constructing a MacAddress for each
+    void
+    bench_parse_all()
+    {
+        Benchmarks::do_not_optimize( MacAddress::parse_all(
+            BATCH, BATCH_SIZE, this->_batchData, this->_batchLengths, this->_batchErrors ) );
+    }
+
+    void
+    bench_parse_invalid_throwing()
+    {
+        try
+        {
+            MacAddress const address( "a4:83:e7:2g:a1:67" );
+            Benchmarks::do_not_optimize( address );
+        }
+        catch ( InvalidMacAddress const & e )
+        {
+            Benchmarks::do_not_optimize( e );
+        }
+    }
+
+    void
+    bench_parse_invalid_nothrow()
+    {
+        Benchmarks::do_not_optimize( MacAddress::parse( "a4:83:e7:2g:a1:67" ) );
+    }
+
+    void
+    bench_from_binary()
+    {
+        MacAddress const address( static_cast< ::std::uint8_t const * >( this->_mac ), this->_mac.length() );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    void
+    bench_format()
+    {
+        MacAddress const address( static_cast< ::std::uint8_t const * >( this->_mac ), this->_mac.length() );
+        Benchmarks::do_not_optimize( static_cast< char const * >( address ) );
+    }
+
+    void
+    bench_to_string()
+    {
+        Benchmarks::do_not_optimize( static_cast< ::std::string >( this->_mac ) );
+    }
+
+    void
+    bench_copy()
+    {
+        MacAddress const address( this->_mac );
+        Benchmarks::do_not_optimize( address );
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Benchmark >
+    create()
+    {
+        return std::make_unique< BenchmarkMacAddress >();
+    }
+
+private:
+    static constexpr ::std::size_t BATCH_SIZE{ 4 };
+    static constexpr ::std::string_view const BATCH[ BATCH_SIZE ] {
+        "a4:83:e7:2e:a1:67", "a483.e72e.a167", "a483e72ea167", "a4-83-e7-ff-fe-2e-a1-67",
+    };
+
+    MacAddress const _mac;
+    ::std::uint8_t _batchData[ BATCH_SIZE * MAX_ADAPTER_ADDRESS_LENGTH ] {};
+    ::std::uint8_t _batchLengths[ BATCH_SIZE ] {};
+    ParseError _batchErrors[ BATCH_SIZE ] {};
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Benchmarks::Benchmark::Registrar< BenchmarkMacAddress > registrar( "BenchmarkMacAddress" );
+}
@@ -0,0 +1,249 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <oddsource/network/interfaces/InterfaceProvider.hpp>
+#include <oddsource/network/interfaces/Interfaces.hpp>
+#include <oddsource/network/interfaces/InterfaceTable.hpp>
+#include "main.h"
+
+#if defined( __GLIBC__ ) && ( __GLIBC__ > 2 || ( __GLIBC__ == 2 && __GLIBC_MINOR__ >= 33 ) )
+#include <malloc.h>
+#define BENCHMARK_HAS_MALLINFO2
+#endif
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace OddSource::Interfaces;
+
+/**
+ * Measures how building a browser, looking up interfaces in it, and the memory it holds scale with
+ * the number of interfaces, using SyntheticInterfaceProvider so that no root privileges, network
+ * namespaces, or thousands of real links are needed. Each interface has two IPv4 and two IPv6
+ * addresses, like a container veth with a dual-stack address and a link-local address. The scan
+ * cases answer the same two questions (up interfaces with jumbo frames, and global unicast IPv6
+ * addresses) once by walking the browser's objects and once over an InterfaceTable's columns.
+ */
+class BenchmarkSyntheticScaling : public Benchmarks::Benchmark
+{
+public:
+    BenchmarkSyntheticScaling() = default;
+
+    void
+    run() override
+    {
+        for ( ::std::size_t const interfaces : { 10u, 100u, 1'000u, 10'000u, 20'000u } )
+        {
+            EnumerationOptions options;
+            options.provider = ::std::make_shared< SyntheticInterfaceProvider >( interfaces, 2, 2 );
+            ::std::string const suffix( "/interfaces:" + ::std::to_string( interfaces ) );
+
+            this->measure( "construct" + suffix, [ &options ]
+            {
+                InterfaceBrowser const browser( options );
+                Benchmarks::do_not_optimize( browser.get_interfaces().size() );
+            } );
+
+            // the same, with each interface allocated from the heap instead of the snapshot's arena
+            EnumerationOptions heapOptions( options );
+            heapOptions.arena = false;
+            this->measure( "construct_heap" + suffix, [ &heapOptions ]
+            {
+                InterfaceBrowser const browser( heapOptions );
+                Benchmarks::do_not_optimize( browser.get_interfaces().size() );
+            } );
+
+            InterfaceBrowser const browser( options );
+            this->measure( "refresh_unchanged" + suffix, [ &browser ]
+            {
+                ::std::vector< InterfaceEvent > changes;
+                InterfaceBrowser const next( browser, changes );
+                Benchmarks::do_not_optimize( changes.size() );
+            } );
+
+            // cycle through every interface, so the lookups do not all hit the same cache lines
+            ::std::vector< ::std::string > names;
+            for ( ::std::size_t i{ 0 }; i < interfaces; ++i )
+            {
+                names.push_back( "syn" + ::std::to_string( i ) );
+            }
+            ::std::size_t next{ 0 };
+            this->measure( "get_interface_index" + suffix, [ &browser, &next, interfaces ]
+            {
+                Benchmarks::do_not_optimize( browser.get_interface( static_cast< ::std::uint32_t >( next + 1 ) ) );
+                next = next + 1 == interfaces ? 0 : next + 1;
+            } );
+            this->measure( "get_interface_name" + suffix, [ &browser, &names, &next ]
+            {
+                Benchmarks::do_not_optimize( browser.get_interface( names[ next ] ) );
+                next = next + 1 == names.size() ? 0 : next + 1;
+            } );
+            ::std::string const missing( "no-such-interface-with-a-name-too-long-to-store-inline" );
+            this->measure( "get_interface_name_missing" + suffix, [ &browser, &missing ]
+            {
+                Benchmarks::do_not_optimize( browser.get_interface( missing ) );
+            } );
+
+            // lookups run on request paths, so none of them may allocate
+            auto const allocations( Benchmarks::allocation_count() );
+            for ( ::std::size_t i{ 0 }; i < interfaces; ++i )
+            {
+                Benchmarks::do_not_optimize( browser.get_interface( static_cast< ::std::uint32_t >( i + 1 ) ) );
+                Benchmarks::do_not_optimize( browser.get_interface( names[ i ] ) );
+                Benchmarks::do_not_optimize( browser.get_interface( missing ) );
+            }
+            Benchmark::report(
+                "allocations_per_lookup" + suffix,
+                { static_cast< double >( Benchmarks::allocation_count() - allocations ) / ( 3.0 * interfaces ) },
+                1,
+                "allocations" );
+
+            this->measure( "table_construct" + suffix, [ &browser ]
+            {
+                InterfaceTable const table( browser );
+                Benchmarks::do_not_optimize( table.size() );
+            } );
+
+            InterfaceTable const table( browser );
+            this->measure( "scan_jumbo_browser" + suffix, [ &browser ]
+            {
+                ::std::size_t count{ 0 };
+                for ( auto const & pInterface : browser.get_interfaces() )
+                {
+                    count += pInterface->is_up() && pInterface->mtu().value_or( 0 ) >= 9000;
+                }
+                Benchmarks::do_not_optimize( count );
+            } );
+            this->measure( "scan_jumbo_function" + suffix, [ &browser ]
+            {
+                ::std::size_t count{ 0 };
+                ::std::function< bool( Interface const & ) > const visitor( [ &count ]( Interface const & rInterface )
+                {
+                    count += rInterface.is_up() && rInterface.mtu().value_or( 0 ) >= 9000;
+                    return true;
+                } );
+                static_cast< void >( browser.for_each_interface( visitor ) );
+                Benchmarks::do_not_optimize( count );
+            } );
+            this->measure( "scan_jumbo_visitor" + suffix, [ &browser ]
+            {
+                ::std::size_t count{ 0 };
+                static_cast< void >( browser.for_each_interface( [ &count ]( Interface const & rInterface )
+                {
+                    count += rInterface.is_up() && rInterface.mtu().value_or( 0 ) >= 9000;
+                    return true;
+                } ) );
+                Benchmarks::do_not_optimize( count );
+            } );
+            this->measure( "scan_jumbo_range" + suffix, [ &browser ]
+            {
+                ::std::size_t count{ 0 };
+                for ( Interface const & rInterface : browser )
+                {
+                    count += rInterface.is_up() && rInterface.mtu().value_or( 0 ) >= 9000;
+                }
+                Benchmarks::do_not_optimize( count );
+            } );
+            this->measure( "scan_jumbo_table" + suffix, [ &table ]
+            {
+                ::std::size_t count{ 0 };
+                auto const flags( table.flags().data() );
+                auto const mtus( table.mtus().data() );
+                auto const rows( table.size() );
+                for ( ::std::size_t row{ 0 }; row < rows; ++row )
+                {
+                    count += ( flags[ row ] & IFF_UP ) != 0 && mtus[ row ] >= 9000;
+                }
+                Benchmarks::do_not_optimize( count );
+            } );
+            this->measure( "scan_global_ipv6_browser" + suffix, [ &browser ]
+            {
+                ::std::size_t count{ 0 };
+                for ( auto const & pInterface : browser.get_interfaces() )
+                {
+                    for ( auto const & address : pInterface->ipv6_addresses() )
+                    {
+                        count += ( static_cast< IPv6Address::Bytes >( address.address() )[ 0 ] & 0xe0 ) == 0x20;
+                    }
+                }
+                Benchmarks::do_not_optimize( count );
+            } );
+            this->measure( "scan_global_ipv6_visitor" + suffix, [ &browser ]
+            {
+                ::std::size_t count{ 0 };
+                static_cast< void >( browser.for_each_ipv6_address(
+                    [ &count ]( Interface const &, InterfaceIPv6Address const & address )
+                    {
+                        count += ( static_cast< IPv6Address::Bytes >( address.address() )[ 0 ] & 0xe0 ) == 0x20;
+                        return true;
+                    } ) );
+                Benchmarks::do_not_optimize( count );
+            } );
+            this->measure( "scan_global_ipv6_table" + suffix, [ &table ]
+            {
+                ::std::size_t count{ 0 };
+                for ( auto const & address : table.ipv6_addresses() )
+                {
+                    count += ( address[ 0 ] & 0xe0 ) == 0x20;
+                }
+                Benchmarks::do_not_optimize( count );
+            } );
+
+#ifdef BENCHMARK_HAS_MALLINFO2
+            ::std::vector< double > bytes;
+            for ( int s{ 0 }; s < 5; ++s )
+            {
+                auto const before( ::mallinfo2().uordblks );
+                auto pBrowser( ::std::make_unique< InterfaceBrowser const >( options ) );
+                auto const after( ::mallinfo2().uordblks );
+                Benchmarks::do_not_optimize( pBrowser->get_interfaces().size() );
+                bytes.push_back( static_cast< double >( after - before ) / static_cast< double >( interfaces ) );
+            }
+            Benchmark::report( "heap_per_interface" + suffix, bytes, 1, "bytes" );
+#endif /* BENCHMARK_HAS_MALLINFO2 */
+        }
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Benchmark >
+    create()
+    {
+        return std::make_unique< BenchmarkSyntheticScaling >();
+    }
+
+private:
+    static
+    void
+    measure(
+        ::std::string const & name,
+        ::std::function< void() > const & function )
+    {
+        ::std::uint32_t batchSize{ 0 };
+        auto samples( Benchmark::sample( function, batchSize ) );
+        Benchmark::report( name, ::std::move( samples ), batchSize );
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Benchmarks::Benchmark::Registrar< BenchmarkSyntheticScaling > registrar( "BenchmarkSyntheticScaling" );
+}
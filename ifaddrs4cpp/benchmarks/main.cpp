@@ -0,0 +1,402 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "main.h"
+
+#include <oddsource/network/interfaces/VersionInfo.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <thread>
+
+namespace
+{
+    constexpr ::std::uint32_t const MAX_BATCH_SIZE{ 1u << 24 };
+
+    /**
+     * Returns the nearest-rank percentile of the sorted samples.
+     */
+    double
+    percentile(
+        ::std::vector< double > const & sorted,
+        double const percent )
+    {
+        auto const rank( static_cast< size_t >( ::std::ceil( percent / 100.0 * sorted.size() ) ) );
+        return sorted[ ::std::clamp< size_t >( rank, 1, sorted.size() ) - 1 ];
+    }
+
+    char const *
+    os_name()
+    {
+#if defined( ODDSOURCE_IS_WINDOWS )
+        return "windows";
+#elif defined( ODDSOURCE_IS_MACOS )
+        return "macos";
+#elif defined( ODDSOURCE_IS_BSD )
+        return "bsd";
+#elif defined( ODDSOURCE_IS_LINUX )
+        return "linux";
+#else
+        return "unknown";
+#endif
+    }
+
+    ::std::string
+    quoted(
+        ::std::string const & value )
+    {
+        ::std::string out( "\"" );
+        for ( char const c : value )
+        {
+            if ( c == '"' || c == '\\' )
+            {
+                out += '\\';
+            }
+            out += c;
+        }
+        return out + "\"";
+    }
+}
+
+namespace
+{
+    thread_local ::std::uint64_t allocations( 0 );
+}
+
+// replaces the global allocation functions so that benchmarks can count allocations
+void *
+operator new(
+    ::std::size_t size )
+{
+    ++allocations;
+    if ( void * ptr = ::std::malloc( size == 0 ? 1 : size ) )
+    {
+        return ptr;
+    }
+    throw ::std::bad_alloc();
+}
+
+void *
+operator new(
+    ::std::size_t size,
+    ::std::nothrow_t const & ) noexcept
+{
+    ++allocations;
+    return ::std::malloc( size == 0 ? 1 : size );
+}
+
+void
+operator delete(
+    void * ptr ) noexcept
+{
+    ::std::free( ptr );
+}
+
+void
+operator delete(
+    void * ptr,
+    ::std::nothrow_t const & ) noexcept
+{
+    ::std::free( ptr );
+}
+
+void
+operator delete(
+    void * ptr,
+    ::std::size_t ) noexcept
+{
+    ::std::free( ptr );
+}
+
+::std::uint64_t
+OddSource::Interfaces::Benchmarks::
+allocation_count()
+{
+    return allocations;
+}
+
+// each timed batch runs at least this long, so clock overhead stays negligible
+::std::chrono::microseconds OddSource::Interfaces::Benchmarks::Benchmark::min_batch_time{ 200 };
+size_t OddSource::Interfaces::Benchmarks::Benchmark::sample_count{ 50 };
+::std::string OddSource::Interfaces::Benchmarks::Benchmark::current_case;
+bool OddSource::Interfaces::Benchmarks::Benchmark::json_to_stdout{ false };
+
+::std::ostream &
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+console()
+{
+    return Benchmark::json_to_stdout ? ::std::cerr : ::std::cout;
+}
+
+void
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+registrate(
+    ::std::string const & name,
+    create_function * function )
+{
+    Benchmark::registry()[ name ] = function;
+}
+
+::std::map< ::std::string const, OddSource::Interfaces::Benchmarks::Benchmark::create_function * > &
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+registry()
+{
+    static ::std::map< ::std::string const, Benchmark::create_function * > impl;
+    return impl;
+}
+
+::std::vector< OddSource::Interfaces::Benchmarks::Benchmark::Result > &
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+results()
+{
+    static ::std::vector< Result > impl;
+    return impl;
+}
+
+::std::vector< double >
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+sample(
+    ::std::function< void() > const & function,
+    ::std::uint32_t & batchSize )
+{
+    using clock = ::std::chrono::steady_clock;
+
+    // warm up and calibrate: double the batch size until one batch takes long enough
+    batchSize = 1;
+    while ( true )
+    {
+        auto const start( clock::now() );
+        for ( ::std::uint32_t i{ 0 }; i < batchSize; ++i )
+        {
+            function();
+        }
+        if ( clock::now() - start >= Benchmark::min_batch_time || batchSize >= MAX_BATCH_SIZE )
+        {
+            break;
+        }
+        batchSize *= 2;
+    }
+
+    ::std::vector< double > samples;
+    samples.reserve( Benchmark::sample_count );
+    for ( size_t s{ 0 }; s < Benchmark::sample_count; ++s )
+    {
+        auto const start( clock::now() );
+        for ( ::std::uint32_t i{ 0 }; i < batchSize; ++i )
+        {
+            function();
+        }
+        auto const elapsed( ::std::chrono::duration_cast< ::std::chrono::nanoseconds >( clock::now() - start ) );
+        samples.push_back( static_cast< double >( elapsed.count() ) / batchSize );
+    }
+    return samples;
+}
+
+void
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+report(
+    ::std::string const & name,
+    ::std::vector< double > samples,
+    ::std::uint32_t const batchSize,
+    ::std::string const & unit )
+{
+    if ( samples.empty() )
+    {
+        return;
+    }
+
+    ::std::sort( samples.begin(), samples.end() );
+    double const mean( ::std::accumulate( samples.begin(), samples.end(), 0.0 ) / samples.size() );
+    double squares{ 0.0 };
+    for ( double const sample : samples )
+    {
+        squares += ( sample - mean ) * ( sample - mean );
+    }
+
+    Result const result {
+        Benchmark::current_case,
+        name,
+        unit,
+        samples.size(),
+        batchSize,
+        mean,
+        samples.size() > 1 ? ::std::sqrt( squares / ( samples.size() - 1 ) ) : 0.0,
+        samples.front(),
+        percentile( samples, 50 ),
+        percentile( samples, 90 ),
+        percentile( samples, 99 ),
+        samples.back(),
+    };
+    ::std::string const suffix( " " + unit );
+    Benchmark::console() << "  ::" << ::std::left << ::std::setw( 40 ) << name << ::std::right << ::std::fixed
+                          << ::std::setprecision( 1 )
+                          << " mean " << ::std::setw( 11 ) << result.mean << suffix
+                          << "   p50 " << ::std::setw( 11 ) << result.p50 << suffix
+                          << "   p90 " << ::std::setw( 11 ) << result.p90 << suffix
+                          << "   p99 " << ::std::setw( 11 ) << result.p99 << suffix
+                          << "   min " << ::std::setw( 11 ) << result.min << suffix
+                          << "   max " << ::std::setw( 11 ) << result.max << suffix << ::std::endl;
+    Benchmark::results().push_back( result );
+}
+
+void
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+run()
+{
+    for ( auto const & name : this->_benchmarkNames )
+    {
+        ::std::uint32_t batchSize{ 0 };
+        auto samples( Benchmark::sample( this->_benchmarks.at( name ), batchSize ) );
+        Benchmark::report( name, ::std::move( samples ), batchSize );
+    }
+}
+
+void
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+write_json(
+    ::std::ostream & out )
+{
+    out << "{\n"
+        << "  \"library_version\": " << quoted( OddSource::Interfaces::VersionInfo::version() ) << ",\n"
+        << "  \"git_hash\": " << quoted( OddSource::Interfaces::VersionInfo::git_hash_short() ) << ",\n"
+        << "  \"os\": " << quoted( os_name() ) << ",\n"
+        << "  \"hardware_threads\": " << ::std::thread::hardware_concurrency() << ",\n"
+        << "  \"sample_count\": " << Benchmark::sample_count << ",\n"
+        << "  \"min_batch_time_us\": " << Benchmark::min_batch_time.count() << ",\n"
+        << "  \"benchmarks\": [";
+    char const * separator( "\n" );
+    out << ::std::fixed << ::std::setprecision( 3 );
+    for ( auto const & result : Benchmark::results() )
+    {
+        out << separator
+            << "    {\"case\": " << quoted( result.benchmark_case )
+            << ", \"name\": " << quoted( result.name )
+            << ", \"unit\": " << quoted( result.unit )
+            << ", \"samples\": " << result.samples
+            << ", \"batch_size\": " << result.batch_size
+            << ", \"mean\": " << result.mean
+            << ", \"stddev\": " << result.stddev
+            << ", \"min\": " << result.min
+            << ", \"p50\": " << result.p50
+            << ", \"p90\": " << result.p90
+            << ", \"p99\": " << result.p99
+            << ", \"max\": " << result.max << "}";
+        separator = ",\n";
+    }
+    out << "\n  ]\n}" << ::std::endl;
+}
+
+int
+OddSource::Interfaces::Benchmarks::
+Benchmark::
+run_all_registered_benchmark_cases(
+    ::std::vector< ::std::string > const & matching,
+    ::std::string const & jsonPath )
+{
+    int ret{ 0 };
+    Benchmark::json_to_stdout = jsonPath == "-";
+    auto end( matching.end() );
+    for ( auto const & [name, create_function] : Benchmark::registry() )
+    {
+        if ( !matching.empty() && ::std::find( matching.begin(), end, name ) == end )
+        {
+            continue;
+        }
+        Benchmark::console() << "Running benchmark case " << name << "..." << ::std::endl;
+        Benchmark::current_case = name;
+        try
+        {
+            create_function()->run();
+        }
+        catch ( ::std::exception const & e )
+        {
+            ::std::cerr << "  Case failed with exception: " << e.what() << ::std::endl;
+            ret = 1;
+        }
+    }
+
+    if ( jsonPath == "-" )
+    {
+        Benchmark::write_json( ::std::cout );
+    }
+    else if ( !jsonPath.empty() )
+    {
+        ::std::ofstream file( jsonPath );
+        Benchmark::write_json( file );
+        if ( !file )
+        {
+            ::std::cerr << "Could not write " << jsonPath << ::std::endl;
+            ret = 1;
+        }
+    }
+    return ret;
+}
+
+int
+main(
+    int argc,
+    char * argv [] )
+{
+    using OddSource::Interfaces::Benchmarks::Benchmark;
+
+    ::std::vector< ::std::string > matching;
+    ::std::string jsonPath;
+    matching.reserve( argc - 1 );
+    for ( int i{ 1 }; i < argc; ++i )
+    {
+        ::std::string const argument( argv[ i ] );
+        bool const hasValue( i + 1 < argc );
+        if ( argument == "--json" && hasValue )
+        {
+            jsonPath = argv[ ++i ];
+        }
+        else if ( argument == "--samples" && hasValue )
+        {
+            Benchmark::sample_count = ::std::max( ::std::stoul( argv[ ++i ] ), 1ul );
+        }
+        else if ( argument == "--min-batch-time-us" && hasValue )
+        {
+            Benchmark::min_batch_time = ::std::chrono::microseconds( ::std::stoul( argv[ ++i ] ) );
+        }
+        else if ( argument == "--help" || argument.rfind( "--", 0 ) == 0 )
+        {
+            ::std::cout << "Usage: " << argv[ 0 ]
+                        << " [--json <file or ->] [--samples <count>] [--min-batch-time-us <microseconds>]"
+                           " [BenchmarkCase ...]" << ::std::endl;
+            return argument == "--help" ? 0 : 2;
+        }
+        else if ( !argument.empty() )
+        {
+            matching.push_back( argument );
+        }
+    }
+    return Benchmark::run_all_registered_benchmark_cases( matching, jsonPath );
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <ostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <oddsource/network/interfaces/detail/os.h>
+
+#define BENCHMARK_QUOTED_STRINGIFY_ARGUMENT(x) #x
+#define BENCHMARK_ARGUMENT_TO_QUOTED_STRING(x) BENCHMARK_QUOTED_STRINGIFY_ARGUMENT(x)
+
+namespace OddSource::Interfaces::Benchmarks
+{
+    /**
+     * Keeps the compiler from discarding a value computed by a benchmarked operation.
+     */
+    template< typename T >
+    void
+    do_not_optimize(
+        T const & value );
+
+    /**
+     * Returns how many times the calling thread has called the global operator new, so that a
+     * benchmark can report how many allocations an operation makes.
+     */
+    ::std::uint64_t
+    allocation_count();
+
+    /**
+     * A case of related benchmarks. Each benchmark is a function that performs the measured
+     * operation exactly once; the runner calls it in calibrated batches and reports the time
+     * per call.
+     */
+    class Benchmark
+    {
+    public:
+        Benchmark() = default;
+
+        virtual
+        ~Benchmark() = default;
+
+        virtual
+        void
+        run();
+
+#define add_benchmark(name) \
+        this->_benchmarks.emplace( BENCHMARK_ARGUMENT_TO_QUOTED_STRING( name ), [ this ] { name(); } ); \
+        this->_benchmarkNames.emplace_back( BENCHMARK_ARGUMENT_TO_QUOTED_STRING( name ) )
+
+        using create_function = ::std::unique_ptr< Benchmark >();
+
+        static
+        void
+        registrate(
+            ::std::string const &,
+            create_function * );
+
+        /**
+         * Runs the registered benchmark cases whose names are in matching (or all of them, if it is
+         * empty), and writes the report as JSON to jsonPath unless it is empty ("-" means stdout, in
+         * which case everything else is printed to stderr).
+         */
+        [[nodiscard]]
+        static
+        int
+        run_all_registered_benchmark_cases(
+            ::std::vector< ::std::string > const & matching,
+            ::std::string const & jsonPath );
+
+        /**
+         * The number of timed batches per benchmark, and the minimum duration of each batch.
+         */
+        static
+        size_t
+        sample_count;
+
+        static
+        ::std::chrono::microseconds
+        min_batch_time;
+
+        /**
+         * Where the human-readable results are printed: stdout, or stderr when the JSON report goes to stdout so
+         * that stdout holds only the JSON.
+         */
+        [[nodiscard]]
+        static
+        ::std::ostream &
+        console();
+
+        template< typename T >
+        class Registrar
+        {
+            static_assert( ::std::is_base_of_v< Benchmark, T >,
+                           "the template parameter T must derive from Benchmark." );
+
+        public:
+            explicit
+            Registrar(
+                ::std::string const & );
+
+            Registrar(
+                Registrar const & ) = delete;
+
+            Registrar(
+                Registrar && ) = delete;
+
+            ~Registrar() = default;
+        };
+
+    protected:
+        /**
+         * Prints the statistics of the given samples (nanoseconds per call unless another unit is
+         * given) and adds them to the report under the running case.
+         */
+        static
+        void
+        report(
+            ::std::string const & name,
+            ::std::vector< double > samples,
+            ::std::uint32_t batchSize,
+            ::std::string const & unit = "ns" );
+
+        /**
+         * Times batches of calls to the given function.
+         *
+         * @param batchSize set to the number of calls per batch.
+         * @return the nanoseconds per call of each batch.
+         */
+        static
+        ::std::vector< double >
+        sample(
+            ::std::function< void() > const & function,
+            ::std::uint32_t & batchSize );
+
+        ::std::unordered_map< ::std::string, ::std::function< void() > const > _benchmarks;
+        ::std::list< ::std::string > _benchmarkNames;
+
+    private:
+        struct Result
+        {
+            ::std::string benchmark_case;
+            ::std::string name;
+            ::std::string unit;
+            size_t samples;
+            ::std::uint32_t batch_size;
+            double mean;
+            double stddev;
+            double min;
+            double p50;
+            double p90;
+            double p99;
+            double max;
+        };
+
+        [[nodiscard]]
+        static
+        ::std::vector< Result > &
+        results();
+
+        static
+        void
+        write_json(
+            ::std::ostream & out );
+
+        [[nodiscard]]
+        static
+        ::std::map< ::std::string const, create_function * > &
+        registry();
+
+        static
+        ::std::string
+        current_case;
+
+        static
+        bool
+        json_to_stdout;
+    };
+}
+
+#include "main.hpp"
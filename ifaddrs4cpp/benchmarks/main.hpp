@@ -0,0 +1,39 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+template< typename T >
+void
+OddSource::Interfaces::Benchmarks::
+do_not_optimize(
+    T const & value )
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+#else
+    static_cast< void >( *static_cast< char const volatile * >( static_cast< void const * >( &value ) ) );
+#endif
+}
+
+template< typename T >
+OddSource::Interfaces::Benchmarks::
+Benchmark::Registrar< T >::
+Registrar(
+    ::std::string const & name )
+{
+    Benchmark::registrate( name, &T::create );
+}
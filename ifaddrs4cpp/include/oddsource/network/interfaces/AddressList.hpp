@@ -0,0 +1,199 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_ADDRESS_LIST_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_ADDRESS_LIST_HPP
+
+#include "detail/config.h"
+#include "IpAddress.hpp"
+#include "ParseResult.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace OddSource::Interfaces
+{
+    /**
+     * Controls how an AddressList parses its text.
+     */
+    struct OddSource_Export AddressListOptions
+    {
+        /**
+         * The most threads to parse with, including the calling thread, or 0 for one per hardware thread.
+         */
+        ::std::size_t threads = 1;
+
+        /**
+         * Give each thread at least this many bytes of text, so that small lists are parsed on the calling thread
+         * alone instead of paying to start threads.
+         */
+        ::std::size_t min_bytes_per_thread = 256 * 1024;
+    };
+
+    /**
+     * An entry of an AddressList's text that could not be parsed.
+     */
+    struct OddSource_Export AddressListError
+    {
+        /**
+         * The line the entry is on, starting at 1.
+         */
+        ::std::size_t line;
+
+        /**
+         * Where the entry (without surrounding whitespace) starts in the text, and how long it is, so that the
+         * caller can report it without the list keeping a copy.
+         */
+        ::std::size_t offset;
+        ::std::size_t length;
+
+        ParseError error;
+    };
+
+    /**
+     * Parses a list of IP addresses and networks, such as an allow or deny list, straight into contiguous arrays,
+     * without constructing an IPv4Address or IPv6Address for each entry.
+     *
+     * Entries are separated by newlines or commas, and each is an IPv4 or IPv6 address (without a scope), in any
+     * form IPv4Address and IPv6Address accept, optionally followed by / and a prefix length. Whitespace around an
+     * entry, blank entries, and everything from a # to the end of its line are ignored. An entry without a prefix
+     * length gets the full length of its address (32 or 128).
+     *
+     * IPv4 entries and IPv6 entries are stored in separate columns, each in the order they appear in the text,
+     * along with the line each is on. Entries that cannot be parsed are skipped and reported by errors(), also in
+     * order. Large texts may be parsed by several threads, each taking a range of whole lines; the result is the
+     * same as parsing on one thread.
+     *
+     * A list does not reference the text after it is built, and does not change.
+     */
+    class OddSource_Export AddressList final
+    {
+    public:
+        /**
+         * Parses the text.
+         *
+         * @param text the entries to parse.
+         * @param options how many threads to parse with.
+         */
+        OddSource_Inline
+        explicit
+        AddressList(
+            ::std::string_view const & text,
+            AddressListOptions const & options = AddressListOptions() );
+
+        /**
+         * @return every IPv4 address, in host byte order (as converted by IPv4Address's std::uint32_t operator).
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv4_addresses() const;
+
+        /**
+         * @return each IPv4 address's prefix length.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint8_t > const &
+        ipv4_prefix_lengths() const;
+
+        /**
+         * @return the line each IPv4 address is on, starting at 1.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv4_lines() const;
+
+        /**
+         * @return every IPv6 address, in network byte order.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< IPv6Address::Bytes > const &
+        ipv6_addresses() const;
+
+        /**
+         * @return each IPv6 address's prefix length.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint8_t > const &
+        ipv6_prefix_lengths() const;
+
+        /**
+         * @return the line each IPv6 address is on, starting at 1.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv6_lines() const;
+
+        /**
+         * @return the entries that could not be parsed.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< AddressListError > const &
+        errors() const;
+
+    private:
+        /**
+         * Parses the entries of text[begin, end), which starts at the beginning of a line, into this list,
+         * numbering that line 1.
+         *
+         * @return the number of newlines in the range.
+         */
+        OddSource_Inline
+        ::std::size_t
+        parse(
+            ::std::string_view const & text,
+            ::std::size_t begin,
+            ::std::size_t end );
+
+        /**
+         * Appends the entries of other to this list, adding lines to each of their line numbers.
+         */
+        OddSource_Inline
+        void
+        append(
+            AddressList const & other,
+            ::std::size_t lines );
+
+        AddressList() = default;
+
+        ::std::vector< ::std::uint32_t > _ipv4Addresses;
+        ::std::vector< ::std::uint8_t > _ipv4PrefixLengths;
+        ::std::vector< ::std::uint32_t > _ipv4Lines;
+
+        ::std::vector< IPv6Address::Bytes > _ipv6Addresses;
+        ::std::vector< ::std::uint8_t > _ipv6PrefixLengths;
+        ::std::vector< ::std::uint32_t > _ipv6Lines;
+
+        ::std::vector< AddressListError > _errors;
+    };
+}
+
+#ifdef IFADDRS4CPP_INLINE_SOURCE
+#include "impl/AddressList.ipp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_ADDRESS_LIST_HPP */
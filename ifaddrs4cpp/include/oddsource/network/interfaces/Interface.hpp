@@ -19,6 +19,7 @@
 #ifndef ODDSOURCE_NETWORK_INTERFACES_INTERFACE_HPP
 #define ODDSOURCE_NETWORK_INTERFACES_INTERFACE_HPP
 
+#include "detail/arena.hpp"
 #include "detail/config.h"
 // ReSharper disable once CppUnusedIncludeDirective
 #include "detail/winsock_includes.h"
@@ -360,6 +361,11 @@ namespace OddSource::Interfaces
         ::std::ostream &,
         InterfaceIPAddress< IPAddressT > const & address );
 
+    namespace detail
+    {
+        class InterfaceBuilder;
+    }
+
     class OddSource_Export Interface
     {
     public:
@@ -374,6 +380,21 @@ namespace OddSource::Interfaces
             ::std::uint32_t flags,
             ::std::optional< ::std::uint64_t const > const & mtu = ::std::nullopt);
 
+        /**
+         * Constructs an interface whose name and descriptions allocate from the given arena, or
+         * from the heap if it is nullptr. The enumeration backends use this to build a whole snapshot in one
+         * arena; the interface must then itself live in that arena (see detail::SnapshotAllocator).
+         */
+        OddSource_Inline
+        Interface(
+            ::std::uint32_t index,
+            ::std::string_view const & name,
+            ::std::string_view const & friendlyName,
+            ::std::string_view const & description,
+            ::std::uint32_t flags,
+            ::std::optional< ::std::uint64_t const > const & mtu,
+            detail::Arena * arena );
+
         OddSource_Inline
         Interface(
             Interface const & other );
@@ -406,6 +427,30 @@ namespace OddSource::Interfaces
         ::std::string
         description() const;
 
+        /**
+         * Returns the name without copying it. The view is valid for as long as this interface is.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::string_view
+        name_view() const;
+
+        /**
+         * Returns the friendly name without copying it. The view is valid for as long as this interface is.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::string_view
+        friendly_name_view() const;
+
+        /**
+         * Returns the description without copying it. The view is valid for as long as this interface is.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::string_view
+        description_view() const;
+
         [[nodiscard]]
         OddSource_Inline
         bool
@@ -467,12 +512,40 @@ namespace OddSource::Interfaces
 
         friend class InterfaceBrowser;
 
+        friend class InterfaceMonitor;
+
+        friend class InterfaceEnumeration;
+
+        friend class detail::InterfaceBuilder;
+
         friend class TestInterface;
 
+        typedef ::std::basic_string< char, ::std::char_traits< char >, detail::ArenaAllocator< char > > String;
+
+        // where one of the names is in _names
+        struct NameSpan
+        {
+            ::std::uint32_t offset;
+            ::std::uint32_t length;
+        };
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::string_view
+        view(
+            NameSpan const & span ) const;
+
+        OddSource_Inline
+        NameSpan
+        storeName(
+            ::std::string_view const & value );
+
         ::std::uint32_t _index; // DWORD on Windows
-        ::std::string _name;
-        ::std::string _friendlyName;
-        ::std::string _description;
+        // the name, friendly name, and description, each stored once no matter how many of them are equal
+        String _names;
+        NameSpan _name;
+        NameSpan _friendlyName;
+        NameSpan _description;
         ::std::uint32_t _flags;
         ::std::optional< ::std::uint64_t const > _mtu;
         ::std::optional< MacAddress const > _macAddress;
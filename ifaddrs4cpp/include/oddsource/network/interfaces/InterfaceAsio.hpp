@@ -0,0 +1,286 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_INTERFACE_ASIO_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_INTERFACE_ASIO_HPP
+
+#include "detail/config.h"
+#include "Interfaces.hpp"
+
+#ifdef ODDSOURCE_INCLUDE_BOOST
+
+#include ODDSOURCE_BOOST_HEADER(asio/compose.hpp)
+#include ODDSOURCE_BOOST_HEADER(asio/post.hpp)
+#include ODDSOURCE_BOOST_HEADER(asio/posix/stream_descriptor.hpp)
+#include ODDSOURCE_BOOST_HEADER(system/system_error.hpp)
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifdef BOOST_ASIO_HAS_POSIX_STREAM_DESCRIPTOR
+
+namespace OddSource::Interfaces
+{
+    namespace detail
+    {
+        /**
+         * Waits on a file descriptor owned by someone else. Asio closes the descriptors it holds, so this
+         * releases it instead.
+         */
+        class BorrowedDescriptor final
+        {
+        public:
+            template< typename Executor >
+            BorrowedDescriptor(
+                Executor const & executor,
+                int const fd )
+                : _descriptor( executor, fd )
+            {
+            }
+
+            BorrowedDescriptor(
+                BorrowedDescriptor const & ) = delete;
+
+            ~BorrowedDescriptor() noexcept
+            {
+                this->_descriptor.release();
+            }
+
+            BorrowedDescriptor &
+            operator=(
+                BorrowedDescriptor const & ) = delete;
+
+            template< typename Handler >
+            void
+            async_wait_readable(
+                Handler && handler )
+            {
+                this->_descriptor.async_wait(
+                    ODDSOURCE_BOOST_NAMESPACE_ROOT::asio::posix::descriptor_base::wait_read,
+                    ::std::forward< Handler >( handler ) );
+            }
+
+        private:
+            ODDSOURCE_BOOST_NAMESPACE_ROOT::asio::posix::stream_descriptor _descriptor;
+        };
+
+        template< typename Executor >
+        class AsyncEnumerateOperation
+        {
+        public:
+            AsyncEnumerateOperation(
+                Executor const & executor,
+                EnumerationOptions const & options )
+                : _executor( executor ),
+                  _options( options )
+            {
+            }
+
+            template< typename Self >
+            void
+            operator()(
+                Self & self,
+                ODDSOURCE_BOOST_NAMESPACE_ROOT::system::error_code const & error = {} )
+            {
+                if ( !this->_started )
+                {
+                    // never complete from within the initiating function
+                    this->_started = true;
+                    ODDSOURCE_BOOST_NAMESPACE_ROOT::asio::post( this->_executor, ::std::move( self ) );
+                    return;
+                }
+
+                ::std::shared_ptr< InterfaceBrowser const > result;
+                try
+                {
+                    if ( error )
+                    {
+                        throw ODDSOURCE_BOOST_NAMESPACE_ROOT::system::system_error( error );
+                    }
+                    if ( !this->_enumeration )
+                    {
+                        this->_enumeration = ::std::make_unique< InterfaceEnumeration >( this->_options );
+                        if ( !this->_enumeration->done() )
+                        {
+                            this->_descriptor = ::std::make_unique< BorrowedDescriptor >(
+                                this->_executor,
+                                this->_enumeration->native_handle() );
+                        }
+                    }
+                    else
+                    {
+                        this->_enumeration->on_readable();
+                    }
+
+                    if ( !this->_enumeration->done() )
+                    {
+                        this->_descriptor->async_wait_readable( ::std::move( self ) );
+                        return;
+                    }
+                    result = this->_enumeration->result();
+                }
+                catch ( ... )
+                {
+                    this->_descriptor.reset();
+                    self.complete( ::std::current_exception(), nullptr );
+                    return;
+                }
+                this->_descriptor.reset();
+                self.complete( nullptr, ::std::move( result ) );
+            }
+
+        private:
+            Executor _executor;
+            EnumerationOptions _options;
+            bool _started{ false };
+            ::std::unique_ptr< InterfaceEnumeration > _enumeration;
+            // declared after the enumeration so that it is released before the enumeration closes the socket
+            ::std::unique_ptr< BorrowedDescriptor > _descriptor;
+        };
+
+        template< typename Executor >
+        class AsyncWaitChangeOperation
+        {
+        public:
+            AsyncWaitChangeOperation(
+                Executor const & executor,
+                InterfaceMonitor & monitor )
+                : _executor( executor ),
+                  _monitor( monitor )
+            {
+            }
+
+            template< typename Self >
+            void
+            operator()(
+                Self & self,
+                ODDSOURCE_BOOST_NAMESPACE_ROOT::system::error_code const & error = {} )
+            {
+                if ( !this->_started )
+                {
+                    // never complete from within the initiating function
+                    this->_started = true;
+                    ODDSOURCE_BOOST_NAMESPACE_ROOT::asio::post( this->_executor, ::std::move( self ) );
+                    return;
+                }
+
+                ::std::vector< InterfaceEvent > events;
+                try
+                {
+                    if ( error )
+                    {
+                        throw ODDSOURCE_BOOST_NAMESPACE_ROOT::system::system_error( error );
+                    }
+
+                    // notifications that arrived before the wait started are delivered without waiting
+                    this->_monitor.get().poll_events(
+                        [ &events ]( InterfaceEvent && event ) { events.push_back( ::std::move( event ) ); } );
+                    if ( events.empty() )
+                    {
+                        // nothing yet, or everything that arrived was filtered out by the monitor's options
+                        if ( !this->_descriptor )
+                        {
+                            this->_descriptor = ::std::make_unique< BorrowedDescriptor >(
+                                this->_executor,
+                                this->_monitor.get().native_handle() );
+                        }
+                        this->_descriptor->async_wait_readable( ::std::move( self ) );
+                        return;
+                    }
+                }
+                catch ( ... )
+                {
+                    this->_descriptor.reset();
+                    self.complete( ::std::current_exception(), {} );
+                    return;
+                }
+                this->_descriptor.reset();
+                self.complete( nullptr, ::std::move( events ) );
+            }
+
+        private:
+            Executor _executor;
+            ::std::reference_wrapper< InterfaceMonitor > _monitor;
+            bool _started{ false };
+            ::std::unique_ptr< BorrowedDescriptor > _descriptor;
+        };
+    }
+
+    /**
+     * Enumerates interfaces without blocking the event loop, using InterfaceEnumeration. Where non-blocking
+     * enumeration is not available, the enumeration runs synchronously within the executor instead.
+     *
+     * @param executor the executor on which to wait and complete, such as io_context::get_executor().
+     * @param options the enumeration options.
+     * @param token the completion token, for a handler with signature
+     *        void( std::exception_ptr, std::shared_ptr< InterfaceBrowser const > ). The exception is null on
+     *        success, and otherwise holds the InterfaceBrowserSystemError (or, if waiting failed, the
+     *        boost::system::system_error) that stopped the enumeration.
+     * @return whatever the completion token's async_result returns.
+     */
+    template< typename Executor, typename CompletionToken >
+    auto
+    async_enumerate(
+        Executor const & executor,
+        EnumerationOptions const & options,
+        CompletionToken && token )
+    {
+        return ODDSOURCE_BOOST_NAMESPACE_ROOT::asio::async_compose<
+            CompletionToken,
+            void( ::std::exception_ptr, ::std::shared_ptr< InterfaceBrowser const > ) >(
+                detail::AsyncEnumerateOperation< Executor >( executor, options ),
+                token,
+                executor );
+    }
+
+    /**
+     * Waits without blocking the event loop until the monitor reports at least one event, then completes with
+     * every event that is waiting. Only one wait may be outstanding per monitor, and the monitor must outlive it.
+     *
+     * @param monitor the monitor to wait on.
+     * @param executor the executor on which to wait and complete, such as io_context::get_executor().
+     * @param token the completion token, for a handler with signature
+     *        void( std::exception_ptr, std::vector< InterfaceEvent > ). The exception is null on success, and
+     *        otherwise holds the error that stopped the wait.
+     * @return whatever the completion token's async_result returns.
+     */
+    template< typename Executor, typename CompletionToken >
+    auto
+    async_wait_change(
+        InterfaceMonitor & monitor,
+        Executor const & executor,
+        CompletionToken && token )
+    {
+        return ODDSOURCE_BOOST_NAMESPACE_ROOT::asio::async_compose<
+            CompletionToken,
+            void( ::std::exception_ptr, ::std::vector< InterfaceEvent > ) >(
+                detail::AsyncWaitChangeOperation< Executor >( executor, monitor ),
+                token,
+                executor );
+    }
+}
+
+#endif /* BOOST_ASIO_HAS_POSIX_STREAM_DESCRIPTOR */
+
+#endif /* ODDSOURCE_INCLUDE_BOOST */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_INTERFACE_ASIO_HPP */
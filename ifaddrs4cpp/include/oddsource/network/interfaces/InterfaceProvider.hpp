@@ -0,0 +1,202 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_INTERFACE_PROVIDER_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_INTERFACE_PROVIDER_HPP
+
+#include "detail/builder.hpp"
+#include "detail/config.h"
+#include "Interface.hpp"
+#include "Interfaces.hpp"
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace OddSource::Interfaces
+{
+    /**
+     * Receives the interfaces and addresses an InterfaceProvider reports, and builds them into the browser's
+     * Interface objects. It applies the EnumerationOptions the same way the system backends do, so a provider
+     * can report everything it has and let the collector leave out what the options exclude.
+     */
+    class OddSource_Export InterfaceCollector final
+    {
+    public:
+        InterfaceCollector(
+            InterfaceCollector const & ) = delete;
+
+        InterfaceCollector &
+        operator=(
+            InterfaceCollector const & ) = delete;
+
+        /**
+         * Returns the options of the enumeration being collected, for providers that can avoid producing
+         * details the options exclude.
+         *
+         * @return the options.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        EnumerationOptions const &
+        options() const;
+
+        /**
+         * Adds an interface, whose name is also used as its friendly name and description.
+         *
+         * @param index the interface index, which must be unique among the provider's interfaces.
+         * @param name the interface name, which must be unique among the provider's interfaces.
+         * @param flags the IFF_* flags.
+         * @param mtu the MTU, if known.
+         * @return the interface, to pass to the other methods, or null if the options exclude it.
+         */
+        OddSource_Inline
+        Interface *
+        add_interface(
+            ::std::uint32_t index,
+            ::std::string_view const & name,
+            ::std::uint32_t flags,
+            ::std::optional< ::std::uint64_t > mtu = ::std::nullopt );
+
+        /**
+         * Sets the MAC address of an interface returned by add_interface, unless the options skip MAC addresses.
+         */
+        OddSource_Inline
+        void
+        set_mac_address(
+            Interface & rInterface,
+            MacAddress && macAddress );
+
+        /**
+         * Adds an IPv4 address to an interface returned by add_interface, unless the options exclude IPv4.
+         */
+        OddSource_Inline
+        void
+        add_ipv4_address(
+            Interface & rInterface,
+            InterfaceIPv4Address && address );
+
+        /**
+         * Adds an IPv6 address to an interface returned by add_interface, unless the options exclude IPv6. Its
+         * flags are dropped if the options skip address flags.
+         */
+        OddSource_Inline
+        void
+        add_ipv6_address(
+            Interface & rInterface,
+            InterfaceIPv6Address && address );
+
+        /**
+         * Adds a warning, which the browser reports from getWarnings().
+         */
+        OddSource_Inline
+        void
+        add_warning(
+            ::std::string warning );
+
+    private:
+        friend class InterfaceBrowser;
+
+        OddSource_Inline
+        InterfaceCollector(
+            EnumerationOptions const & options,
+            ::std::list< ::std::string > & warnings,
+            ::std::list< ::std::shared_ptr< Interface const > > & interfaces );
+
+        EnumerationOptions const & _options;
+        ::std::list< ::std::string > & _warnings;
+        ::std::list< ::std::shared_ptr< Interface const > > & _interfaces;
+        detail::InterfaceBuilder const _builder;
+        detail::SnapshotAllocator const _allocator;
+    };
+
+    /**
+     * A source of interfaces other than the system, set with EnumerationOptions::provider. Every way of
+     * enumerating (InterfaceBrowser, refresh, lookup, shared, InterfaceSnapshots, and InterfaceRefresher) uses
+     * the provider when one is set, and the resulting browser reports EnumerationBackend::Provider.
+     *
+     * A provider may be used by several enumerations at once, from different threads, so populate must be safe
+     * to call concurrently.
+     */
+    class OddSource_Export InterfaceProvider
+    {
+    public:
+        OddSource_Inline
+        virtual
+        ~InterfaceProvider() noexcept;
+
+        /**
+         * Reports every interface, with its details and addresses, to the collector.
+         *
+         * @param collector receives the interfaces.
+         * @throws InterfaceBrowserSystemError if the interfaces cannot be enumerated.
+         */
+        virtual
+        void
+        populate(
+            InterfaceCollector & collector ) const = 0;
+    };
+
+    /**
+     * Generates any number of interfaces, each with any number of IPv4 and IPv6 addresses, without touching
+     * the system. It is meant for measuring how enumeration, lookups, refresh, and memory use scale on hosts
+     * with thousands of interfaces (such as container hosts with one veth per container) on a machine that has
+     * only a few.
+     *
+     * Interface i (counting from 0) has index i + 1, the name "syn" followed by i, flags IFF_UP, IFF_RUNNING,
+     * IFF_BROADCAST, and IFF_MULTICAST, MTU 1500, and a locally administered MAC address derived from i. Its
+     * IPv4 addresses are consecutive 10.0.0.0/8 addresses starting at 10.0.0.1, unique across interfaces as long
+     * as there are fewer than 2^24 in total, and its IPv6 addresses are consecutive addresses, starting at host 1,
+     * in fd00:0:h:l::/64, where h and l are the high and low 16 bits of i (so interface 70000 has
+     * fd00:0:1:1170::/64).
+     */
+    class OddSource_Export SyntheticInterfaceProvider final : public InterfaceProvider
+    {
+    public:
+        /**
+         * @param interfaces the number of interfaces to generate.
+         * @param ipv4Addresses the number of IPv4 addresses on each interface.
+         * @param ipv6Addresses the number of IPv6 addresses on each interface.
+         */
+        OddSource_Inline
+        SyntheticInterfaceProvider(
+            ::std::size_t interfaces,
+            ::std::size_t ipv4Addresses,
+            ::std::size_t ipv6Addresses );
+
+        OddSource_Inline
+        void
+        populate(
+            InterfaceCollector & collector ) const final;
+
+    private:
+        ::std::size_t const _interfaces;
+        ::std::size_t const _ipv4Addresses;
+        ::std::size_t const _ipv6Addresses;
+    };
+}
+
+#ifdef IFADDRS4CPP_INLINE_SOURCE
+#include "impl/InterfaceProvider.ipp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_INTERFACE_PROVIDER_HPP */
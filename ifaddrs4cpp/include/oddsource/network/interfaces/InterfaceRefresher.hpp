@@ -0,0 +1,208 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_INTERFACE_REFRESHER_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_INTERFACE_REFRESHER_HPP
+
+#include "detail/config.h"
+#include "InterfaceSnapshots.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace OddSource::Interfaces
+{
+    /**
+     * Controls when an InterfaceRefresher rebuilds its snapshot.
+     */
+    struct OddSource_Export RefresherOptions
+    {
+        /**
+         * The options for each enumeration and, if monitoring, for the monitor.
+         */
+        EnumerationOptions enumeration = EnumerationOptions();
+
+        /**
+         * Refresh this long after the previous refresh even if nothing signalled a change, or never if nullopt.
+         */
+        ::std::optional< ::std::chrono::milliseconds > interval = ::std::chrono::seconds( 5 );
+
+        /**
+         * Refresh when an InterfaceMonitor reports a change. Ignored, with a warning, where monitoring is not
+         * available.
+         */
+        bool monitor = true;
+
+        /**
+         * After a trigger, wait this long and fold every further trigger into the same refresh.
+         */
+        ::std::chrono::milliseconds coalesce_window = ::std::chrono::milliseconds( 50 );
+
+        /**
+         * Start refreshes at least this far apart, however often they are triggered. This bounds the
+         * enumeration load when links churn continuously.
+         */
+        ::std::chrono::milliseconds min_interval = ::std::chrono::milliseconds( 500 );
+
+        /**
+         * If set, called on the refresher's thread after each refresh that found changes, once the new
+         * snapshot is published. It must not destroy the refresher.
+         */
+        ::std::function< void( ::std::vector< InterfaceEvent > const & ) > on_change = nullptr;
+    };
+
+    /**
+     * What an InterfaceRefresher has done since it started.
+     */
+    struct OddSource_Export RefresherStatistics
+    {
+        /**
+         * When the refresher started, for computing refresh rates.
+         */
+        ::std::chrono::steady_clock::time_point started {};
+
+        /**
+         * When the most recent refresh finished, successfully or not, if any has.
+         */
+        ::std::optional< ::std::chrono::steady_clock::time_point > last_refresh = ::std::nullopt;
+
+        /**
+         * Refreshes performed, including failed ones.
+         */
+        ::std::uint64_t refreshes = 0;
+
+        /**
+         * Refreshes that failed and left the previous snapshot in place.
+         */
+        ::std::uint64_t failures = 0;
+
+        /**
+         * Refreshes that found changes and published a different snapshot.
+         */
+        ::std::uint64_t changed_refreshes = 0;
+
+        /**
+         * Triggers received by source. Each refresh absorbs every trigger that arrived before it started, so
+         * the sum of these minus refreshes is how many triggers coalescing saved.
+         */
+        ::std::uint64_t timer_triggers = 0;
+        ::std::uint64_t monitor_triggers = 0;
+        ::std::uint64_t manual_triggers = 0;
+
+        /**
+         * How long refreshes took to enumerate and publish.
+         */
+        ::std::chrono::nanoseconds last_latency = ::std::chrono::nanoseconds::zero();
+        ::std::chrono::nanoseconds max_latency = ::std::chrono::nanoseconds::zero();
+        ::std::chrono::nanoseconds total_latency = ::std::chrono::nanoseconds::zero();
+
+        /**
+         * The message from the most recent failed refresh, on_change call that threw, or failed attempt to start
+         * monitoring. The background thread catches every exception, so none of these stop it.
+         */
+        ::std::optional< ::std::string > last_error = ::std::nullopt;
+    };
+
+    /**
+     * Keeps an InterfaceSnapshots up to date from a background thread that the refresher owns, so that
+     * processes don't each need their own refresh thread. The thread refreshes on a timer, when an
+     * InterfaceMonitor reports a change, or when trigger() is called. Bursts of triggers are merged into a
+     * single refresh, and refreshes are never closer together than RefresherOptions::min_interval.
+     */
+    class OddSource_Export InterfaceRefresher final
+    {
+    public:
+        /**
+         * Enumerates the interfaces once, publishes the result, and starts the background thread.
+         *
+         * @param options when and how to refresh.
+         * @throws InterfaceBrowserSystemError if the first enumeration fails.
+         */
+        OddSource_Inline
+        explicit
+        InterfaceRefresher(
+            RefresherOptions options = RefresherOptions() );
+
+        InterfaceRefresher(
+            InterfaceRefresher const & ) = delete;
+
+        /**
+         * Stops the background thread, waiting for a refresh in progress to finish.
+         */
+        OddSource_Inline
+        ~InterfaceRefresher() noexcept;
+
+        InterfaceRefresher &
+        operator=(
+            InterfaceRefresher const & ) = delete;
+
+        /**
+         * Returns the published snapshots. Reader threads should create an InterfaceSnapshots::Reader from it.
+         *
+         * @return the snapshots.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        InterfaceSnapshots const &
+        snapshots() const;
+
+        /**
+         * Returns the most recently published snapshot.
+         *
+         * @return the snapshot.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::shared_ptr< InterfaceBrowser const >
+        latest() const;
+
+        /**
+         * Asks for a refresh. Returns immediately; the refresh happens on the background thread, merged with
+         * any other triggers that arrive within the coalescing window.
+         */
+        OddSource_Inline
+        void
+        trigger();
+
+        /**
+         * Returns what the refresher has done so far.
+         *
+         * @return a copy of the statistics.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        RefresherStatistics
+        statistics() const;
+
+    private:
+        class Implementation;
+
+        ::std::unique_ptr< Implementation > _implementation;
+    };
+}
+
+#ifdef IFADDRS4CPP_INLINE_SOURCE
+#include "impl/InterfaceRefresher.ipp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_INTERFACE_REFRESHER_HPP */
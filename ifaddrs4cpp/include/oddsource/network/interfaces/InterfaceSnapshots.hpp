@@ -0,0 +1,201 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_INTERFACE_SNAPSHOTS_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_INTERFACE_SNAPSHOTS_HPP
+
+#include "detail/config.h"
+#include "Interfaces.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OddSource::Interfaces
+{
+    /**
+     * Publishes immutable InterfaceBrowser snapshots to any number of reader threads, so that a process can
+     * enumerate once and share the result instead of every thread building its own browser.
+     *
+     * Writers call publish or refresh to install a new snapshot. Any number of threads may write at once;
+     * writes are serialized, so that each refresh compares against the snapshot the previous write installed and
+     * no change is lost or reported twice. Readers never wait for a writer. Each reader thread owns a
+     * Reader, whose get() costs one atomic load when nothing was published since its last call: no lock, no
+     * reference count change, and no write to memory shared with other threads. Only the first get() after a
+     * publish takes a short lock to pick up the new snapshot. A snapshot stays alive as long as any Reader or
+     * other holder still references it.
+     */
+    class OddSource_Export InterfaceSnapshots final
+    {
+    public:
+        /**
+         * A single thread's view of the published snapshots. A Reader must not be shared between threads, and
+         * must not outlive the InterfaceSnapshots it reads from.
+         */
+        class OddSource_Export Reader final
+        {
+        public:
+            OddSource_Inline
+            explicit
+            Reader(
+                InterfaceSnapshots const & snapshots );
+
+            /**
+             * Returns the most recently published snapshot.
+             *
+             * @return the snapshot, which stays valid and unchanged until the next call to get() on this Reader
+             *         or until this Reader is destroyed.
+             */
+            [[nodiscard]]
+            inline
+            InterfaceBrowser const &
+            get();
+
+            /**
+             * Returns the snapshot that the last call to get() returned, for keeping it beyond the next call.
+             *
+             * @return the snapshot.
+             */
+            [[nodiscard]]
+            OddSource_Inline
+            ::std::shared_ptr< InterfaceBrowser const > const &
+            pointer() const;
+
+        private:
+            OddSource_Inline
+            void
+            update();
+
+            InterfaceSnapshots const & _snapshots;
+            ::std::shared_ptr< InterfaceBrowser const > _snapshot;
+            ::std::uint64_t _version;
+        };
+
+        /**
+         * Enumerates the interfaces with the given options and publishes the result as the first snapshot.
+         *
+         * @param options the enumeration options, also used by refresh.
+         * @throws InterfaceBrowserSystemError if enumeration fails.
+         */
+        OddSource_Inline
+        explicit
+        InterfaceSnapshots(
+            EnumerationOptions const & options = EnumerationOptions() );
+
+        /**
+         * Publishes the given browser as the first snapshot.
+         *
+         * @param initial the first snapshot, which must not be null.
+         */
+        OddSource_Inline
+        explicit
+        InterfaceSnapshots(
+            ::std::shared_ptr< InterfaceBrowser const > initial );
+
+        InterfaceSnapshots(
+            InterfaceSnapshots const & ) = delete;
+
+        OddSource_Inline
+        ~InterfaceSnapshots() noexcept;
+
+        InterfaceSnapshots &
+        operator=(
+            InterfaceSnapshots const & ) = delete;
+
+        /**
+         * Replaces the published snapshot, after any refresh in progress on another thread. Readers see the new
+         * snapshot on their next get().
+         *
+         * @param snapshot the new snapshot, which must not be null.
+         */
+        OddSource_Inline
+        void
+        publish(
+            ::std::shared_ptr< InterfaceBrowser const > snapshot );
+
+        /**
+         * Enumerates again with the options the current snapshot was created with and publishes the result,
+         * sharing the current snapshot's objects for interfaces that did not change. The current snapshot is
+         * not modified, so readers can keep using it while this runs. Other writers wait until this finishes.
+         *
+         * @return what changed since the current snapshot, as described for InterfaceBrowser::refresh.
+         * @throws InterfaceBrowserSystemError if enumeration fails, in which case nothing is published.
+         */
+        OddSource_Inline
+        ::std::vector< InterfaceEvent >
+        refresh();
+
+        /**
+         * Returns the published snapshot. This takes a short lock; threads that read repeatedly should use a
+         * Reader instead.
+         *
+         * @return the snapshot.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::shared_ptr< InterfaceBrowser const >
+        load() const;
+
+        /**
+         * Returns the number of snapshots published so far, including the first.
+         *
+         * @return the version.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::uint64_t
+        version() const;
+
+    private:
+        /**
+         * Replaces the published snapshot. The caller must hold _writerMutex.
+         */
+        OddSource_Inline
+        void
+        install(
+            ::std::shared_ptr< InterfaceBrowser const > snapshot );
+
+        // kept on its own cache line, because every reader polls it and only publishing writes it
+        alignas( 64 ) ::std::atomic< ::std::uint64_t > _version;
+        alignas( 64 ) mutable ::std::mutex _mutex;
+        ::std::shared_ptr< InterfaceBrowser const > _snapshot;
+
+        // held by writers for a whole refresh, and never by readers, so that a slow refresh does not block them
+        ::std::mutex _writerMutex;
+    };
+
+    inline
+    InterfaceBrowser const &
+    InterfaceSnapshots::Reader::
+    get()
+    {
+        if ( this->_snapshots._version.load( ::std::memory_order_acquire ) != this->_version )
+        {
+            this->update();
+        }
+        return *this->_snapshot;
+    }
+}
+
+#ifdef IFADDRS4CPP_INLINE_SOURCE
+#include "impl/InterfaceSnapshots.ipp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_INTERFACE_SNAPSHOTS_HPP */
@@ -0,0 +1,212 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_INTERFACE_TABLE_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_INTERFACE_TABLE_HPP
+
+#include "detail/config.h"
+#include "Interfaces.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace OddSource::Interfaces
+{
+    /**
+     * A column-oriented copy of an InterfaceBrowser snapshot, for questions that scan every interface or every
+     * address, such as "all up interfaces with an MTU of at least 9000" or "all global IPv6 addresses."
+     *
+     * Each interface is a row, in the order the browser enumerated them. The index, flags, and MTU of every row
+     * are each stored in one contiguous array, and the addresses of every row are flattened into contiguous
+     * arrays of raw addresses, prefix lengths, flags, and owning rows, grouped by row. Row r's IPv4 addresses
+     * are the elements from ipv4_offsets()[r] up to (not including) ipv4_offsets()[r + 1], and likewise for
+     * IPv6. A scan reads only the columns it tests, sequentially, instead of following a pointer to each
+     * Interface and each address. For everything else (names, MAC addresses, broadcast addresses, and so on),
+     * interfaces() holds the browser's Interface objects, which the table keeps alive.
+     *
+     * A table does not change after it is built; build a new one from a refreshed browser.
+     */
+    class OddSource_Export InterfaceTable final
+    {
+    public:
+        /**
+         * The value in mtus() for interfaces whose MTU was not collected.
+         */
+        static constexpr ::std::uint64_t const NO_MTU{ 0 };
+
+        /**
+         * Copies the browser's interfaces and addresses into columns.
+         *
+         * @param browser the snapshot to copy, which the table does not reference afterward.
+         */
+        OddSource_Inline
+        explicit
+        InterfaceTable(
+            InterfaceBrowser const & browser );
+
+        /**
+         * @return the number of rows (interfaces).
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::size_t
+        size() const;
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::shared_ptr< Interface const > > const &
+        interfaces() const;
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        indexes() const;
+
+        /**
+         * @return each row's InterfaceFlag bits.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        flags() const;
+
+        /**
+         * @return each row's MTU, or NO_MTU if it was not collected.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint64_t > const &
+        mtus() const;
+
+        /**
+         * @return size() + 1 offsets into the IPv4 address columns, one for the start of each row's
+         *         addresses and one for the end of the last row's.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv4_offsets() const;
+
+        /**
+         * @return the row each IPv4 address belongs to.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv4_rows() const;
+
+        /**
+         * @return every IPv4 address, in host byte order (as converted by IPv4Address's std::uint32_t operator).
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv4_addresses() const;
+
+        /**
+         * @return each IPv4 address's prefix length, or 0 if unknown.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint8_t > const &
+        ipv4_prefix_lengths() const;
+
+        /**
+         * @return each IPv4 address's InterfaceIPAddressFlag bits.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint16_t > const &
+        ipv4_flags() const;
+
+        /**
+         * @return size() + 1 offsets into the IPv6 address columns, as described for ipv4_offsets().
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv6_offsets() const;
+
+        /**
+         * @return the row each IPv6 address belongs to.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv6_rows() const;
+
+        /**
+         * @return every IPv6 address, in network byte order.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< IPv6Address::Bytes > const &
+        ipv6_addresses() const;
+
+        /**
+         * @return each IPv6 address's prefix length, or 0 if unknown.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint8_t > const &
+        ipv6_prefix_lengths() const;
+
+        /**
+         * @return each IPv6 address's InterfaceIPAddressFlag bits.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint16_t > const &
+        ipv6_flags() const;
+
+        /**
+         * @return each IPv6 address's scope ID, or 0 if it has none.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::vector< ::std::uint32_t > const &
+        ipv6_scope_ids() const;
+
+    private:
+        ::std::vector< ::std::shared_ptr< Interface const > > _interfaces;
+        ::std::vector< ::std::uint32_t > _indexes;
+        ::std::vector< ::std::uint32_t > _flags;
+        ::std::vector< ::std::uint64_t > _mtus;
+
+        ::std::vector< ::std::uint32_t > _ipv4Offsets;
+        ::std::vector< ::std::uint32_t > _ipv4Rows;
+        ::std::vector< ::std::uint32_t > _ipv4Addresses;
+        ::std::vector< ::std::uint8_t > _ipv4PrefixLengths;
+        ::std::vector< ::std::uint16_t > _ipv4Flags;
+
+        ::std::vector< ::std::uint32_t > _ipv6Offsets;
+        ::std::vector< ::std::uint32_t > _ipv6Rows;
+        ::std::vector< IPv6Address::Bytes > _ipv6Addresses;
+        ::std::vector< ::std::uint8_t > _ipv6PrefixLengths;
+        ::std::vector< ::std::uint16_t > _ipv6Flags;
+        ::std::vector< ::std::uint32_t > _ipv6ScopeIds;
+    };
+}
+
+#ifdef IFADDRS4CPP_INLINE_SOURCE
+#include "impl/InterfaceTable.ipp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_INTERFACE_TABLE_HPP */
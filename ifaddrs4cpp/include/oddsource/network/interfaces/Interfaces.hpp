@@ -22,15 +22,22 @@
 #include "detail/config.h"
 #include "Interface.hpp"
 
+#include <chrono>
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <list>
 #include <memory>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <string_view>
-#include <unordered_map>
+#include <vector>
 
 namespace OddSource::Interfaces
 {
+    class InterfaceProvider;
+
     class OddSource_Export InterfaceBrowserSystemError : public ::std::runtime_error
     {
     public:
@@ -67,12 +74,222 @@ namespace OddSource::Interfaces
     };
 #endif
 
+    /**
+     * Selects the system facility an InterfaceBrowser uses to enumerate interfaces.
+     */
+    enum class OddSource_Export EnumerationBackend : ::std::uint8_t
+    {
+        /**
+         * Netlink where the platform supports it, falling back to Portable (with a warning)
+         * if the netlink socket cannot be used, and Portable everywhere else.
+         */
+        Automatic,
+        /**
+         * getifaddrs (GetAdaptersAddresses on Windows), plus the per-interface and
+         * per-address system calls needed to fill in details it does not report.
+         */
+        Portable,
+        /**
+         * Linux rtnetlink RTM_GETLINK and RTM_GETADDR dumps, which report indexes, flags,
+         * MTUs, MAC addresses, and every address in two requests. Not available on other
+         * platforms.
+         */
+        Netlink,
+        /**
+         * The EnumerationOptions::provider, instead of the system. Reported by InterfaceBrowser::backend() when a
+         * provider was set; selecting it without setting a provider is an error.
+         */
+        Provider,
+    };
+
+    /**
+     * Selects which address families an InterfaceBrowser collects.
+     */
+    enum class OddSource_Export AddressFamilies : ::std::uint8_t
+    {
+        None = 0x0,
+        IPv4 = 0x1,
+        IPv6 = 0x2,
+        All = IPv4 | IPv6,
+    };
+
+    /**
+     * Limits what an InterfaceBrowser collects. Everything that is filtered out or skipped is
+     * never requested from the system (no system call is made and nothing is allocated for
+     * it) wherever the backend allows, and with the Netlink backend the family and
+     * interface filters are applied by the kernel. The defaults collect everything, exactly
+     * like the default InterfaceBrowser constructor.
+     */
+    struct OddSource_Export EnumerationOptions
+    {
+        /**
+         * The backend to enumerate with.
+         */
+        EnumerationBackend backend = EnumerationBackend::Automatic;
+
+        /**
+         * The address families whose addresses are collected. Interfaces are still returned
+         * if they have no addresses of these families.
+         */
+        AddressFamilies address_families = AddressFamilies::All;
+
+        /**
+         * If true, interfaces will not have MAC addresses.
+         */
+        bool skip_mac_address = false;
+
+        /**
+         * If true, interfaces will not have MTUs.
+         */
+        bool skip_mtu = false;
+
+        /**
+         * If true, IPv6 addresses will not have flags (temporary, deprecated, etc.).
+         */
+        bool skip_address_flags = false;
+
+        /**
+         * If true, only interfaces that are up are collected.
+         */
+        bool up_only = false;
+
+        /**
+         * If set, only the interface with this name is collected.
+         */
+        ::std::optional< ::std::string > name = ::std::nullopt;
+
+        /**
+         * If set, only the interface with this index is collected.
+         */
+        ::std::optional< ::std::uint32_t > index = ::std::nullopt;
+
+        /**
+         * If set, interfaces come from this provider instead of the system, and the backend is ignored. The
+         * other options apply as usual. InterfaceMonitor ignores this.
+         */
+        ::std::shared_ptr< InterfaceProvider const > provider = nullptr;
+
+        /**
+         * If true, the interfaces of one enumeration, with their names, are allocated together from a few large
+         * blocks that are freed in one step when the last of them is released, instead of one by one from the
+         * heap. Refreshes allocate their new interfaces from the heap either way, so the blocks of the first
+         * enumeration are the only ones a browser and its refreshes ever hold; turn this off if a few of its
+         * interfaces are kept long after the rest are released.
+         */
+        bool arena = true;
+    };
+
+    /**
+     * The kind of change an InterfaceEvent reports.
+     */
+    enum class OddSource_Export InterfaceEventType : ::std::uint8_t
+    {
+        /**
+         * An interface appeared.
+         */
+        LinkAdded,
+        /**
+         * An interface disappeared.
+         */
+        LinkRemoved,
+        /**
+         * An interface's flags, MTU, MAC address, or name changed.
+         */
+        LinkChanged,
+        /**
+         * An address was assigned to an interface.
+         */
+        AddressAdded,
+        /**
+         * An address was removed from an interface.
+         */
+        AddressRemoved,
+        /**
+         * The system dropped notifications because they arrived faster than they were read.
+         * Any state built from earlier events should be rebuilt from a new InterfaceBrowser.
+         */
+        Overflow,
+    };
+
+    /**
+     * A single change reported by an InterfaceMonitor.
+     */
+    struct OddSource_Export InterfaceEvent
+    {
+        InterfaceEventType type = InterfaceEventType::Overflow;
+
+        /**
+         * The index of the interface that changed (0 for Overflow).
+         */
+        ::std::uint32_t index = 0;
+
+        /**
+         * The name of the interface that changed, if known (a removed interface's addresses
+         * may be reported after its name is gone).
+         */
+        ::std::string name = ::std::string();
+
+        /**
+         * For link events, the interface's state as of this event, without addresses.
+         */
+        ::std::shared_ptr< Interface const > link = nullptr;
+
+        /**
+         * For address events on IPv4 addresses, the address.
+         */
+        ::std::optional< InterfaceIPv4Address > ipv4_address = ::std::nullopt;
+
+        /**
+         * For address events on IPv6 addresses, the address.
+         */
+        ::std::optional< InterfaceIPv6Address > ipv6_address = ::std::nullopt;
+    };
+
     class OddSource_Export InterfaceBrowser final
     {
     public:
         OddSource_Inline
         InterfaceBrowser();
 
+        /**
+         * Enumerates all interfaces using the given backend.
+         *
+         * @param backend the enumeration backend to use.
+         * @throws InterfaceBrowserSystemError if enumeration fails, including if Netlink is
+         *         requested on a platform that does not support it.
+         */
+        OddSource_Inline
+        explicit
+        InterfaceBrowser(
+            EnumerationBackend backend );
+
+        /**
+         * Enumerates the interfaces, addresses, and details selected by the given options.
+         *
+         * @param options the enumeration options.
+         * @throws InterfaceBrowserSystemError if enumeration fails, including if Netlink is
+         *         requested on a platform that does not support it.
+         */
+        OddSource_Inline
+        explicit
+        InterfaceBrowser(
+            EnumerationOptions const & options );
+
+        /**
+         * Enumerates the interfaces again, with the options the previous browser was created with, sharing the
+         * previous browser's objects for interfaces that did not change. Unlike refresh, the previous browser is
+         * left untouched, so this is how to build the next snapshot while other threads still read the current
+         * one (see InterfaceSnapshots).
+         *
+         * @param previous the browser to compare to and share with.
+         * @param changes receives what changed since the previous browser, as described for refresh.
+         * @throws InterfaceBrowserSystemError if enumeration fails.
+         */
+        OddSource_Inline
+        InterfaceBrowser(
+            InterfaceBrowser const & previous,
+            ::std::vector< InterfaceEvent > & changes );
+
         InterfaceBrowser(
             InterfaceBrowser const & ) = delete;
 
@@ -83,12 +300,173 @@ namespace OddSource::Interfaces
         operator=(
             InterfaceBrowser const & ) = delete;
 
+        /**
+         * Fetches a single interface by name without enumerating the others. With the Netlink
+         * backend this is one RTM_GETLINK request and one RTM_GETADDR dump filtered by the
+         * kernel to that interface, so its cost does not depend on how many interfaces the
+         * host has. With the Portable backend, getifaddrs still lists every interface, but
+         * nothing is allocated or looked up for the others.
+         *
+         * @param name the interface name.
+         * @param options controls the backend and which details to collect; its name and
+         *        index filters are ignored.
+         * @return the interface, or nullptr if there is no interface with that name.
+         * @throws InterfaceBrowserSystemError if enumeration fails.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ::std::shared_ptr< Interface const >
+        lookup(
+            ::std::string_view name,
+            EnumerationOptions const & options = EnumerationOptions() );
+
+        /**
+         * Fetches a single interface by index without enumerating the others, with the same
+         * costs as lookup( name ).
+         *
+         * @param index the interface index.
+         * @param options controls the backend and which details to collect; its name and
+         *        index filters are ignored.
+         * @return the interface, or nullptr if there is no interface with that index.
+         * @throws InterfaceBrowserSystemError if enumeration fails.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ::std::shared_ptr< Interface const >
+        lookup(
+            ::std::uint32_t index,
+            EnumerationOptions const & options = EnumerationOptions() );
+
+        /**
+         * Returns a process-wide snapshot of all interfaces, with the default options, enumerating only if the
+         * cached snapshot is older than max_age. Callers that arrive while an enumeration is in progress wait
+         * for it and share its result instead of starting their own, so any number of concurrent callers
+         * cost one enumeration. Each new snapshot shares the objects of interfaces that did not change with
+         * the previous one.
+         *
+         * @param max_age how old a cached snapshot may be, measured from when its enumeration started.
+         * @return the snapshot.
+         * @throws InterfaceBrowserSystemError if enumeration fails; every caller that waited for that
+         *         enumeration receives the same error.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ::std::shared_ptr< InterfaceBrowser const >
+        shared(
+            ::std::chrono::milliseconds max_age );
+
+        /**
+         * Iterates over the interfaces of a browser as Interface references, in the order they were enumerated.
+         */
+        class const_iterator
+        {
+        public:
+            typedef ::std::bidirectional_iterator_tag iterator_category;
+            typedef Interface value_type;
+            typedef ::std::ptrdiff_t difference_type;
+            typedef Interface const * pointer;
+            typedef Interface const & reference;
+
+            const_iterator() = default;
+
+            reference
+            operator*() const;
+
+            pointer
+            operator->() const;
+
+            const_iterator &
+            operator++();
+
+            const_iterator
+            operator++(
+                int );
+
+            const_iterator &
+            operator--();
+
+            const_iterator
+            operator--(
+                int );
+
+            bool
+            operator==(
+                const_iterator const & other ) const;
+
+            bool
+            operator!=(
+                const_iterator const & other ) const;
+
+        private:
+            friend class InterfaceBrowser;
+
+            explicit
+            const_iterator(
+                ::std::list< ::std::shared_ptr< Interface const > >::const_iterator position );
+
+            ::std::list< ::std::shared_ptr< Interface const > >::const_iterator _position;
+        };
+
+        /**
+         * Returns an iterator to the first interface, so that a browser can be the range of a range-based for loop:
+         * <code>for ( Interface const & rInterface : browser )</code>.
+         */
+        [[nodiscard]]
+        const_iterator
+        begin() const;
+
+        [[nodiscard]]
+        const_iterator
+        end() const;
+
         [[nodiscard]]
         OddSource_Inline
         bool
         for_each_interface(
             ::std::function< bool( Interface const & ) > doThis ) const;
 
+        /**
+         * Calls a visitor with each interface, in the order they were enumerated, until it returns false. Unlike
+         * the std::function overload, the visitor is called directly, so that it can be inlined into the loop.
+         *
+         * @param doThis the visitor, callable as <code>bool( Interface const & )</code>.
+         * @return true if the visitor returned true for every interface.
+         */
+        template< typename Visitor >
+        [[nodiscard]]
+        bool
+        for_each_interface(
+            Visitor && doThis ) const;
+
+        /**
+         * Calls a visitor with each IPv4 address of each interface, in the order they were enumerated, until it
+         * returns false.
+         *
+         * @param doThis the visitor, callable as <code>bool( Interface const &, InterfaceIPv4Address const & )</code>.
+         * @return true if the visitor returned true for every address.
+         */
+        template< typename Visitor >
+        [[nodiscard]]
+        bool
+        for_each_ipv4_address(
+            Visitor && doThis ) const;
+
+        /**
+         * Calls a visitor with each IPv6 address of each interface, in the order they were enumerated, until it
+         * returns false.
+         *
+         * @param doThis the visitor, callable as <code>bool( Interface const &, InterfaceIPv6Address const & )</code>.
+         * @return true if the visitor returned true for every address.
+         */
+        template< typename Visitor >
+        [[nodiscard]]
+        bool
+        for_each_ipv6_address(
+            Visitor && doThis ) const;
+
         [[nodiscard]]
         OddSource_Inline
         ::std::list< ::std::shared_ptr< Interface const > > const &
@@ -123,14 +501,322 @@ namespace OddSource::Interfaces
         ::std::list< ::std::string > const &
         getWarnings() const;
 
+        /**
+         * Returns the backend that actually produced this browser's interfaces, which is
+         * never Automatic.
+         *
+         * @return the backend.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        EnumerationBackend
+        backend() const;
+
+        /**
+         * Returns a resolver that maps this browser's interface indexes and names to each other without
+         * asking the system. Install it with ScopeResolver::install so that IPv6 addresses parsed with a
+         * scope (such as fe80::1%eth0) resolve from this snapshot. The names are the ones SystemScopeResolver
+         * gives, which on Windows are not the adapter GUIDs that name() returns but are read from the system when
+         * the resolver is built. Names longer than IPv6Address::MAX_SCOPE_NAME_LENGTH are left out.
+         *
+         * @return the resolver, which copies the names and does not reference this browser.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::shared_ptr< TableScopeResolver >
+        scope_resolver() const;
+
+        /**
+         * Enumerates the interfaces again, with the options this browser was created with, and replaces this
+         * browser's contents with the result. Interfaces that did not change keep the same shared pointer, so
+         * caches keyed on those pointers stay valid. Pointers obtained before the refresh keep referring to the
+         * state they were obtained in.
+         *
+         * @return what changed, in the same form InterfaceMonitor reports it: LinkAdded, LinkRemoved, and
+         *         LinkChanged for interfaces that appeared, disappeared, or changed their names, flags, MTU, or
+         *         MAC address (with link set to the new interface, or the old one if it was removed), and
+         *         AddressAdded and AddressRemoved for each address that appeared or disappeared. An address whose
+         *         flags, prefix length, or broadcast or destination address changed is reported as removed and
+         *         then added.
+         * @throws InterfaceBrowserSystemError if enumeration fails, in which case this browser is unchanged.
+         */
+        OddSource_Inline
+        ::std::vector< InterfaceEvent >
+        refresh();
+
     private:
+        friend class InterfaceEnumeration;
+
+        struct SharedState;
+
+        OddSource_Inline
+        InterfaceBrowser(
+            EnumerationOptions const & options,
+            EnumerationBackend backend,
+            ::std::list< ::std::string > && warnings,
+            ::std::list< ::std::shared_ptr< Interface const > > && interfaces );
+
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        SharedState &
+        sharedState();
+
+        static
+        OddSource_Inline
+        EnumerationBackend
+        enumerate(
+            EnumerationOptions const & options,
+            ::std::list< ::std::string > & warnings,
+            ::std::list< ::std::shared_ptr< Interface const > > & interfaces );
+
+        OddSource_Inline
+        void
+        index();
+
+        struct IndexEntry
+        {
+            ::std::uint32_t index;
+            ::std::shared_ptr< Interface const > pInterface;
+        };
+
+        struct NameEntry
+        {
+            ::std::string_view name; // points into the interface
+            ::std::shared_ptr< Interface const > pInterface;
+        };
+
+        struct NameSlot
+        {
+            ::std::uint32_t tag; // the high bits of the name's hash, to skip most entries without reading them
+            ::std::uint32_t entry; // 1 + the position in _byName, or 0 if the slot is empty
+        };
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::shared_ptr< Interface const > const *
+        findIndex(
+            ::std::uint32_t index ) const;
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::shared_ptr< Interface const > const *
+        findName(
+            ::std::string_view const & name ) const;
+
+        OddSource_Inline
+        void
+        indexName(
+            ::std::string_view const & name,
+            ::std::shared_ptr< Interface const > const & pInterface );
+
+        OddSource_Inline
+        ::std::vector< InterfaceEvent >
+        share(
+            InterfaceBrowser const & previous );
+
+        EnumerationOptions _options;
         ::std::list< ::std::shared_ptr< Interface const > > _interfaces;
-        ::std::unordered_map< ::std::uint32_t, ::std::shared_ptr< Interface const > > _indexToInterface;
-        ::std::unordered_map< ::std::string, ::std::shared_ptr< Interface const > > _nameToInterface;
+        // sorted by index, with the first interface enumerated winning if two have the same index
+        ::std::vector< IndexEntry > _byIndex;
+        // _denseIndexes[ index ] is 1 + the position of index in _byIndex, or 0 if there is no such interface;
+        // it covers the low indexes, which is all of them unless they are much sparser than the interfaces
+        ::std::vector< ::std::uint32_t > _denseIndexes;
+        // every name (and on Windows, description) once, the first interface enumerated winning
+        ::std::vector< NameEntry > _byName;
+        // an open-addressed hash table over _byName, sized to a power of two at least four times the interfaces
+        ::std::vector< NameSlot > _nameSlots;
         ::std::list< ::std::string > _warnings;
+        EnumerationBackend _backend;
+    };
+
+    /**
+     * Receives notifications from the system when interfaces or their addresses change, so that
+     * callers don't have to poll by re-enumerating. On Linux, this subscribes to the
+     * RTNLGRP_LINK, RTNLGRP_IPV4_IFADDR, and RTNLGRP_IPV6_IFADDR netlink groups; each event
+     * costs one notification message, regardless of how many interfaces the host has. Not
+     * available on other platforms.
+     *
+     * Events are only delivered from within poll_events and wait_for_events, on the calling
+     * thread. A monitor is not safe to use from multiple threads at once.
+     */
+    class OddSource_Export InterfaceMonitor final
+    {
+    public:
+        /**
+         * Starts monitoring. Changes that happen after construction are queued by the system
+         * until read.
+         *
+         * @param options address_families selects which address events are reported, name and
+         *        index limit events to one interface, and the skip_* options limit the details
+         *        in events. The backend and up_only options are ignored.
+         * @throws InterfaceBrowserSystemError if monitoring cannot be started, including on
+         *         platforms that do not support it.
+         */
+        OddSource_Inline
+        explicit
+        InterfaceMonitor(
+            EnumerationOptions const & options = EnumerationOptions() );
+
+        InterfaceMonitor(
+            InterfaceMonitor const & ) = delete;
+
+        OddSource_Inline
+        ~InterfaceMonitor() noexcept;
+
+        InterfaceMonitor &
+        operator=(
+            InterfaceMonitor const & ) = delete;
+
+        /**
+         * Delivers every event that is already waiting, without blocking.
+         *
+         * @param handler invoked once for each event, in the order the system reported them.
+         * @return the number of events delivered.
+         * @throws InterfaceBrowserSystemError if reading notifications fails.
+         */
+        OddSource_Inline
+        size_t
+        poll_events(
+            ::std::function< void( InterfaceEvent && ) > const & handler );
+
+        /**
+         * Blocks until at least one notification arrives or the timeout elapses, then delivers
+         * every event that is waiting.
+         *
+         * @param handler invoked once for each event, in the order the system reported them.
+         * @param timeout how long to wait, or nullopt to wait indefinitely.
+         * @return the number of events delivered, which is 0 if the timeout elapsed (or if the
+         *         notifications that arrived were all filtered out by the options).
+         * @throws InterfaceBrowserSystemError if waiting for or reading notifications fails.
+         */
+        OddSource_Inline
+        size_t
+        wait_for_events(
+            ::std::function< void( InterfaceEvent && ) > const & handler,
+            ::std::optional< ::std::chrono::milliseconds > timeout = ::std::nullopt );
+
+        /**
+         * Returns the file descriptor that becomes readable when notifications are waiting,
+         * for use with poll, epoll, select, or an event loop. Call poll_events once it becomes
+         * readable. Do not read from it directly.
+         *
+         * @return the file descriptor.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        int
+        native_handle() const;
+
+        /**
+         * Returns the warnings produced by the most recent poll_events or wait_for_events.
+         *
+         * @return the warnings.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::list< ::std::string > const &
+        getWarnings() const;
+
+    private:
+        class Implementation;
+
+        ::std::unique_ptr< Implementation > _implementation;
+        ::std::list< ::std::string > _warnings;
+    };
+
+    /**
+     * An enumeration that never blocks, for event loops such as epoll or Boost.Asio. It starts on
+     * construction; the caller waits for native_handle() to become readable, calls on_readable(), and
+     * repeats until it returns true, then collects the browser from result(). With netlink, each
+     * on_readable() only reads what the kernel has already queued.
+     *
+     * Where non-blocking enumeration is not available (the Portable backend, an InterfaceProvider, or
+     * platforms without netlink), the constructor enumerates synchronously, native_handle() returns -1,
+     * and done() is immediately true.
+     */
+    class OddSource_Export InterfaceEnumeration final
+    {
+    public:
+        /**
+         * Starts enumerating.
+         *
+         * @param options the enumeration options, as for InterfaceBrowser.
+         * @throws InterfaceBrowserSystemError if the enumeration cannot be started, or if it runs
+         *         synchronously and fails.
+         */
+        OddSource_Inline
+        explicit
+        InterfaceEnumeration(
+            EnumerationOptions const & options = EnumerationOptions() );
+
+        InterfaceEnumeration(
+            InterfaceEnumeration const & ) = delete;
+
+        OddSource_Inline
+        ~InterfaceEnumeration() noexcept;
+
+        InterfaceEnumeration &
+        operator=(
+            InterfaceEnumeration const & ) = delete;
+
+        /**
+         * Returns the file descriptor to wait on for readability, or -1 if the enumeration is done or
+         * ran synchronously. Do not read from it directly.
+         *
+         * @return the file descriptor.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        int
+        native_handle() const;
+
+        /**
+         * Processes whatever replies are ready, without blocking. Errors are kept for result() to
+         * throw, not thrown from here.
+         *
+         * @return true if the enumeration is done (successfully or not).
+         */
+        OddSource_Inline
+        bool
+        on_readable();
+
+        /**
+         * @return true if the enumeration is done (successfully or not).
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        bool
+        done() const;
+
+        /**
+         * Returns the finished enumeration.
+         *
+         * @return the browser.
+         * @throws InterfaceBrowserSystemError if the enumeration failed.
+         * @throws std::logic_error if the enumeration is not done yet.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::shared_ptr< InterfaceBrowser const >
+        result() const;
+
+    private:
+        class Implementation;
+
+        /**
+         * Handles one finished reply: starts the next request, or builds the result.
+         */
+        OddSource_Inline
+        void
+        advance();
+
+        ::std::unique_ptr< Implementation > _implementation;
     };
 }
 
+#include "detail/Interfaces.hpp"
+
 #ifdef IFADDRS4CPP_INLINE_SOURCE
 #include "impl/Interfaces.ipp"
 #endif /* IFADDRS4CPP_INLINE_SOURCE */
@@ -20,6 +20,9 @@
 #define ODDSOURCE_NETWORK_INTERFACES_IPADDRESS_HPP
 
 #include "detail/config.h"
+#include "detail/lazy_string.hpp"
+#include "ParseResult.hpp"
+#include "ScopeResolver.hpp"
 // ReSharper disable once CppUnusedIncludeDirective
 #include "detail/winsock_includes.h"
 
@@ -28,6 +31,8 @@
 #endif /* !ODDSOURCE_IS_WINDOWS */
 
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -162,20 +167,21 @@ namespace OddSource::Interfaces
          */
         [[nodiscard]]
         virtual
-        OddSource_Inline
         explicit
-        operator ::std::string() const;
+        operator ::std::string() const = 0;
 
         /**
-         * Converts the IP address to a C string.
+         * Converts the IP address to a C string. The string is formatted the
+         * first time it is needed (safely, even if several threads ask at once)
+         * and stored inside this address object, and is valid for as long as
+         * the object is.
          *
          * @return a string.
          */
         [[nodiscard]]
         virtual
-        OddSource_Inline
         explicit
-        operator char const *() const;
+        operator char const *() const = 0;
 
 #ifdef ODDSOURCE_INCLUDE_BOOST
         [[nodiscard]]
@@ -278,9 +284,7 @@ namespace OddSource::Interfaces
 
     protected:
         OddSource_Inline
-        explicit
-        IPAddress(
-            ::std::string_view const & repr );
+        IPAddress();
 
         // copy constructor
         OddSource_Inline
@@ -292,21 +296,58 @@ namespace OddSource::Interfaces
         IPAddress(
             IPAddress && other ) noexcept;
 
+        // copy assignment operator
+        OddSource_Inline
+        IPAddress &
+        operator=(
+            IPAddress const & other );
+
+        // move assignment operator
+        OddSource_Inline
+        IPAddress &
+        operator=(
+            IPAddress && other ) noexcept;
+
         [[nodiscard]]
         virtual
         size_t
         data_length() const = 0;
 
-        ::std::string _representation;
-        bool _is_unspecified = false;
-        bool _is_loopback = false;
-        bool _is_link_local = false;
-        bool _is_private = false;
-        bool _is_multicast = false;
-        bool _is_reserved = false;
-        ::std::optional< MulticastScope > _multicast_scope;
+        /**
+         * Classifies this address, returning a bitmask of the classification
+         * bits defined in the implementation. Called at most once per address
+         * (or once per thread, if several threads ask at the same time), the
+         * first time one of the is_* methods needs it.
+         *
+         * @return the classification bitmask.
+         */
+        [[nodiscard]]
+        virtual
+        ::std::uint32_t
+        classify() const noexcept = 0;
+
+        /**
+         * Returns the classification bitmask, computing it with classify() if
+         * it has not been computed yet.
+         *
+         * @return the classification bitmask.
+         */
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::uint32_t
+        classification() const noexcept;
+
+    private:
+        mutable ::std::atomic< ::std::uint32_t > _classification;
     };
 
+    /**
+     * An IPv4 address. The address bytes and its string representation are
+     * stored inside the object, so constructing one from an in_addr or a
+     * std::uint32_t, copying it, and moving it never allocate. The string
+     * representation is not formatted until it is first used. On 64-bit
+     * platforms, an IPv4Address fits in 40 bytes (checked at compile time).
+     */
     class OddSource_Export IPv4Address : public IPAddress
     {
     public:
@@ -329,6 +370,32 @@ namespace OddSource::Interfaces
         IPv4Address(
             ::std::uint32_t data );
 
+        /**
+         * Parses an IPv4 address in any format the string constructor accepts without throwing or allocating.
+         *
+         * @param repr the string to parse.
+         * @return the address, or why the string is not one.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ParseResult< IPv4Address >
+        parse(
+            ::std::string_view const & repr ) noexcept;
+
+        /**
+         * Parses an IPv4 address like parse, without reporting why a string is not one.
+         *
+         * @param repr the string to parse.
+         * @return the address, or nullopt if the string is not one.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ::std::optional< IPv4Address >
+        try_parse(
+            ::std::string_view const & repr ) noexcept;
+
 #ifdef ODDSOURCE_INCLUDE_BOOST
         inline
         explicit
@@ -351,10 +418,32 @@ namespace OddSource::Interfaces
         IPv4Address(
             IPv4Address && ) noexcept;
 
+        // copy assignment operator
+        OddSource_Inline
+        IPv4Address &
+        operator=(
+            IPv4Address const & );
+
+        // move assignment operator
+        OddSource_Inline
+        IPv4Address &
+        operator=(
+            IPv4Address && ) noexcept;
+
         virtual
         OddSource_Inline
         ~IPv4Address() noexcept; // NOLINT(*-use-override)
 
+        [[nodiscard]]
+        OddSource_Inline
+        explicit
+        operator ::std::string() const final;
+
+        [[nodiscard]]
+        OddSource_Inline
+        explicit
+        operator char const *() const final;
+
         [[nodiscard]]
         OddSource_Inline
         explicit
@@ -406,26 +495,72 @@ namespace OddSource::Interfaces
         size_t
         data_length() const final;
 
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::uint32_t
+        classify() const noexcept final;
+
     private:
         OddSource_Inline
         explicit
         IPv4Address(
-            ::std::unique_ptr< in_addr const > && );
+            in_addr const & data );
+
+        [[nodiscard]]
+        OddSource_Inline
+        char const *
+        representation() const;
 
-        ::std::unique_ptr< in_addr const > _data;
+        // declared first so that it packs into the end of IPAddress
+        detail::LazyString< INET_ADDRSTRLEN > _representation;
+        in_addr _data;
     };
 
+    static_assert( sizeof( void * ) != 8 || sizeof( IPv4Address ) <= 40,
+                   "IPv4Address has outgrown its 40-byte budget." );
+
     struct OddSource_Export v6Scope
     {
         ::std::optional< ::std::uint32_t > scope_id = ::std::nullopt;
         ::std::optional< ::std::string > scope_name = ::std::nullopt;
     };
 
+    /**
+     * An IPv6 address, with or without a scope. The address bytes and its
+     * string representation, including the scope, are stored inside the
+     * object, so constructing one from an in6_addr or Bytes, copying it, and
+     * moving it never allocate. The string representation is not formatted
+     * until it is first used, unless the address was constructed from a
+     * string, in which case that string is kept. (Scope names of up to
+     * MAX_SCOPE_NAME_LENGTH characters fit in std::string's small buffer with
+     * the common standard libraries and in the inline representation. A
+     * longer name is accepted, but it and the representation are then stored
+     * on the heap, so constructing and copying such an address allocate.) On
+     * 64-bit platforms, an IPv6Address fits in 160 bytes (checked at compile
+     * time), 56 of which are the optional scope.
+     *
+     * An address constructed with only a scope ID or only a scope name gets
+     * the other half from the installed ScopeResolver, which by default asks
+     * the system each time.
+     */
     class OddSource_Export IPv6Address : public IPAddress
     {
     public:
         using Bytes = ::std::array< ::std::uint8_t, 16 >;
 
+        /**
+         * The longest scope name, in characters, that an address stores inline.
+         * This matches IF_NAMESIZE (less the null terminator) on Linux and macOS.
+         */
+        static constexpr size_t const MAX_SCOPE_NAME_LENGTH{ 15 };
+
+        /**
+         * The longest string representation, in characters, that an address
+         * stores inline: a 45-character address (with an embedded IPv4 address),
+         * a %, and a scope name of up to MAX_SCOPE_NAME_LENGTH characters.
+         */
+        static constexpr size_t const MAX_REPRESENTATION_LENGTH{ 45 + 1 + MAX_SCOPE_NAME_LENGTH };
+
         IPv6Address() = delete;
 
         // conversion constructor
@@ -475,6 +610,34 @@ namespace OddSource::Interfaces
             Bytes const & data,
             v6Scope const & scope );
 
+        /**
+         * Parses an IPv6 address, with or without a scope, without throwing or allocating. Like the string
+         * constructor, it asks the installed ScopeResolver for the half of the scope the string does not have; if
+         * the resolver throws, that half is left unknown.
+         *
+         * @param repr the string to parse.
+         * @return the address, or why the string is not one.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ParseResult< IPv6Address >
+        parse(
+            ::std::string_view const & repr ) noexcept;
+
+        /**
+         * Parses an IPv6 address like parse, without reporting why a string is not one.
+         *
+         * @param repr the string to parse.
+         * @return the address, or nullopt if the string is not one.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ::std::optional< IPv6Address >
+        try_parse(
+            ::std::string_view const & repr ) noexcept;
+
 #ifdef ODDSOURCE_INCLUDE_BOOST
         inline
         explicit
@@ -497,10 +660,32 @@ namespace OddSource::Interfaces
         IPv6Address(
             IPv6Address && other ) noexcept;
 
+        // copy assignment operator
+        OddSource_Inline
+        IPv6Address &
+        operator=(
+            IPv6Address const & other );
+
+        // move assignment operator
+        OddSource_Inline
+        IPv6Address &
+        operator=(
+            IPv6Address && other ) noexcept;
+
         virtual
         OddSource_Inline
         ~IPv6Address() noexcept; // NOLINT(*-use-override)
 
+        [[nodiscard]]
+        OddSource_Inline
+        explicit
+        operator ::std::string() const final;
+
+        [[nodiscard]]
+        OddSource_Inline
+        explicit
+        operator char const *() const final;
+
         [[nodiscard]]
         OddSource_Inline
         explicit
@@ -672,6 +857,11 @@ namespace OddSource::Interfaces
         size_t
         data_length() const final;
 
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::uint32_t
+        classify() const noexcept final;
+
     private:
         OddSource_Inline
         IPv6Address(
@@ -680,27 +870,31 @@ namespace OddSource::Interfaces
 
         OddSource_Inline
         IPv6Address(
-            ::std::unique_ptr< in6_addr const > && data,
+            in6_addr const & data,
             ::std::optional< v6Scope > && scope );
 
         OddSource_Inline
         IPv6Address(
-            ::std::string && reprWithoutScope,
-            ::std::unique_ptr< in6_addr const > && data,
+            ::std::string_view const & reprWithoutScope,
+            in6_addr const & data,
             ::std::optional< v6Scope > && scope );
 
-        ::std::unique_ptr< in6_addr const > _data;
-        ::std::optional< v6Scope > const _scope;
-        ::std::string const _without_scope;
-        bool _is_unique_local = false;
-        bool _is_site_local = false;
-        bool _is_v4_mapped = false;
-        bool _is_v4_compatible = false;
-        bool _is_v4_translated = false;
-        bool _is_6to4 = false;
-        ::std::optional< ::std::uint8_t > _multicast_flags;
+        [[nodiscard]]
+        OddSource_Inline
+        char const *
+        representation() const;
+
+        in6_addr _data;
+        ::std::optional< v6Scope > _scope;
+        detail::LazyString< MAX_REPRESENTATION_LENGTH + 1 > _representation;
+
+        // the whole representation, formatted on construction, when the scope name is too long for _representation
+        ::std::unique_ptr< char[] > _longRepresentation;
     };
 
+    static_assert( sizeof( void * ) != 8 || sizeof( IPv6Address ) <= 160,
+                   "IPv6Address has outgrown its 160-byte budget." );
+
     OddSource_Export
     ::std::string
     toString(
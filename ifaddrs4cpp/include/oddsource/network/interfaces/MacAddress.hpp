@@ -20,9 +20,15 @@
 #define ODDSOURCE_NETWORK_INTERFACES_MACADDRESS_HPP
 
 #include "detail/config.h"
+#include "detail/lazy_string.hpp"
+#include "ParseResult.hpp"
 
-#include <memory>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <ostream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 
@@ -53,6 +59,18 @@ namespace OddSource::Interfaces
         ~InvalidMacAddress() noexcept; // NOLINT(*-use-override)
     };
 
+    /**
+     * A MAC (hardware) address of MIN_ADAPTER_ADDRESS_LENGTH to MAX_ADAPTER_ADDRESS_LENGTH
+     * bytes. The bytes and the string representation are stored inside the object, so
+     * constructing one from binary data, copying it, and moving it never allocate. The string
+     * representation is not formatted until it is first used, unless the address was
+     * constructed from a string, in which case that string is kept. On 64-bit platforms, a
+     * MacAddress fits in 48 bytes (checked at compile time).
+     *
+     * Strings may be pairs of hex digits separated by : or - (a4:83:e7:2e:a1:67), groups of
+     * four hex digits separated by . as Cisco devices print them (a483.e72e.a167), or bare
+     * hex digits (a483e72ea167), in either case.
+     */
     class OddSource_Export MacAddress
     {
     public:
@@ -68,6 +86,56 @@ namespace OddSource::Interfaces
             ::std::uint8_t const data[ MAX_ADAPTER_ADDRESS_LENGTH ],
             ::std::uint8_t dataLength );
 
+        /**
+         * Parses a MAC address in any format the string constructor accepts without throwing or allocating.
+         *
+         * @param repr the string to parse.
+         * @return the address, or why the string is not one.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ParseResult< MacAddress >
+        parse(
+            ::std::string_view const & repr ) noexcept;
+
+        /**
+         * Parses a MAC address like parse, without reporting why a string is not one.
+         *
+         * @param repr the string to parse.
+         * @return the address, or nullopt if the string is not one.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ::std::optional< MacAddress >
+        try_parse(
+            ::std::string_view const & repr ) noexcept;
+
+        /**
+         * Parses many MAC addresses, in any format parse accepts, into arrays the caller provides, without
+         * constructing a MacAddress for each, throwing, or allocating.
+         *
+         * @param reprs the strings to parse.
+         * @param count the number of strings.
+         * @param data count * MAX_ADAPTER_ADDRESS_LENGTH bytes, which receive the bytes of the address in reprs[i]
+         *             at i * MAX_ADAPTER_ADDRESS_LENGTH, padded with zeros, so that they can be passed to the
+         *             binary constructor; all zeros if reprs[i] is not an address.
+         * @param lengths count lengths, which receive the length of each address, or 0 if its string is not one.
+         * @param errors count errors, which receive why each string is not an address (or ParseError::None), or
+         *               null if the caller does not need to know.
+         * @return the number of strings that were addresses.
+         */
+        static
+        OddSource_Inline
+        ::std::size_t
+        parse_all(
+            ::std::string_view const * reprs,
+            ::std::size_t count,
+            ::std::uint8_t * data,
+            ::std::uint8_t * lengths,
+            ParseError * errors = nullptr ) noexcept;
+
         OddSource_Inline
         MacAddress(
             MacAddress const & other );
@@ -113,17 +181,28 @@ namespace OddSource::Interfaces
             MacAddress const & rhs ) const;
 
     private:
+        using Bytes = ::std::array< ::std::uint8_t, MAX_ADAPTER_ADDRESS_LENGTH >;
+
         OddSource_Inline
         MacAddress(
-            ::std::string && repr,
-            ::std::unique_ptr< ::std::uint8_t const[] > && data,
+            ::std::string_view const & repr,
+            Bytes const & data,
             ::std::uint8_t dataLength );
 
-        ::std::string const _representation;
-        ::std::unique_ptr< ::std::uint8_t const[] > _data;
+        [[nodiscard]]
+        OddSource_Inline
+        char const *
+        representation() const;
+
+        // formatted the first time it is needed, unless the address was constructed from a string
+        detail::LazyString< MAX_ADAPTER_ADDRESS_LENGTH * 3 > _representation;
+        Bytes _data;
         ::std::uint8_t const _data_length;
     };
 
+    static_assert( sizeof( void * ) != 8 || sizeof( MacAddress ) <= 48,
+                   "MacAddress has outgrown its 48-byte budget." );
+
     OddSource_Export
     ::std::string
     toString(
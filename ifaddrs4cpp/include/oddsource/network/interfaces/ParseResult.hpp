@@ -0,0 +1,93 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_PARSE_RESULT_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_PARSE_RESULT_HPP
+
+#include "detail/config.h"
+
+#include <cstdint>
+#include <optional>
+
+namespace OddSource::Interfaces
+{
+    /**
+     * Why the parse functions of IPv4Address, IPv6Address, and MacAddress, or an AddressList, rejected a string.
+     */
+    enum class OddSource_Export ParseError : ::std::uint8_t
+    {
+        /**
+         * The string was parsed.
+         */
+        None = 0,
+
+        /**
+         * The string was empty.
+         */
+        Empty,
+
+        /**
+         * The string was longer than any valid address of its kind.
+         */
+        TooLong,
+
+        /**
+         * The string was not an address of its kind.
+         */
+        Malformed,
+
+        /**
+         * The scope of an IPv6 address was 0, an ID too large for 32 bits, or a name longer than
+         * IPv6Address::MAX_SCOPE_NAME_LENGTH that could not be allocated.
+         */
+        InvalidScope,
+
+        /**
+         * A MAC address had fewer than MIN_ADAPTER_ADDRESS_LENGTH or more than MAX_ADAPTER_ADDRESS_LENGTH bytes.
+         */
+        InvalidLength,
+
+        /**
+         * The prefix length after the / of an AddressList entry was missing, not a number, or longer than the
+         * address.
+         */
+        InvalidPrefixLength,
+    };
+
+    /**
+     * The result of parsing an address without throwing: the address if the string was valid, and otherwise why
+     * it was not.
+     */
+    template< class AddressT >
+    struct ParseResult
+    {
+        ::std::optional< AddressT > address;
+        ParseError error;
+
+        [[nodiscard]]
+        explicit
+        operator bool() const noexcept
+        {
+            return this->address.has_value();
+        }
+    };
+}
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_PARSE_RESULT_HPP */
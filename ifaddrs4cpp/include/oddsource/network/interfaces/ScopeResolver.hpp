@@ -0,0 +1,257 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_SCOPE_RESOLVER_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_SCOPE_RESOLVER_HPP
+
+#include "detail/config.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OddSource::Interfaces
+{
+    /**
+     * Resolves IPv6 scope IDs (interface indexes) to scope names (interface names) and back. When an IPv6Address
+     * is constructed with only a scope ID or only a scope name (including when it is parsed from a string such as
+     * fe80::1%eth0), it asks the installed resolver for the other half.
+     *
+     * The resolver installed by default is the SystemScopeResolver, which makes one if_indextoname or
+     * if_nametoindex call for each such address. To construct addresses in bulk without those calls, install a
+     * CachingScopeResolver, which asks the system once per scope and remembers the answer, or the TableScopeResolver
+     * from InterfaceBrowser::scope_resolver(), which answers from that snapshot's interfaces only. InterfaceBrowser
+     * refreshes and InterfaceMonitor events that report link changes invalidate the installed resolver's entries for
+     * those links.
+     */
+    class OddSource_Export ScopeResolver
+    {
+    public:
+        OddSource_Inline
+        virtual
+        ~ScopeResolver() noexcept;
+
+        /**
+         * Resolves a scope ID to a scope name.
+         *
+         * @param scopeId the scope ID (interface index).
+         * @return the scope name, or nullopt if no interface has that index.
+         */
+        [[nodiscard]]
+        virtual
+        ::std::optional< ::std::string >
+        scope_name(
+            ::std::uint32_t scopeId ) const = 0;
+
+        /**
+         * Resolves a scope name to a scope ID.
+         *
+         * @param scopeName the scope name (interface name).
+         * @return the scope ID, or nullopt if no interface has that name.
+         */
+        [[nodiscard]]
+        virtual
+        ::std::optional< ::std::uint32_t >
+        scope_id(
+            ::std::string_view scopeName ) const = 0;
+
+        /**
+         * Forgets anything remembered about the given link, because it was added, removed, renamed, or
+         * reported as changed. The default implementation does nothing.
+         *
+         * @param scopeId the index of the link that changed.
+         * @param scopeName the name of the link that changed, which may be empty if unknown.
+         */
+        OddSource_Inline
+        virtual
+        void
+        invalidate(
+            ::std::uint32_t scopeId,
+            ::std::string_view scopeName ) noexcept;
+
+        /**
+         * Forgets everything remembered, because link changes may have been missed. The default implementation
+         * does nothing.
+         */
+        OddSource_Inline
+        virtual
+        void
+        invalidate() noexcept;
+
+        /**
+         * Returns the resolver that IPv6Address constructors use on the calling thread. After the first call on
+         * a thread, this costs one atomic load unless a resolver was installed since the previous call.
+         *
+         * @return the installed resolver, which stays valid until the next call to installed() on this thread.
+         */
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        ScopeResolver &
+        installed();
+
+        /**
+         * Installs the resolver that IPv6Address constructors use on all threads. Each thread keeps the previous
+         * resolver alive until its next call to installed().
+         *
+         * @param resolver the new resolver, or nullptr to restore the default SystemScopeResolver.
+         * @return the resolver that was installed before.
+         */
+        static
+        OddSource_Inline
+        ::std::shared_ptr< ScopeResolver >
+        install(
+            ::std::shared_ptr< ScopeResolver > resolver );
+
+    protected:
+        ScopeResolver() = default;
+
+    private:
+        struct Installation
+        {
+            ::std::atomic< ::std::uint64_t > version { 1 };
+            ::std::mutex mutex;
+            ::std::shared_ptr< ScopeResolver > resolver;
+        };
+
+        [[nodiscard]]
+        static
+        OddSource_Inline
+        Installation &
+        installation();
+    };
+
+    /**
+     * Asks the system (if_indextoname and if_nametoindex) on every call.
+     */
+    class OddSource_Export SystemScopeResolver final : public ScopeResolver
+    {
+    public:
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::optional< ::std::string >
+        scope_name(
+            ::std::uint32_t scopeId ) const final;
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::optional< ::std::uint32_t >
+        scope_id(
+            ::std::string_view scopeName ) const final;
+    };
+
+    /**
+     * Remembers every scope that another resolver (the system, by default) resolved, so that each scope costs one
+     * lookup for the life of the process, or until a link change invalidates it. Scopes that did not resolve are
+     * not remembered, so an interface that appears later is found. Safe to use from any number of threads; hits
+     * take a shared lock and do not allocate.
+     */
+    class OddSource_Export CachingScopeResolver final : public ScopeResolver
+    {
+    public:
+        /**
+         * @param source the resolver to ask on a miss, or nullptr for a SystemScopeResolver.
+         */
+        OddSource_Inline
+        explicit
+        CachingScopeResolver(
+            ::std::shared_ptr< ScopeResolver const > source = nullptr );
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::optional< ::std::string >
+        scope_name(
+            ::std::uint32_t scopeId ) const final;
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::optional< ::std::uint32_t >
+        scope_id(
+            ::std::string_view scopeName ) const final;
+
+        OddSource_Inline
+        void
+        invalidate(
+            ::std::uint32_t scopeId,
+            ::std::string_view scopeName ) noexcept final;
+
+        OddSource_Inline
+        void
+        invalidate() noexcept final;
+
+    private:
+        OddSource_Inline
+        void
+        remember(
+            ::std::uint32_t scopeId,
+            ::std::string const & scopeName ) const;
+
+        ::std::shared_ptr< ScopeResolver const > _source;
+        mutable ::std::shared_mutex _mutex;
+        mutable ::std::unordered_map< ::std::uint32_t, ::std::string > _idToName;
+        mutable ::std::unordered_map< ::std::string, ::std::uint32_t > _nameToId;
+    };
+
+    /**
+     * Resolves from a fixed table of interface indexes and names, such as a snapshot's, and never asks the system.
+     * Scopes that are not in the table do not resolve. Link changes do not alter the table; install a new one
+     * built from a newer snapshot instead.
+     */
+    class OddSource_Export TableScopeResolver final : public ScopeResolver
+    {
+    public:
+        /**
+         * @param scopes the scope IDs (interface indexes) and their names.
+         */
+        OddSource_Inline
+        explicit
+        TableScopeResolver(
+            ::std::vector< ::std::pair< ::std::uint32_t, ::std::string > > const & scopes );
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::optional< ::std::string >
+        scope_name(
+            ::std::uint32_t scopeId ) const final;
+
+        [[nodiscard]]
+        OddSource_Inline
+        ::std::optional< ::std::uint32_t >
+        scope_id(
+            ::std::string_view scopeName ) const final;
+
+    private:
+        ::std::unordered_map< ::std::uint32_t, ::std::string > _idToName;
+        ::std::unordered_map< ::std::string, ::std::uint32_t > _nameToId;
+    };
+}
+
+#ifdef IFADDRS4CPP_INLINE_SOURCE
+#include "impl/ScopeResolver.ipp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_SCOPE_RESOLVER_HPP */
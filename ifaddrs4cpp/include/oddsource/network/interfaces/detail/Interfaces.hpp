@@ -0,0 +1,174 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#pragma once
+
+namespace OddSource::Interfaces
+{
+    inline
+    InterfaceBrowser::const_iterator::
+    const_iterator(
+        ::std::list< ::std::shared_ptr< Interface const > >::const_iterator position )
+        : _position( position )
+    {
+    }
+
+    inline
+    InterfaceBrowser::const_iterator::reference
+    InterfaceBrowser::const_iterator::
+    operator*() const
+    {
+        return **this->_position;
+    }
+
+    inline
+    InterfaceBrowser::const_iterator::pointer
+    InterfaceBrowser::const_iterator::
+    operator->() const
+    {
+        return this->_position->get();
+    }
+
+    inline
+    InterfaceBrowser::const_iterator &
+    InterfaceBrowser::const_iterator::
+    operator++()
+    {
+        ++this->_position;
+        return *this;
+    }
+
+    inline
+    InterfaceBrowser::const_iterator
+    InterfaceBrowser::const_iterator::
+    operator++(
+        int )
+    {
+        const_iterator const previous( *this );
+        ++this->_position;
+        return previous;
+    }
+
+    inline
+    InterfaceBrowser::const_iterator &
+    InterfaceBrowser::const_iterator::
+    operator--()
+    {
+        --this->_position;
+        return *this;
+    }
+
+    inline
+    InterfaceBrowser::const_iterator
+    InterfaceBrowser::const_iterator::
+    operator--(
+        int )
+    {
+        const_iterator const previous( *this );
+        --this->_position;
+        return previous;
+    }
+
+    inline
+    bool
+    InterfaceBrowser::const_iterator::
+    operator==(
+        const_iterator const & other ) const
+    {
+        return this->_position == other._position;
+    }
+
+    inline
+    bool
+    InterfaceBrowser::const_iterator::
+    operator!=(
+        const_iterator const & other ) const
+    {
+        return this->_position != other._position;
+    }
+
+    inline
+    InterfaceBrowser::const_iterator
+    InterfaceBrowser::
+    begin() const
+    {
+        return const_iterator( this->_interfaces.begin() );
+    }
+
+    inline
+    InterfaceBrowser::const_iterator
+    InterfaceBrowser::
+    end() const
+    {
+        return const_iterator( this->_interfaces.end() );
+    }
+
+    template< typename Visitor >
+    bool
+    InterfaceBrowser::
+    for_each_interface(
+        Visitor && doThis ) const
+    {
+        for ( auto const & pInterface : this->_interfaces )
+        {
+            if ( !doThis( *pInterface ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template< typename Visitor >
+    bool
+    InterfaceBrowser::
+    for_each_ipv4_address(
+        Visitor && doThis ) const
+    {
+        for ( auto const & pInterface : this->_interfaces )
+        {
+            for ( auto const & address : pInterface->_ipv4Addresses )
+            {
+                if ( !doThis( *pInterface, address ) )
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template< typename Visitor >
+    bool
+    InterfaceBrowser::
+    for_each_ipv6_address(
+        Visitor && doThis ) const
+    {
+        for ( auto const & pInterface : this->_interfaces )
+        {
+            for ( auto const & address : pInterface->_ipv6Addresses )
+            {
+                if ( !doThis( *pInterface, address ) )
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
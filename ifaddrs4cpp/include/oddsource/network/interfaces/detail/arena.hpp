@@ -0,0 +1,328 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace OddSource::Interfaces::detail
+{
+    /**
+     * A monotonic arena, which hands out memory from a few large blocks, never reuses what it has handed out, and
+     * frees all of it at once when it is destroyed. An enumeration allocates its whole snapshot from one arena, so
+     * that a snapshot costs a handful of allocations instead of several per interface and is freed in one step.
+     * It is not thread-safe, but only the enumeration that owns it allocates from it, from one thread, and freeing
+     * memory in it does nothing, so objects in it can be destroyed from any thread.
+     */
+    class Arena
+    {
+    public:
+        static constexpr ::std::size_t const FIRST_BLOCK_SIZE{ 4096 };
+        static constexpr ::std::size_t const MAXIMUM_BLOCK_SIZE{ 256 * 1024 };
+
+        Arena() noexcept
+            : _blocks(),
+              _next( nullptr ),
+              _remaining( 0 ),
+              _nextBlockSize( FIRST_BLOCK_SIZE )
+        {
+        }
+
+        Arena(
+            Arena const & ) = delete;
+
+        Arena &
+        operator=(
+            Arena const & ) = delete;
+
+        ~Arena() noexcept = default;
+
+        [[nodiscard]]
+        void *
+        allocate(
+            ::std::size_t size,
+            ::std::size_t alignment )
+        {
+            if ( void * pMemory = ::std::align( alignment, size, this->_next, this->_remaining ) )
+            {
+                this->_next = static_cast< ::std::byte * >( pMemory ) + size;
+                this->_remaining -= size;
+                return pMemory;
+            }
+
+            ::std::size_t const needed( size + alignment );
+            if ( needed > this->_nextBlockSize / 4 )
+            {
+                // a large request gets a block of its own, so that the rest of the current block is not abandoned
+                void * pMemory( this->newBlock( needed ) );
+                ::std::size_t space( needed );
+                return ::std::align( alignment, size, pMemory, space );
+            }
+
+            this->_next = this->newBlock( this->_nextBlockSize );
+            this->_remaining = this->_nextBlockSize;
+            this->_nextBlockSize = ::std::min( this->_nextBlockSize * 2, MAXIMUM_BLOCK_SIZE );
+            return this->allocate( size, alignment );
+        }
+
+    private:
+        void *
+        newBlock(
+            ::std::size_t size )
+        {
+            return this->_blocks.emplace_back( new ::std::byte[ size ] ).get();
+        }
+
+        ::std::vector< ::std::unique_ptr< ::std::byte[] > > _blocks;
+        void * _next;
+        ::std::size_t _remaining;
+        ::std::size_t _nextBlockSize;
+    };
+
+    /**
+     * The allocator of the strings inside a snapshot's objects. It allocates from an arena when it has one and from
+     * the heap otherwise, and it does not keep the arena alive: the object that contains the strings lives in the
+     * arena itself, allocated with SharedArenaAllocator, which does. Copies of those strings are made on the heap,
+     * so that they can outlive the arena.
+     */
+    template< class T >
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = ::std::false_type;
+        using propagate_on_container_move_assignment = ::std::false_type;
+        using propagate_on_container_swap = ::std::false_type;
+        using is_always_equal = ::std::false_type;
+
+        ArenaAllocator() noexcept
+            : _arena( nullptr )
+        {
+        }
+
+        explicit
+        ArenaAllocator(
+            Arena * arena ) noexcept
+            : _arena( arena )
+        {
+        }
+
+        template< class U >
+        ArenaAllocator( // NOLINT(*-explicit-constructor)
+            ArenaAllocator< U > const & other ) noexcept
+            : _arena( other.arena() )
+        {
+        }
+
+        [[nodiscard]]
+        T *
+        allocate(
+            ::std::size_t count )
+        {
+            if ( this->_arena == nullptr )
+            {
+                return ::std::allocator< T >().allocate( count );
+            }
+            if ( count > SIZE_MAX / sizeof( T ) )
+            {
+                throw ::std::bad_array_new_length();
+            }
+            return static_cast< T * >( this->_arena->allocate( count * sizeof( T ), alignof( T ) ) );
+        }
+
+        void
+        deallocate(
+            T * pMemory,
+            ::std::size_t count ) noexcept
+        {
+            if ( this->_arena == nullptr )
+            {
+                ::std::allocator< T >().deallocate( pMemory, count );
+            }
+            // memory in an arena is freed only with the arena
+        }
+
+        [[nodiscard]]
+        ArenaAllocator
+        select_on_container_copy_construction() const noexcept
+        {
+            return ArenaAllocator();
+        }
+
+        [[nodiscard]]
+        Arena *
+        arena() const noexcept
+        {
+            return this->_arena;
+        }
+
+        template< class U >
+        [[nodiscard]]
+        bool
+        operator==(
+            ArenaAllocator< U > const & other ) const noexcept
+        {
+            return this->_arena == other.arena();
+        }
+
+        template< class U >
+        [[nodiscard]]
+        bool
+        operator!=(
+            ArenaAllocator< U > const & other ) const noexcept
+        {
+            return this->_arena != other.arena();
+        }
+
+    private:
+        Arena * _arena;
+    };
+
+    /**
+     * The allocator of a snapshot's objects themselves, for use with ::std::allocate_shared. Every object's control
+     * block holds a copy, so the arena is freed when the last object allocated from it is released.
+     */
+    template< class T >
+    class SharedArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        explicit
+        SharedArenaAllocator(
+            ::std::shared_ptr< Arena > arena ) noexcept
+            : _arena( ::std::move( arena ) )
+        {
+        }
+
+        template< class U >
+        SharedArenaAllocator( // NOLINT(*-explicit-constructor)
+            SharedArenaAllocator< U > const & other ) noexcept
+            : _arena( other.arena() )
+        {
+        }
+
+        [[nodiscard]]
+        T *
+        allocate(
+            ::std::size_t count )
+        {
+            if ( count > SIZE_MAX / sizeof( T ) )
+            {
+                throw ::std::bad_array_new_length();
+            }
+            return static_cast< T * >( this->_arena->allocate( count * sizeof( T ), alignof( T ) ) );
+        }
+
+        void
+        deallocate(
+            T *,
+            ::std::size_t ) noexcept
+        {
+        }
+
+        [[nodiscard]]
+        ::std::shared_ptr< Arena > const &
+        arena() const noexcept
+        {
+            return this->_arena;
+        }
+
+        template< class U >
+        [[nodiscard]]
+        bool
+        operator==(
+            SharedArenaAllocator< U > const & other ) const noexcept
+        {
+            return this->_arena == other.arena();
+        }
+
+        template< class U >
+        [[nodiscard]]
+        bool
+        operator!=(
+            SharedArenaAllocator< U > const & other ) const noexcept
+        {
+            return this->_arena != other.arena();
+        }
+
+    private:
+        ::std::shared_ptr< Arena > _arena;
+    };
+
+    /**
+     * Makes the objects of one snapshot, either all from one new arena or each from the heap. The object type
+     * must take the arena to allocate its strings from, or nullptr for the heap, as its last constructor argument.
+     */
+    class SnapshotAllocator
+    {
+    public:
+        explicit
+        SnapshotAllocator(
+            bool arena )
+            : _arena( arena ? ::std::make_shared< Arena >() : nullptr )
+        {
+        }
+
+        SnapshotAllocator(
+            SnapshotAllocator const & ) = delete;
+
+        SnapshotAllocator &
+        operator=(
+            SnapshotAllocator const & ) = delete;
+
+        ~SnapshotAllocator() noexcept = default;
+
+        /**
+         * Starts a new snapshot. The objects of the previous one keep its arena alive for as long as they need it.
+         *
+         * @param arena whether the new snapshot's objects come from a new arena instead of the heap.
+         */
+        void
+        reset(
+            bool arena )
+        {
+            this->_arena = arena ? ::std::make_shared< Arena >() : nullptr;
+        }
+
+        template< class T, class... Args >
+        [[nodiscard]]
+        ::std::shared_ptr< T >
+        make_shared(
+            Args &&... args ) const
+        {
+            if ( !this->_arena )
+            {
+                return ::std::make_shared< T >( ::std::forward< Args >( args )..., nullptr );
+            }
+            return ::std::allocate_shared< T >(
+                SharedArenaAllocator< T >( this->_arena ),
+                ::std::forward< Args >( args )...,
+                this->_arena.get() );
+        }
+
+    private:
+        ::std::shared_ptr< Arena > _arena;
+    };
+}
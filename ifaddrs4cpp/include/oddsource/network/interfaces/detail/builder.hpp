@@ -0,0 +1,59 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#pragma once
+
+#include "../Interface.hpp"
+
+#include <utility>
+
+namespace OddSource::Interfaces::detail
+{
+    /**
+     * Stores the MAC address and IP addresses that enumeration discovers for an interface it has constructed.
+     * Each enumeration function takes its builder as a template parameter instead of a std::function per
+     * element, so that every MAC and address is stored with a direct call the compiler can inline.
+     */
+    class InterfaceBuilder final
+    {
+    public:
+        void
+        setMacAddress(
+            Interface & rInterface,
+            MacAddress && macAddress ) const
+        {
+            rInterface._macAddress.emplace( ::std::move( macAddress ) );
+        }
+
+        void
+        addIPv4Address(
+            Interface & rInterface,
+            InterfaceIPv4Address && address ) const
+        {
+            rInterface._ipv4Addresses.push_back( ::std::move( address ) );
+        }
+
+        void
+        addIPv6Address(
+            Interface & rInterface,
+            InterfaceIPv6Address && address ) const
+        {
+            rInterface._ipv6Addresses.push_back( ::std::move( address ) );
+        }
+    };
+}
@@ -33,6 +33,10 @@
 #define ODDSOURCE_HEADER_EXPAND(prefix, suffix) ODDSOURCE_HEADER_BRACKETS(prefix, suffix)
 #define ODDSOURCE_HEADER(prefix, suffix) ODDSOURCE_HEADER_EXPAND(prefix, suffix)
 
+#ifndef ODDSOURCE_MAX_TRIES
+#define ODDSOURCE_MAX_TRIES 5
+#endif /* ODDSOURCE_MAX_TRIES */
+
 #ifdef ODDSOURCE_INCLUDE_BOOST
 
 #  ifndef ODDSOURCE_BOOST_NAMESPACE_ROOT
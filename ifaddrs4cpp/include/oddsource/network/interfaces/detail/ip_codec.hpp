@@ -0,0 +1,524 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_DETAIL_IP_CODEC_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_DETAIL_IP_CODEC_HPP
+
+#include "config.h"
+
+#ifdef ODDSOURCE_IS_WINDOWS
+#include "winsock_includes.h"
+#else /* ODDSOURCE_IS_WINDOWS */
+#include <netinet/in.h>
+#endif /* ODDSOURCE_IS_WINDOWS */
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#ifndef ODDSOURCE_HAS_SSSE3
+#define ODDSOURCE_HAS_SSSE3 1
+#endif /* ODDSOURCE_HAS_SSSE3 */
+#include <immintrin.h>
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+/**
+ * Text codecs for IPv4 and IPv6 addresses that work directly on a string_view and a caller's buffer, so that
+ * parsing and formatting need neither a null-terminated copy nor a system call. They accept exactly what glibc's
+ * inet_aton (restricted to four parts) and inet_pton accept, and format exactly what glibc's inet_ntop formats,
+ * which for IPv6 is the RFC 5952 canonical form.
+ */
+namespace OddSource::Interfaces::detail
+{
+    // longer than any valid address string, with or without a scope; anything this long is rejected without being
+    // parsed
+    constexpr size_t const MAX_REPR_LENGTH{ 64 };
+
+    // the longest text formatIPv4 and formatIPv6 write, not including the terminating null
+    constexpr size_t const IPV4_TEXT_LENGTH{ 15 };
+    constexpr size_t const IPV6_TEXT_LENGTH{ 45 };
+
+    // the value of each hexadecimal digit character, and -1 for every other character
+    constexpr auto const HEX_DIGIT_VALUES( []
+    {
+        ::std::array< ::std::int8_t, 256 > values{};
+        for ( size_t c = 0; c < values.size(); ++c )
+        {
+            values[ c ] = -1;
+        }
+        for ( int digit = 0; digit < 16; ++digit )
+        {
+            values[ static_cast< unsigned char >( "0123456789abcdef"[ digit ] ) ] = static_cast< ::std::int8_t >( digit );
+            values[ static_cast< unsigned char >( "0123456789ABCDEF"[ digit ] ) ] = static_cast< ::std::int8_t >( digit );
+        }
+        return values;
+    }() );
+
+    inline
+    int
+    hexDigitValue(
+        char const c ) noexcept
+    {
+        return HEX_DIGIT_VALUES[ static_cast< unsigned char >( c ) ];
+    }
+
+    /**
+     * Parses one part of an IPv4 address the way inet_aton does: hexadecimal after 0x, octal after a leading 0,
+     * and decimal otherwise. Stops at the first character that is not a digit of the part's base.
+     */
+    inline
+    bool
+    parseIPv4Part(
+        ::std::string_view const & repr,
+        size_t & position,
+        ::std::uint8_t & part ) noexcept
+    {
+        auto const length( repr.length() );
+        if ( position >= length || repr[ position ] < '0' || repr[ position ] > '9' )
+        {
+            return false;
+        }
+
+        ::std::uint32_t value{ 0 };
+        if ( repr[ position ] == '0' )
+        {
+            ++position;
+            if ( position < length && ( repr[ position ] | 0x20 ) == 'x' )
+            {
+                // "0x" without a hexadecimal digit is a 0 followed by a stray x
+                if ( position + 1 >= length || hexDigitValue( repr[ position + 1 ] ) < 0 )
+                {
+                    return false;
+                }
+                int digit;
+                while ( ++position < length && ( digit = hexDigitValue( repr[ position ] ) ) >= 0 )
+                {
+                    if ( ( value = value * 16 + static_cast< ::std::uint32_t >( digit ) ) > 0xff )
+                    {
+                        return false;
+                    }
+                }
+            }
+            else
+            {
+                for ( ; position < length && repr[ position ] >= '0' && repr[ position ] <= '7'; ++position )
+                {
+                    if ( ( value = value * 8 + static_cast< ::std::uint32_t >( repr[ position ] - '0' ) ) > 0xff )
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for ( ; position < length && repr[ position ] >= '0' && repr[ position ] <= '9'; ++position )
+            {
+                if ( ( value = value * 10 + static_cast< ::std::uint32_t >( repr[ position ] - '0' ) ) > 0xff )
+                {
+                    return false;
+                }
+            }
+        }
+        part = static_cast< ::std::uint8_t >( value );
+        return true;
+    }
+
+    /**
+     * Parses an IPv4 address of exactly four parts, each in decimal, octal, or hexadecimal.
+     */
+    inline
+    bool
+    parseIPv4(
+        ::std::string_view const & repr,
+        in_addr & data ) noexcept
+    {
+        ::std::uint8_t bytes[ 4 ];
+        size_t position{ 0 };
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            if ( i > 0 )
+            {
+                if ( position >= repr.length() || repr[ position ] != '.' )
+                {
+                    return false;
+                }
+                ++position;
+            }
+            if ( !parseIPv4Part( repr, position, bytes[ i ] ) )
+            {
+                return false;
+            }
+        }
+        if ( position != repr.length() )
+        {
+            return false;
+        }
+        ::std::memcpy( &data, bytes, sizeof( bytes ) );
+        return true;
+    }
+
+    /**
+     * Parses the dotted-decimal IPv4 address that ends an IPv6 address, which (as with inet_pton) allows neither
+     * octal nor hexadecimal parts, nor leading zeros.
+     */
+    inline
+    bool
+    parseDottedDecimal(
+        ::std::string_view const & repr,
+        ::std::uint8_t * bytes ) noexcept
+    {
+        size_t parts{ 0 };
+        size_t position{ 0 };
+        while ( parts < 4 )
+        {
+            if ( parts > 0 )
+            {
+                if ( position >= repr.length() || repr[ position ] != '.' )
+                {
+                    return false;
+                }
+                ++position;
+            }
+            auto const start( position );
+            ::std::uint32_t value{ 0 };
+            for ( ; position < repr.length() && repr[ position ] >= '0' && repr[ position ] <= '9'; ++position )
+            {
+                if ( position > start && value == 0 )
+                {
+                    return false;
+                }
+                if ( ( value = value * 10 + static_cast< ::std::uint32_t >( repr[ position ] - '0' ) ) > 0xff )
+                {
+                    return false;
+                }
+            }
+            if ( position == start )
+            {
+                return false;
+            }
+            bytes[ parts++ ] = static_cast< ::std::uint8_t >( value );
+        }
+        return position == repr.length();
+    }
+
+    /**
+     * Parses an IPv6 address without a scope: up to eight groups of one to four hexadecimal digits, at most one
+     * "::" standing for one or more zero groups, and optionally a dotted-decimal IPv4 address in place of the last
+     * two groups.
+     */
+    inline
+    bool
+    parseIPv6(
+        ::std::string_view const & repr,
+        in6_addr & data ) noexcept
+    {
+        ::std::uint8_t bytes[ 16 ]{};
+        size_t filled{ 0 };
+        bool isCompressed{ false };
+        size_t compressed{ 0 };  // where "::" appeared, if it did
+
+        auto const length( repr.length() );
+        size_t position{ 0 };
+        if ( length == 0 )
+        {
+            return false;
+        }
+        if ( repr[ 0 ] == ':' )
+        {
+            if ( length < 2 || repr[ 1 ] != ':' )
+            {
+                return false;
+            }
+            ++position;
+        }
+
+        // each pass reads one group of digits, empty only where "::" is, and the separator after it
+        while ( position < length )
+        {
+            auto const groupStart( position );
+            ::std::uint32_t value{ 0 };
+            for ( int digit; position < length && ( digit = hexDigitValue( repr[ position ] ) ) >= 0; ++position )
+            {
+                if ( position - groupStart == 4 )
+                {
+                    return false;
+                }
+                value = ( value << 4 ) | static_cast< ::std::uint32_t >( digit );
+            }
+
+            if ( position < length && repr[ position ] == '.' )
+            {
+                if ( filled + 4 > 16 || !parseDottedDecimal( repr.substr( groupStart ), bytes + filled ) )
+                {
+                    return false;
+                }
+                filled += 4;
+                break;
+            }
+            if ( position == groupStart )
+            {
+                // an empty group is the second colon of "::"
+                if ( position == length )
+                {
+                    break;
+                }
+                if ( repr[ position ] != ':' || isCompressed )
+                {
+                    return false;
+                }
+                isCompressed = true;
+                compressed = filled;
+                ++position;
+                continue;
+            }
+            if ( filled + 2 > 16 )
+            {
+                return false;
+            }
+            bytes[ filled++ ] = static_cast< ::std::uint8_t >( value >> 8 );
+            bytes[ filled++ ] = static_cast< ::std::uint8_t >( value );
+            if ( position == length )
+            {
+                break;
+            }
+            // a group is followed by a colon and then, unless the address ends, another group
+            if ( repr[ position ] != ':' || ++position == length )
+            {
+                return false;
+            }
+        }
+        if ( isCompressed )
+        {
+            // "::" must stand for at least one zero group
+            if ( filled == 16 )
+            {
+                return false;
+            }
+            auto const tail( filled - compressed );
+            ::std::memmove( bytes + 16 - tail, bytes + compressed, tail );
+            ::std::memset( bytes + compressed, 0, 16 - tail - compressed );
+            filled = 16;
+        }
+        if ( filled != 16 )
+        {
+            return false;
+        }
+        ::std::memcpy( &data, bytes, sizeof( bytes ) );
+        return true;
+    }
+
+    inline
+    char *
+    formatDecimalByte(
+        ::std::uint8_t const byte,
+        char * out ) noexcept
+    {
+        if ( byte >= 100 )
+        {
+            *out++ = static_cast< char >( '0' + byte / 100 );
+        }
+        if ( byte >= 10 )
+        {
+            *out++ = static_cast< char >( '0' + byte / 10 % 10 );
+        }
+        *out++ = static_cast< char >( '0' + byte % 10 );
+        return out;
+    }
+
+    inline
+    char *
+    formatDottedDecimal(
+        ::std::uint8_t const * bytes,
+        char * out ) noexcept
+    {
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            if ( i > 0 )
+            {
+                *out++ = '.';
+            }
+            out = formatDecimalByte( bytes[ i ], out );
+        }
+        return out;
+    }
+
+    /**
+     * Formats an IPv4 address in dotted decimal into a buffer of at least IPV4_TEXT_LENGTH + 1 characters,
+     * null-terminated, and returns the length without the null.
+     */
+    inline
+    size_t
+    formatIPv4(
+        in_addr const & data,
+        char * buffer ) noexcept
+    {
+        ::std::uint8_t bytes[ 4 ];
+        ::std::memcpy( bytes, &data, sizeof( bytes ) );
+        auto const end( formatDottedDecimal( bytes, buffer ) );
+        *end = '\0';
+        return static_cast< size_t >( end - buffer );
+    }
+
+    constexpr char const HEX_DIGITS[]{ "0123456789abcdef" };
+
+    /**
+     * Expands 16 bytes into 32 lowercase hexadecimal digits in hex, most significant nibble first.
+     */
+    inline
+    void
+    hexDigits(
+        ::std::uint8_t const ( & bytes )[ 16 ],
+        char * hex ) noexcept
+    {
+        for ( size_t i = 0; i < 16; ++i )
+        {
+            hex[ i * 2 ] = HEX_DIGITS[ bytes[ i ] >> 4 ];
+            hex[ i * 2 + 1 ] = HEX_DIGITS[ bytes[ i ] & 0xf ];
+        }
+    }
+
+#ifdef ODDSOURCE_HAS_SSSE3
+    /**
+     * Does the same as hexDigits with one table shuffle for all 32 nibbles.
+     */
+    __attribute__(( target( "ssse3" ) ))
+    inline
+    void
+    hexDigitsSsse3(
+        ::std::uint8_t const ( & bytes )[ 16 ],
+        char * hex ) noexcept
+    {
+        auto const data( _mm_loadu_si128( reinterpret_cast< __m128i const * >( bytes ) ) );
+        auto const nibble( _mm_set1_epi8( 0x0f ) );
+        auto const table( _mm_loadu_si128( reinterpret_cast< __m128i const * >( HEX_DIGITS ) ) );
+        auto const high( _mm_shuffle_epi8( table, _mm_and_si128( _mm_srli_epi16( data, 4 ), nibble ) ) );
+        auto const low( _mm_shuffle_epi8( table, _mm_and_si128( data, nibble ) ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( hex ), _mm_unpacklo_epi8( high, low ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( hex + 16 ), _mm_unpackhi_epi8( high, low ) );
+    }
+
+    inline
+    bool
+    hasSsse3() noexcept
+    {
+        static bool const supported( []
+        {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports( "ssse3" ) != 0;
+        }() );
+        return supported;
+    }
+#endif /* ODDSOURCE_HAS_SSSE3 */
+
+    /**
+     * Formats an IPv6 address without a scope into a buffer of at least IPV6_TEXT_LENGTH + 1 characters,
+     * null-terminated, and returns the length without the null. Following RFC 5952, digits are lowercase,
+     * leading zeros are dropped, and the longest run of two or more zero groups (the first, if several are as
+     * long) becomes "::". As with inet_ntop, an IPv4-mapped (::ffff:0:0/96) or IPv4-compatible (::/96) address
+     * ends in dotted decimal.
+     */
+    inline
+    size_t
+    formatIPv6(
+        in6_addr const & data,
+        char * buffer ) noexcept
+    {
+        ::std::uint8_t bytes[ 16 ];
+        ::std::memcpy( bytes, &data, sizeof( bytes ) );
+
+        ::std::uint16_t words[ 8 ];
+        size_t bestStart{ 8 }, bestLength{ 0 };
+        for ( size_t i = 0, runStart = 8, runLength = 0; i < 8; ++i )
+        {
+            words[ i ] = static_cast< ::std::uint16_t >( ( bytes[ i * 2 ] << 8 ) | bytes[ i * 2 + 1 ] );
+            if ( words[ i ] != 0 )
+            {
+                runLength = 0;
+                continue;
+            }
+            if ( runLength++ == 0 )
+            {
+                runStart = i;
+            }
+            if ( runLength > bestLength )
+            {
+                bestStart = runStart;
+                bestLength = runLength;
+            }
+        }
+        if ( bestLength < 2 )
+        {
+            bestStart = 8;
+            bestLength = 0;
+        }
+
+        // three digits of padding, so that each group can be copied as four characters
+        char hex[ 32 + 3 ]{};
+#ifdef ODDSOURCE_HAS_SSSE3
+        if ( hasSsse3() )
+        {
+            hexDigitsSsse3( bytes, hex );
+        }
+        else
+#endif /* ODDSOURCE_HAS_SSSE3 */
+        {
+            hexDigits( bytes, hex );
+        }
+
+        auto out( buffer );
+        for ( size_t i = 0; i < 8; ++i )
+        {
+            if ( i >= bestStart && i < bestStart + bestLength )
+            {
+                if ( i == bestStart )
+                {
+                    *out++ = ':';
+                }
+                continue;
+            }
+            if ( i != 0 )
+            {
+                *out++ = ':';
+            }
+            if ( i == 6 && bestStart == 0 && ( bestLength == 6 || ( bestLength == 5 && words[ 5 ] == 0xffff ) ) )
+            {
+                out = formatDottedDecimal( bytes + 12, out );
+                break;
+            }
+            // copy four characters but keep only the significant digits; the rest are overwritten by whatever
+            // follows, and even after the last group they stay within the buffer
+            size_t const significant( 1u + ( words[ i ] > 0xf ) + ( words[ i ] > 0xff ) + ( words[ i ] > 0xfff ) );
+            ::std::memcpy( out, hex + i * 4 + 4 - significant, 4 );
+            out += significant;
+        }
+        if ( bestLength > 0 && bestStart + bestLength == 8 )
+        {
+            *out++ = ':';
+        }
+        *out = '\0';
+        return static_cast< size_t >( out - buffer );
+    }
+}
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_DETAIL_IP_CODEC_HPP */
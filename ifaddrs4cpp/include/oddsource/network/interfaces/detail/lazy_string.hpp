@@ -0,0 +1,133 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace OddSource::Interfaces::detail
+{
+    /**
+     * A fixed-capacity, null-terminated string that is formatted the first time it is read instead of when its
+     * owner is constructed, so that objects that are compared but never printed never pay for formatting. It is
+     * safe to read from many threads at once: the first reader formats the string, and readers that arrive while
+     * it is formatting wait for it to finish.
+     *
+     * @tparam N the capacity, including the null terminator.
+     */
+    template< ::std::size_t N >
+    class LazyString
+    {
+    public:
+        LazyString() noexcept
+            : _state( Unformatted )
+        {
+        }
+
+        // copy constructor, which copies the string only if it has already been formatted
+        LazyString(
+            LazyString const & other ) noexcept
+            : _state( Unformatted )
+        {
+            this->copy( other );
+        }
+
+        LazyString &
+        operator=(
+            LazyString const & other ) noexcept
+        {
+            if ( this != &other )
+            {
+                this->copy( other );
+            }
+            return *this;
+        }
+
+        ~LazyString() noexcept = default;
+
+        /**
+         * Returns the string, first calling format to fill it in if no reader has done so yet. If format throws,
+         * the string stays unformatted and the exception propagates to the reader that called it.
+         *
+         * @param format a callable taking a char (&)[N] that writes the null-terminated string into it.
+         * @return the string, which is valid for as long as this object is and is not modified.
+         */
+        template< class Format >
+        [[nodiscard]]
+        char const *
+        get(
+            Format const & format ) const
+        {
+            auto state( this->_state.load( ::std::memory_order_acquire ) );
+            while ( state != Formatted )
+            {
+                if ( state == Unformatted )
+                {
+                    if ( this->_state.compare_exchange_weak( state, Formatting, ::std::memory_order_acquire ) )
+                    {
+                        try
+                        {
+                            format( this->_chars );
+                        }
+                        catch ( ... )
+                        {
+                            this->_state.store( Unformatted, ::std::memory_order_release );
+                            throw;
+                        }
+                        this->_state.store( Formatted, ::std::memory_order_release );
+                        break;
+                    }
+                }
+                else
+                {
+                    ::std::this_thread::yield();
+                    state = this->_state.load( ::std::memory_order_acquire );
+                }
+            }
+            return this->_chars;
+        }
+
+    private:
+        enum : ::std::uint8_t
+        {
+            Unformatted,
+            Formatting,
+            Formatted,
+        };
+
+        void
+        copy(
+            LazyString const & other ) noexcept
+        {
+            if ( other._state.load( ::std::memory_order_acquire ) == Formatted )
+            {
+                ::std::memcpy( this->_chars, other._chars, ::std::strlen( other._chars ) + 1 );
+                this->_state.store( Formatted, ::std::memory_order_relaxed );
+            }
+            else
+            {
+                this->_state.store( Unformatted, ::std::memory_order_relaxed );
+            }
+        }
+
+        mutable ::std::atomic< ::std::uint8_t > _state;
+        mutable char _chars[ N ];
+    };
+}
@@ -0,0 +1,636 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_DETAIL_NETLINK_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_DETAIL_NETLINK_HPP
+
+#include "config.h"
+
+#if defined(ODDSOURCE_IS_LINUX) && __has_include(<linux/rtnetlink.h>)
+
+#ifndef ODDSOURCE_HAS_NETLINK
+#define ODDSOURCE_HAS_NETLINK 1
+#endif /* ODDSOURCE_HAS_NETLINK */
+
+#include "../Interfaces.hpp"
+#include "system_error.hpp"
+
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace OddSource::Interfaces::detail
+{
+    /**
+     * Returns the fixed-size family header (ifinfomsg, ifaddrmsg, etc.) that follows the
+     * netlink header of a message, or nullptr if the message is too short to contain one.
+     */
+    template< class Header >
+    Header const *
+    netlinkHeader(
+        nlmsghdr const & message )
+    {
+        if ( message.nlmsg_len < NLMSG_LENGTH( sizeof( Header ) ) )
+        {
+            return nullptr;
+        }
+        return reinterpret_cast< Header const * >( reinterpret_cast< char const * >( &message ) + NLMSG_HDRLEN );
+    }
+
+    /**
+     * Invokes visitor( type, data, length ) for every route attribute that follows the
+     * family header of a netlink message. Malformed trailing attributes are ignored.
+     */
+    template< class Header, class Visitor >
+    void
+    forEachNetlinkAttribute(
+        nlmsghdr const & message,
+        Visitor && visitor )
+    {
+        size_t const offset( NLMSG_HDRLEN + NLMSG_ALIGN( sizeof( Header ) ) );
+        if ( message.nlmsg_len < offset )
+        {
+            return;
+        }
+        auto cursor( reinterpret_cast< char const * >( &message ) + offset );
+        size_t remaining( message.nlmsg_len - offset );
+        while ( remaining >= sizeof( rtattr ) )
+        {
+            auto const attribute( reinterpret_cast< rtattr const * >( cursor ) );
+            if ( attribute->rta_len < sizeof( rtattr ) || attribute->rta_len > remaining )
+            {
+                return;
+            }
+            visitor(
+                attribute->rta_type,
+                static_cast< void const * >( cursor + RTA_LENGTH( 0 ) ),
+                static_cast< size_t >( attribute->rta_len - RTA_LENGTH( 0 ) ) );
+            size_t const step( RTA_ALIGN( attribute->rta_len ) );
+            if ( step >= remaining )
+            {
+                return;
+            }
+            cursor += step;
+            remaining -= step;
+        }
+    }
+
+    /**
+     * An RTM_GET* request: the netlink header, the family header, and room for a few small
+     * route attributes (an interface name, an extension mask), all in one fixed-size object
+     * so that building a request never allocates.
+     */
+    template< class Header >
+    class NetlinkRequest final
+    {
+    public:
+        static constexpr size_t const ATTRIBUTE_CAPACITY{ 64 };
+
+        NetlinkRequest(
+            ::std::uint16_t const type,
+            ::std::uint16_t const flags,
+            Header const & header )
+            : _request {}
+        {
+            this->_request.message.nlmsg_len = NLMSG_LENGTH( sizeof( Header ) );
+            this->_request.message.nlmsg_type = type;
+            this->_request.message.nlmsg_flags = NLM_F_REQUEST | flags;
+            this->_request.header = header;
+        }
+
+        /**
+         * Appends a route attribute to the request.
+         *
+         * @return false, leaving the request unchanged, if the attribute does not fit.
+         */
+        bool
+        addAttribute(
+            ::std::uint16_t const type,
+            void const * data,
+            size_t const length )
+        {
+            size_t const offset( NLMSG_ALIGN( this->_request.message.nlmsg_len ) );
+            if ( offset + RTA_SPACE( length ) > sizeof( this->_request ) )
+            {
+                return false;
+            }
+            auto const cursor( reinterpret_cast< char * >( &this->_request ) + offset );
+            rtattr attribute {};
+            attribute.rta_type = type;
+            attribute.rta_len = static_cast< unsigned short >( RTA_LENGTH( length ) );
+            ::std::memcpy( cursor, &attribute, sizeof( attribute ) );
+            ::std::memcpy( cursor + RTA_LENGTH( 0 ), data, length );
+            this->_request.message.nlmsg_len = static_cast< ::std::uint32_t >( offset + RTA_LENGTH( length ) );
+            return true;
+        }
+
+        nlmsghdr &
+        message()
+        {
+            return this->_request.message;
+        }
+
+    private:
+        struct
+        {
+            nlmsghdr message;
+            Header header;
+            char attributes[ ATTRIBUTE_CAPACITY ];
+        } _request;
+    };
+
+    /**
+     * The outcome of NetlinkSocket::receive and NetlinkSocket::receiveReply.
+     */
+    enum class NetlinkReceiveResult
+    {
+        /**
+         * A datagram was read and its messages were handled.
+         */
+        Received,
+        /**
+         * Nothing was waiting to be read.
+         */
+        WouldBlock,
+        /**
+         * The kernel dropped notifications because the socket's receive buffer was full.
+         */
+        Overflow,
+        /**
+         * The last reply to the outstanding request was read.
+         */
+        Finished,
+    };
+
+    /**
+     * A NETLINK_ROUTE socket. Replies are read into a single reusable buffer sized for the
+     * largest chunk the kernel will send for a dump, so walking a dump costs one recv() per
+     * chunk and no per-message allocation.
+     *
+     * Strict checking (NETLINK_GET_STRICT_CHK) is enabled where the kernel supports it, so
+     * that filters in dump request headers (such as ifa_family and ifa_index) are applied
+     * by the kernel. Older kernels ignore some of those filters, so handlers must still
+     * check what they receive.
+     */
+    class NetlinkSocket final
+    {
+    public:
+        inline
+        NetlinkSocket();
+
+        NetlinkSocket(
+            NetlinkSocket const & ) = delete;
+
+        inline
+        ~NetlinkSocket() noexcept;
+
+        NetlinkSocket &
+        operator=(
+            NetlinkSocket const & ) = delete;
+
+        /**
+         * Sends an RTM_GET* dump request with the given family header and invokes
+         * handler( nlmsghdr const & ) for every reply until the kernel signals the end of
+         * the dump.
+         *
+         * @return false if the kernel flagged the dump with NLM_F_DUMP_INTR, meaning the
+         *         underlying tables changed while being dumped and the replies may not form
+         *         a consistent snapshot; true otherwise.
+         */
+        template< class Header, class Handler >
+        bool
+        dump(
+            ::std::uint16_t type,
+            Header const & header,
+            Handler && handler );
+
+        /**
+         * Sends a dump request built by the caller (which must include NLM_F_DUMP), otherwise
+         * like dump( type, header, handler ).
+         */
+        template< class Header, class Handler >
+        bool
+        dump(
+            NetlinkRequest< Header > & request,
+            Handler && handler );
+
+        /**
+         * Sends a non-dump RTM_GET* request for a single object and invokes
+         * handler( nlmsghdr const & ) for the reply.
+         *
+         * @return false if the kernel reported that no such object exists (ENODEV), in
+         *         which case the handler is not invoked; true otherwise.
+         */
+        template< class Header, class Handler >
+        bool
+        get(
+            NetlinkRequest< Header > & request,
+            Handler && handler );
+
+        /**
+         * Sends a request without waiting for the replies, which the caller then reads with
+         * receiveReply. Only one request may be outstanding at a time.
+         */
+        template< class Header >
+        void
+        send(
+            NetlinkRequest< Header > & request );
+
+        /**
+         * Reads one datagram of replies to the outstanding request, waiting for it only if
+         * wait is true, and invokes handler( nlmsghdr const & ) for each reply in it.
+         *
+         * @param consistent set to false if the kernel flags a reply with NLM_F_DUMP_INTR.
+         * @param error set, when the result is Finished, to the (positive) error code from an
+         *        NLMSG_ERROR reply, or 0.
+         * @return Finished after the last reply (NLMSG_DONE, an error, or a reply that is not
+         *         part of a multipart message), WouldBlock if wait is false and nothing was
+         *         waiting, and Received otherwise.
+         */
+        template< class Handler >
+        NetlinkReceiveResult
+        receiveReply(
+            bool wait,
+            bool & consistent,
+            int & error,
+            Handler && handler );
+
+        /**
+         * Joins a multicast group (RTNLGRP_*), after which the kernel sends this socket a
+         * notification for each change in that group.
+         */
+        inline
+        void
+        subscribe(
+            ::std::uint32_t group );
+
+        /**
+         * Reads one datagram, if one is waiting, without blocking and invokes
+         * handler( nlmsghdr const & ) for each notification in it.
+         */
+        template< class Handler >
+        NetlinkReceiveResult
+        receive(
+            Handler && handler );
+
+        [[nodiscard]]
+        inline
+        int
+        fd() const;
+
+    private:
+        [[noreturn]]
+        static
+        inline
+        void
+        throwSystemError(
+            ::std::string_view const & action,
+            int errorCode );
+
+        inline
+        void
+        sendMessage(
+            nlmsghdr & request );
+
+        /**
+         * Sends the request and reads replies until NLMSG_DONE, an error, or a reply that is
+         * not part of a multipart message.
+         *
+         * @return the (positive) error code from an NLMSG_ERROR reply, or 0.
+         */
+        template< class Handler >
+        int
+        transact(
+            nlmsghdr & request,
+            bool & consistent,
+            Handler && handler );
+
+        int _fd;
+        ::std::uint32_t _sequence;
+        ::std::vector< char > _buffer;
+    };
+
+    inline
+    NetlinkSocket::
+    NetlinkSocket()
+        : _fd( ::socket( AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE ) ),
+          _sequence( 0 ),
+          _buffer( 32'768 ) // the kernel caps each dump chunk at 32 KiB
+    {
+        if ( this->_fd < 0 )
+        {
+            throwSystemError( "creating netlink socket", errno );
+        }
+
+        sockaddr_nl address {};
+        address.nl_family = AF_NETLINK;
+        if ( ::bind( this->_fd, reinterpret_cast< sockaddr const * >( &address ), sizeof( address ) ) < 0 )
+        {
+            auto const errorCode( errno );
+            ::close( this->_fd );
+            throwSystemError( "binding netlink socket", errorCode );
+        }
+
+#ifdef NETLINK_GET_STRICT_CHK
+        // best effort: kernels before 4.20 don't have it and simply ignore header filters
+        int const enabled{ 1 };
+        ::std::ignore = ::setsockopt( this->_fd, SOL_NETLINK, NETLINK_GET_STRICT_CHK, &enabled, sizeof( enabled ) );
+#endif /* NETLINK_GET_STRICT_CHK */
+    }
+
+    inline
+    NetlinkSocket::
+    ~NetlinkSocket() noexcept
+    {
+        ::close( this->_fd );
+    }
+
+    inline
+    void
+    NetlinkSocket::
+    throwSystemError(
+        ::std::string_view const & action,
+        int const errorCode )
+    {
+        ::std::ostringstream oss;
+        oss << "Error " << errorCode << " " << action << ": " << getSystemErrorMessage( errorCode );
+        throw InterfaceBrowserSystemError( oss.str() );
+    }
+
+    inline
+    int
+    NetlinkSocket::
+    fd() const
+    {
+        return this->_fd;
+    }
+
+    inline
+    void
+    NetlinkSocket::
+    subscribe(
+        ::std::uint32_t const group )
+    {
+        if ( ::setsockopt( this->_fd, SOL_NETLINK, NETLINK_ADD_MEMBERSHIP, &group, sizeof( group ) ) < 0 )
+        {
+            throwSystemError( "joining netlink multicast group", errno );
+        }
+    }
+
+    template< class Handler >
+    NetlinkReceiveResult
+    NetlinkSocket::
+    receive(
+        Handler && handler )
+    {
+        ssize_t received;
+        do
+        {
+            received = ::recv( this->_fd, this->_buffer.data(), this->_buffer.size(), MSG_DONTWAIT | MSG_TRUNC );
+        }
+        while ( received < 0 && errno == EINTR );
+        if ( received < 0 )
+        {
+            if ( errno == EAGAIN || errno == EWOULDBLOCK )
+            {
+                return NetlinkReceiveResult::WouldBlock;
+            }
+            if ( errno == ENOBUFS )
+            {
+                return NetlinkReceiveResult::Overflow;
+            }
+            throwSystemError( "receiving netlink notification", errno );
+        }
+        if ( static_cast< size_t >( received ) > this->_buffer.size() )
+        {
+            throwSystemError( "receiving netlink notification", EMSGSIZE );
+        }
+
+        auto cursor( this->_buffer.data() );
+        auto remaining( static_cast< size_t >( received ) );
+        while ( remaining >= NLMSG_HDRLEN )
+        {
+            auto const & message( *reinterpret_cast< nlmsghdr const * >( cursor ) );
+            if ( message.nlmsg_len < NLMSG_HDRLEN || message.nlmsg_len > remaining )
+            {
+                break;
+            }
+            if ( message.nlmsg_type != NLMSG_DONE && message.nlmsg_type != NLMSG_ERROR &&
+                 message.nlmsg_type != NLMSG_NOOP )
+            {
+                handler( message );
+            }
+
+            size_t const step( NLMSG_ALIGN( message.nlmsg_len ) );
+            if ( step >= remaining )
+            {
+                break;
+            }
+            cursor += step;
+            remaining -= step;
+        }
+        return NetlinkReceiveResult::Received;
+    }
+
+    template< class Header, class Handler >
+    bool
+    NetlinkSocket::
+    dump(
+        ::std::uint16_t const type,
+        Header const & header,
+        Handler && handler )
+    {
+        NetlinkRequest< Header > request( type, NLM_F_DUMP, header );
+        return this->dump( request, ::std::forward< Handler >( handler ) );
+    }
+
+    template< class Header, class Handler >
+    bool
+    NetlinkSocket::
+    dump(
+        NetlinkRequest< Header > & request,
+        Handler && handler )
+    {
+        bool consistent{ true };
+        if ( int const error( this->transact( request.message(), consistent, handler ) ); error != 0 )
+        {
+            throwSystemError( "processing netlink dump request", error );
+        }
+        return consistent;
+    }
+
+    template< class Header, class Handler >
+    bool
+    NetlinkSocket::
+    get(
+        NetlinkRequest< Header > & request,
+        Handler && handler )
+    {
+        bool consistent{ true };
+        int const error( this->transact( request.message(), consistent, handler ) );
+        if ( error == ENODEV )
+        {
+            return false;
+        }
+        if ( error != 0 )
+        {
+            throwSystemError( "processing netlink get request", error );
+        }
+        return true;
+    }
+
+    inline
+    void
+    NetlinkSocket::
+    sendMessage(
+        nlmsghdr & request )
+    {
+        request.nlmsg_seq = ++this->_sequence;
+
+        ssize_t sent;
+        do
+        {
+            sent = ::send( this->_fd, &request, request.nlmsg_len, 0 );
+        }
+        while ( sent < 0 && errno == EINTR );
+        if ( sent < 0 )
+        {
+            throwSystemError( "sending netlink request", errno );
+        }
+    }
+
+    template< class Header >
+    void
+    NetlinkSocket::
+    send(
+        NetlinkRequest< Header > & request )
+    {
+        this->sendMessage( request.message() );
+    }
+
+    template< class Handler >
+    NetlinkReceiveResult
+    NetlinkSocket::
+    receiveReply(
+        bool const wait,
+        bool & consistent,
+        int & error,
+        Handler && handler )
+    {
+        ssize_t received;
+        do
+        {
+            // MSG_TRUNC makes netlink report the real length of a datagram that didn't fit
+            received = ::recv(
+                this->_fd,
+                this->_buffer.data(),
+                this->_buffer.size(),
+                MSG_TRUNC | ( wait ? 0 : MSG_DONTWAIT ) );
+        }
+        while ( received < 0 && errno == EINTR );
+        if ( received < 0 )
+        {
+            if ( !wait && ( errno == EAGAIN || errno == EWOULDBLOCK ) )
+            {
+                return NetlinkReceiveResult::WouldBlock;
+            }
+            throwSystemError( "receiving netlink reply", errno );
+        }
+        if ( static_cast< size_t >( received ) > this->_buffer.size() )
+        {
+            throwSystemError( "receiving netlink reply", EMSGSIZE );
+        }
+
+        auto cursor( this->_buffer.data() );
+        auto remaining( static_cast< size_t >( received ) );
+        while ( remaining >= NLMSG_HDRLEN )
+        {
+            auto const & message( *reinterpret_cast< nlmsghdr const * >( cursor ) );
+            if ( message.nlmsg_len < NLMSG_HDRLEN || message.nlmsg_len > remaining )
+            {
+                break;
+            }
+
+            if ( message.nlmsg_seq == this->_sequence )
+            {
+                if ( message.nlmsg_flags & NLM_F_DUMP_INTR )
+                {
+                    consistent = false;
+                }
+
+                if ( message.nlmsg_type == NLMSG_DONE )
+                {
+                    error = 0;
+                    return NetlinkReceiveResult::Finished;
+                }
+                if ( message.nlmsg_type == NLMSG_ERROR )
+                {
+                    auto const errorMessage( netlinkHeader< nlmsgerr >( message ) );
+                    error = errorMessage ? -errorMessage->error : EPROTO;
+                    return NetlinkReceiveResult::Finished;
+                }
+
+                handler( message );
+                if ( !( message.nlmsg_flags & NLM_F_MULTI ) )
+                {
+                    error = 0;
+                    return NetlinkReceiveResult::Finished;
+                }
+            }
+
+            size_t const step( NLMSG_ALIGN( message.nlmsg_len ) );
+            if ( step >= remaining )
+            {
+                break;
+            }
+            cursor += step;
+            remaining -= step;
+        }
+        return NetlinkReceiveResult::Received;
+    }
+
+    template< class Handler >
+    int
+    NetlinkSocket::
+    transact(
+        nlmsghdr & request,
+        bool & consistent,
+        Handler && handler )
+    {
+        this->sendMessage( request );
+
+        int error{ 0 };
+        while ( this->receiveReply( true, consistent, error, handler ) != NetlinkReceiveResult::Finished )
+        {
+        }
+        return error;
+    }
+}
+
+#endif /* ODDSOURCE_IS_LINUX && <linux/rtnetlink.h> */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_DETAIL_NETLINK_HPP */
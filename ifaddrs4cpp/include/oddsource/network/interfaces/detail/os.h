@@ -37,6 +37,12 @@
 #endif
 #endif
 
+#if defined(__linux__)
+#ifndef ODDSOURCE_IS_LINUX
+#define ODDSOURCE_IS_LINUX 1
+#endif
+#endif
+
 #include <cstdint>
 
 #endif /* ODDSOURCE_NETWORK_INTERFACES_DETAIL_OS_H */
@@ -0,0 +1,65 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef ODDSOURCE_NETWORK_INTERFACES_DETAIL_SYSTEM_ERROR_HPP
+#define ODDSOURCE_NETWORK_INTERFACES_DETAIL_SYSTEM_ERROR_HPP
+
+#include "config.h"
+
+#ifndef ODDSOURCE_IS_WINDOWS
+
+#include <cstring>
+#include <string>
+
+#  if defined(__clang__) && ODDSOURCE_IS_MACOS
+#    define STRERROR_R_RETURNS_INT 1
+#  elif ( _POSIX_C_SOURCE >= 200112L || _XOPEN_SOURCE >= 600 ) && !_GNU_SOURCE
+#    define STRERROR_R_RETURNS_INT 1
+#  else
+#    define STRERROR_R_RETURNS_INT 0
+#  endif
+
+namespace OddSource::Interfaces::detail
+{
+    inline
+    ::std::string
+    getSystemErrorMessage(
+        int const errorCode )
+    {
+        static constexpr size_t const MAX_LENGTH{ 4096 };
+        char errorMessageBuffer[ MAX_LENGTH ];
+#if STRERROR_R_RETURNS_INT == 1
+        ::std::string errorMessage;
+        if ( int const result( ::strerror_r( errorCode, errorMessageBuffer, MAX_LENGTH ) ); result == 0 )
+        {
+            errorMessage = errorMessageBuffer;
+        }
+#else
+        ::std::string const errorMessage( ::strerror_r( errorCode, errorMessageBuffer, MAX_LENGTH ) );
+#endif
+
+        using namespace ::std::string_literals;
+        return errorMessage.empty() ? "Unknown error"s : errorMessage;
+    }
+}
+
+#  undef STRERROR_R_RETURNS_INT
+
+#endif /* !ODDSOURCE_IS_WINDOWS */
+
+#endif /* ODDSOURCE_NETWORK_INTERFACES_DETAIL_SYSTEM_ERROR_HPP */
@@ -0,0 +1,386 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef IFADDRS4CPP_INLINE_SOURCE
+#include "../AddressList.hpp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#include "../detail/ip_codec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <thread>
+
+// ReSharper disable once CppUnnamedNamespaceInHeaderFile
+namespace
+{
+    // what AddressList::parse looks for in each character of an entry
+    enum CharacterKind : ::std::uint8_t
+    {
+        OTHER_CHARACTER = 0,
+        END_OF_ENTRY,
+        SLASH,
+        COLON,
+    };
+
+    constexpr auto const CHARACTER_KINDS( []
+    {
+        ::std::array< CharacterKind, 256 > kinds{};
+        kinds[ static_cast< unsigned char >( ',' ) ] = END_OF_ENTRY;
+        kinds[ static_cast< unsigned char >( '\n' ) ] = END_OF_ENTRY;
+        kinds[ static_cast< unsigned char >( '#' ) ] = END_OF_ENTRY;
+        kinds[ static_cast< unsigned char >( '/' ) ] = SLASH;
+        kinds[ static_cast< unsigned char >( ':' ) ] = COLON;
+        return kinds;
+    }() );
+
+    inline
+    bool
+    isSpace(
+        char const c )
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    /**
+     * Parses the prefix length after the / of an entry, which must be a decimal number no greater than maximum.
+     */
+    inline
+    bool
+    parsePrefixLength(
+        ::std::string_view const & text,
+        ::std::uint8_t const maximum,
+        ::std::uint8_t & prefixLength )
+    {
+        unsigned value{ 0 };
+        auto const end( text.data() + text.length() );
+        auto const [ pointer, error ] = ::std::from_chars( text.data(), end, value );
+        if ( text.empty() || error != ::std::errc() || pointer != end || value > maximum )
+        {
+            return false;
+        }
+        prefixLength = static_cast< ::std::uint8_t >( value );
+        return true;
+    }
+}
+
+namespace OddSource::Interfaces
+{
+    OddSource_Inline
+    AddressList::
+    AddressList(
+        ::std::string_view const & text,
+        AddressListOptions const & options )
+    {
+        auto threads( options.threads == 0 ? ::std::thread::hardware_concurrency() : options.threads );
+        if ( options.min_bytes_per_thread > 0 )
+        {
+            threads = ::std::min< ::std::size_t >( threads, text.length() / options.min_bytes_per_thread );
+        }
+        if ( threads <= 1 )
+        {
+            this->parse( text, 0, text.length() );
+            return;
+        }
+
+        // split the text into ranges of whole lines, so that no entry or comment spans two threads
+        ::std::vector< ::std::size_t > boundaries( 1, 0 );
+        for ( ::std::size_t i = 1; i < threads; ++i )
+        {
+            auto boundary( ::std::max( text.length() / threads * i, boundaries.back() ) );
+            if ( boundary > 0 )
+            {
+                boundary = text.find( '\n', boundary - 1 );
+                boundary = boundary == ::std::string_view::npos ? text.length() : boundary + 1;
+            }
+            boundaries.push_back( boundary );
+        }
+        boundaries.push_back( text.length() );
+
+        ::std::vector< AddressList > parts;
+        parts.reserve( threads );
+        for ( ::std::size_t part = 0; part < threads; ++part )
+        {
+            parts.push_back( AddressList() );
+        }
+        ::std::vector< ::std::size_t > newlines( threads, 0 );
+        ::std::vector< ::std::exception_ptr > failures( threads );
+        ::std::vector< ::std::thread > workers;
+        workers.reserve( threads - 1 );
+        auto const work( [ & ]( ::std::size_t const part )
+        {
+            try
+            {
+                newlines[ part ] = parts[ part ].parse( text, boundaries[ part ], boundaries[ part + 1 ] );
+            }
+            catch ( ... )
+            {
+                failures[ part ] = ::std::current_exception();
+            }
+        } );
+        ::std::size_t started{ 1 };
+        try
+        {
+            for ( ; started < threads; ++started )
+            {
+                workers.emplace_back( work, started );
+            }
+        }
+        catch ( ... )
+        {
+            // a thread could not be started, so the calling thread parses the ranges that did not get one, rather
+            // than unwinding past the workers already running
+        }
+        for ( auto part( started ); part < threads; ++part )
+        {
+            work( part );
+        }
+        work( 0 );
+        for ( auto & worker : workers )
+        {
+            worker.join();
+        }
+        for ( auto const & failure : failures )
+        {
+            if ( failure )
+            {
+                ::std::rethrow_exception( failure );
+            }
+        }
+
+        ::std::size_t ipv4Count{ 0 }, ipv6Count{ 0 }, errorCount{ 0 };
+        for ( auto const & part : parts )
+        {
+            ipv4Count += part._ipv4Addresses.size();
+            ipv6Count += part._ipv6Addresses.size();
+            errorCount += part._errors.size();
+        }
+        this->_ipv4Addresses.reserve( ipv4Count );
+        this->_ipv4PrefixLengths.reserve( ipv4Count );
+        this->_ipv4Lines.reserve( ipv4Count );
+        this->_ipv6Addresses.reserve( ipv6Count );
+        this->_ipv6PrefixLengths.reserve( ipv6Count );
+        this->_ipv6Lines.reserve( ipv6Count );
+        this->_errors.reserve( errorCount );
+
+        ::std::size_t lines{ 0 };
+        for ( ::std::size_t part = 0; part < threads; ++part )
+        {
+            this->append( parts[ part ], lines );
+            lines += newlines[ part ];
+        }
+    }
+
+    OddSource_Inline
+    ::std::size_t
+    AddressList::
+    parse(
+        ::std::string_view const & text,
+        ::std::size_t const begin,
+        ::std::size_t const end )
+    {
+        ::std::size_t newlines{ 0 };
+        for ( auto position( begin ); position < end; )
+        {
+            // find the end of the entry, noting its first / and whether a : comes before that, in one pass
+            auto entryBegin( position );
+            auto slash( ::std::string_view::npos );
+            bool isIPv6{ false };
+            for ( ; position < end; ++position )
+            {
+                auto const kind( CHARACTER_KINDS[ static_cast< unsigned char >( text[ position ] ) ] );
+                if ( kind == OTHER_CHARACTER )
+                {
+                    continue;
+                }
+                if ( kind == END_OF_ENTRY )
+                {
+                    break;
+                }
+                if ( slash == ::std::string_view::npos )
+                {
+                    slash = kind == SLASH ? position : slash;
+                    isIPv6 = isIPv6 || kind == COLON;
+                }
+            }
+            auto entryEnd( position );
+            while ( entryBegin < entryEnd && isSpace( text[ entryBegin ] ) )
+            {
+                ++entryBegin;
+            }
+            while ( entryEnd > entryBegin && isSpace( text[ entryEnd - 1 ] ) )
+            {
+                --entryEnd;
+            }
+
+            if ( entryBegin < entryEnd )
+            {
+                auto const line( static_cast< ::std::uint32_t >( newlines + 1 ) );
+                auto const address( text.substr( entryBegin, ::std::min( slash, entryEnd ) - entryBegin ) );
+                ::std::uint8_t prefixLength( isIPv6 ? 128 : 32 );
+
+                auto error( ParseError::None );
+                in_addr ipv4{};
+                in6_addr ipv6{};
+                if ( address.empty() )
+                {
+                    error = ParseError::Malformed;
+                }
+                else if ( address.length() >= detail::MAX_REPR_LENGTH )
+                {
+                    error = ParseError::TooLong;
+                }
+                else if ( isIPv6 ? !detail::parseIPv6( address, ipv6 ) : !detail::parseIPv4( address, ipv4 ) )
+                {
+                    error = ParseError::Malformed;
+                }
+                else if ( slash != ::std::string_view::npos &&
+                          !parsePrefixLength( text.substr( slash + 1, entryEnd - slash - 1 ), isIPv6 ? 128 : 32,
+                                               prefixLength ) )
+                {
+                    error = ParseError::InvalidPrefixLength;
+                }
+
+                if ( error != ParseError::None )
+                {
+                    this->_errors.push_back( { line, entryBegin, entryEnd - entryBegin, error } );
+                }
+                else if ( isIPv6 )
+                {
+                    auto & bytes( this->_ipv6Addresses.emplace_back() );
+                    ::std::memcpy( bytes.data(), &ipv6, bytes.size() );
+                    this->_ipv6PrefixLengths.push_back( prefixLength );
+                    this->_ipv6Lines.push_back( line );
+                }
+                else
+                {
+                    this->_ipv4Addresses.push_back( ntohl( ipv4.s_addr ) );
+                    this->_ipv4PrefixLengths.push_back( prefixLength );
+                    this->_ipv4Lines.push_back( line );
+                }
+            }
+
+            if ( position < end && text[ position ] == '#' )
+            {
+                while ( position < end && text[ position ] != '\n' )
+                {
+                    ++position;
+                }
+            }
+            if ( position < end )
+            {
+                newlines += text[ position ] == '\n' ? 1 : 0;
+                ++position;
+            }
+        }
+        return newlines;
+    }
+
+    OddSource_Inline
+    void
+    AddressList::
+    append(
+        AddressList const & other,
+        ::std::size_t const lines )
+    {
+        auto const shift( static_cast< ::std::uint32_t >( lines ) );
+        this->_ipv4Addresses.insert( this->_ipv4Addresses.end(),
+                                     other._ipv4Addresses.begin(), other._ipv4Addresses.end() );
+        this->_ipv4PrefixLengths.insert( this->_ipv4PrefixLengths.end(),
+                                         other._ipv4PrefixLengths.begin(), other._ipv4PrefixLengths.end() );
+        for ( auto const line : other._ipv4Lines )
+        {
+            this->_ipv4Lines.push_back( line + shift );
+        }
+
+        this->_ipv6Addresses.insert( this->_ipv6Addresses.end(),
+                                     other._ipv6Addresses.begin(), other._ipv6Addresses.end() );
+        this->_ipv6PrefixLengths.insert( this->_ipv6PrefixLengths.end(),
+                                         other._ipv6PrefixLengths.begin(), other._ipv6PrefixLengths.end() );
+        for ( auto const line : other._ipv6Lines )
+        {
+            this->_ipv6Lines.push_back( line + shift );
+        }
+
+        for ( auto error : other._errors )
+        {
+            error.line += lines;
+            this->_errors.push_back( error );
+        }
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    AddressList::
+    ipv4_addresses() const
+    {
+        return this->_ipv4Addresses;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint8_t > const &
+    AddressList::
+    ipv4_prefix_lengths() const
+    {
+        return this->_ipv4PrefixLengths;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    AddressList::
+    ipv4_lines() const
+    {
+        return this->_ipv4Lines;
+    }
+
+    OddSource_Inline
+    ::std::vector< IPv6Address::Bytes > const &
+    AddressList::
+    ipv6_addresses() const
+    {
+        return this->_ipv6Addresses;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint8_t > const &
+    AddressList::
+    ipv6_prefix_lengths() const
+    {
+        return this->_ipv6PrefixLengths;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    AddressList::
+    ipv6_lines() const
+    {
+        return this->_ipv6Lines;
+    }
+
+    OddSource_Inline
+    ::std::vector< AddressListError > const &
+    AddressList::
+    errors() const
+    {
+        return this->_errors;
+    }
+}
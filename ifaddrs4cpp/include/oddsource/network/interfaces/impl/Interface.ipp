@@ -209,13 +209,44 @@ namespace OddSource::Interfaces
         ::std::string_view const & description,
         ::std::uint32_t flags,
         ::std::optional<::std::uint64_t const> const & mtu)
+        : Interface( index, name, friendlyName, description, flags, mtu, nullptr )
+    {
+    }
+
+    OddSource_Inline
+    Interface::
+    Interface(
+        ::std::uint32_t index,
+        ::std::string_view const & name,
+        ::std::string_view const & friendlyName,
+        ::std::string_view const & description,
+        ::std::uint32_t flags,
+        ::std::optional< ::std::uint64_t const > const & mtu,
+        detail::Arena * arena )
         : _index( index ),
-          _name( name ),
-          _friendlyName( friendlyName ),
-          _description( description ),
+          _names( detail::ArenaAllocator< char >( arena ) ),
+          _name { 0, static_cast< ::std::uint32_t >( name.size() ) },
+          _friendlyName( _name ),
+          _description( _name ),
           _flags( flags ),
-          _mtu( mtu )
+          _mtu( mtu ),
+          _ipv4Addresses(),
+          _ipv6Addresses()
     {
+        // on POSIX all three are the same, and on Windows the friendly name and description usually differ
+        ::std::size_t capacity( name.size() );
+        if ( friendlyName != name )
+        {
+            capacity += friendlyName.size();
+        }
+        if ( description != name && description != friendlyName )
+        {
+            capacity += description.size();
+        }
+        this->_names.reserve( capacity );
+        this->_names.append( name.data(), name.size() );
+        this->_friendlyName = this->storeName( friendlyName );
+        this->_description = this->storeName( description );
     }
 
     OddSource_Inline
@@ -223,6 +254,7 @@ namespace OddSource::Interfaces
     Interface( // NOLINT(*-use-equals-default)
         Interface const & other )
         : _index( other._index ),
+          _names( other._names ),
           _name( other._name ),
           _friendlyName( other._friendlyName ),
           _description( other._description ),
@@ -239,9 +271,10 @@ namespace OddSource::Interfaces
     Interface(
         Interface && other ) noexcept
         : _index( other._index ),
-          _name( ::std::move( other._name ) ),
-          _friendlyName( ::std::move( other._friendlyName ) ),
-          _description( ::std::move( other._description ) ),
+          _names( ::std::move( other._names ) ),
+          _name( other._name ),
+          _friendlyName( other._friendlyName ),
+          _description( other._description ),
           _flags( other._flags ),
           _mtu( ::std::move( other._mtu ) ),
           _macAddress( ::std::move( other._macAddress ) ),
@@ -250,6 +283,8 @@ namespace OddSource::Interfaces
     {
         other._index = 0;
         other._flags = 0;
+        other._names.clear();
+        other._name = other._friendlyName = other._description = NameSpan { 0, 0 };
     }
 
     OddSource_Inline
@@ -271,7 +306,7 @@ namespace OddSource::Interfaces
     Interface::
     name() const
     {
-        return this->_name;
+        return ::std::string( this->name_view() );
     }
 
     OddSource_Inline
@@ -279,7 +314,7 @@ namespace OddSource::Interfaces
     Interface::
     friendlyName() const
     {
-        return this->_friendlyName;
+        return ::std::string( this->friendly_name_view() );
     }
 
     OddSource_Inline
@@ -287,7 +322,60 @@ namespace OddSource::Interfaces
     Interface::
     description() const
     {
-        return this->_description;
+        return ::std::string( this->description_view() );
+    }
+
+    OddSource_Inline
+    ::std::string_view
+    Interface::
+    name_view() const
+    {
+        return this->view( this->_name );
+    }
+
+    OddSource_Inline
+    ::std::string_view
+    Interface::
+    friendly_name_view() const
+    {
+        return this->view( this->_friendlyName );
+    }
+
+    OddSource_Inline
+    ::std::string_view
+    Interface::
+    description_view() const
+    {
+        return this->view( this->_description );
+    }
+
+    OddSource_Inline
+    ::std::string_view
+    Interface::
+    view(
+        NameSpan const & span ) const
+    {
+        return { this->_names.data() + span.offset, span.length };
+    }
+
+    OddSource_Inline
+    Interface::NameSpan
+    Interface::
+    storeName(
+        ::std::string_view const & value )
+    {
+        for ( auto const & span : { this->_name, this->_friendlyName } )
+        {
+            if ( this->view( span ) == value )
+            {
+                return span;
+            }
+        }
+        NameSpan const span {
+            static_cast< ::std::uint32_t >( this->_names.size() ),
+            static_cast< ::std::uint32_t >( value.size() ) };
+        this->_names.append( value.data(), value.size() );
+        return span;
     }
 
     OddSource_Inline
@@ -444,13 +532,16 @@ namespace OddSource::Interfaces
     #endif /* IFF_SLAVE */
         };
 
-        os << rInterface._index << ": " << rInterface._name;
-        if ( rInterface._name != rInterface._friendlyName )
+        auto const name( rInterface.name_view() );
+        auto const friendlyName( rInterface.friendly_name_view() );
+        auto const description( rInterface.description_view() );
+        os << rInterface._index << ": " << name;
+        if ( name != friendlyName )
         {
-            os << " (" << rInterface._friendlyName;
-            if ( rInterface._friendlyName != rInterface._description )
+            os << " (" << friendlyName;
+            if ( friendlyName != description )
             {
-                os << " [" << rInterface._description << ']';
+                os << " [" << description << ']';
             }
             os << ')';
         }
@@ -0,0 +1,214 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef IFADDRS4CPP_INLINE_SOURCE
+#include "../InterfaceProvider.hpp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#include <utility>
+
+namespace OddSource::Interfaces
+{
+    OddSource_Inline
+    InterfaceCollector::
+    InterfaceCollector(
+        EnumerationOptions const & options,
+        ::std::list< ::std::string > & warnings,
+        ::std::list< ::std::shared_ptr< Interface const > > & interfaces )
+        : _options( options ),
+          _warnings( warnings ),
+          _interfaces( interfaces ),
+          _builder(),
+          _allocator( options.arena )
+    {
+    }
+
+    OddSource_Inline
+    EnumerationOptions const &
+    InterfaceCollector::
+    options() const
+    {
+        return this->_options;
+    }
+
+    OddSource_Inline
+    Interface *
+    InterfaceCollector::
+    add_interface(
+        ::std::uint32_t const index,
+        ::std::string_view const & name,
+        ::std::uint32_t const flags,
+        ::std::optional< ::std::uint64_t > const mtu )
+    {
+        if ( ( this->_options.up_only && ( flags & IFF_UP ) == 0 ) ||
+             ( this->_options.index && *this->_options.index != index ) ||
+             ( this->_options.name && *this->_options.name != name ) )
+        {
+            return nullptr;
+        }
+
+        auto pInterface( this->_allocator.make_shared< Interface >(
+            index,
+            name,
+            name,
+            name,
+            flags,
+            this->_options.skip_mtu ? ::std::nullopt : mtu ) );
+        this->_interfaces.push_back( pInterface );
+        return pInterface.get();
+    }
+
+    OddSource_Inline
+    void
+    InterfaceCollector::
+    set_mac_address(
+        Interface & rInterface,
+        MacAddress && macAddress )
+    {
+        if ( !this->_options.skip_mac_address )
+        {
+            this->_builder.setMacAddress( rInterface, ::std::move( macAddress ) );
+        }
+    }
+
+    OddSource_Inline
+    void
+    InterfaceCollector::
+    add_ipv4_address(
+        Interface & rInterface,
+        InterfaceIPv4Address && address )
+    {
+        if ( ( static_cast< ::std::uint8_t >( this->_options.address_families ) &
+               static_cast< ::std::uint8_t >( AddressFamilies::IPv4 ) ) != 0 )
+        {
+            this->_builder.addIPv4Address( rInterface, ::std::move( address ) );
+        }
+    }
+
+    OddSource_Inline
+    void
+    InterfaceCollector::
+    add_ipv6_address(
+        Interface & rInterface,
+        InterfaceIPv6Address && address )
+    {
+        if ( ( static_cast< ::std::uint8_t >( this->_options.address_families ) &
+               static_cast< ::std::uint8_t >( AddressFamilies::IPv6 ) ) == 0 )
+        {
+            return;
+        }
+
+        if ( this->_options.skip_address_flags && address.flags() != 0 )
+        {
+            // IPv6 interface addresses never have a broadcast address, so only a destination needs to be kept
+            auto const & destination( address.point_to_point_destination() );
+            this->_builder.addIPv6Address( rInterface, destination ?
+                InterfaceIPv6Address(
+                    address.address(), 0, address.prefix_length().value_or( 0 ), PointToPoint, *destination ) :
+                InterfaceIPv6Address( address.address(), 0, address.prefix_length().value_or( 0 ) ) );
+            return;
+        }
+        this->_builder.addIPv6Address( rInterface, ::std::move( address ) );
+    }
+
+    OddSource_Inline
+    void
+    InterfaceCollector::
+    add_warning(
+        ::std::string warning )
+    {
+        this->_warnings.push_back( ::std::move( warning ) );
+    }
+
+    OddSource_Inline
+    InterfaceProvider::
+    ~InterfaceProvider() noexcept
+    {
+    }
+
+    OddSource_Inline
+    SyntheticInterfaceProvider::
+    SyntheticInterfaceProvider(
+        ::std::size_t const interfaces,
+        ::std::size_t const ipv4Addresses,
+        ::std::size_t const ipv6Addresses )
+        : _interfaces( interfaces ),
+          _ipv4Addresses( ipv4Addresses ),
+          _ipv6Addresses( ipv6Addresses )
+    {
+    }
+
+    OddSource_Inline
+    void
+    SyntheticInterfaceProvider::
+    populate(
+        InterfaceCollector & collector ) const
+    {
+        static IPv4Address const broadcast( "10.255.255.255" );
+        ::std::uint32_t ipv4Count{ 0 };
+        for ( ::std::size_t i{ 0 }; i < this->_interfaces; ++i )
+        {
+            auto const number( static_cast< ::std::uint32_t >( i ) );
+            Interface * const pInterface( collector.add_interface(
+                number + 1,
+                "syn" + ::std::to_string( i ),
+                IFF_UP | IFF_RUNNING | IFF_BROADCAST | IFF_MULTICAST,
+                1500 ) );
+            if ( pInterface == nullptr )
+            {
+                ipv4Count += static_cast< ::std::uint32_t >( this->_ipv4Addresses );
+                continue;
+            }
+
+            ::std::uint8_t const mac[ MAX_ADAPTER_ADDRESS_LENGTH ] {
+                0x02, 0x00,
+                static_cast< ::std::uint8_t >( number >> 24 ),
+                static_cast< ::std::uint8_t >( number >> 16 ),
+                static_cast< ::std::uint8_t >( number >> 8 ),
+                static_cast< ::std::uint8_t >( number ),
+            };
+            collector.set_mac_address( *pInterface, MacAddress( mac, 6 ) );
+
+            for ( ::std::size_t j{ 0 }; j < this->_ipv4Addresses; ++j )
+            {
+                // stay within 10.0.0.0/8, wrapping around if there are more than 2^24 - 1 addresses
+                ::std::uint32_t const address( ( 10u << 24 ) | ( ++ipv4Count & 0x00ff'ffffu ) );
+                collector.add_ipv4_address( *pInterface, InterfaceIPv4Address(
+                    IPv4Address( address ), 0, 8, Broadcast, broadcast ) );
+            }
+
+            for ( ::std::size_t j{ 0 }; j < this->_ipv6Addresses; ++j )
+            {
+                auto const host( static_cast< ::std::uint64_t >( j + 1 ) );
+                IPv6Address::Bytes bytes {
+                    0xfd, 0x00, 0x00, 0x00,
+                    static_cast< ::std::uint8_t >( number >> 24 ),
+                    static_cast< ::std::uint8_t >( number >> 16 ),
+                    static_cast< ::std::uint8_t >( number >> 8 ),
+                    static_cast< ::std::uint8_t >( number ),
+                };
+                for ( int b{ 0 }; b < 8; ++b )
+                {
+                    bytes[ 15 - b ] = static_cast< ::std::uint8_t >( host >> ( 8 * b ) );
+                }
+                collector.add_ipv6_address( *pInterface, InterfaceIPv6Address( IPv6Address( bytes ), 0, 64 ) );
+            }
+        }
+    }
+}
@@ -0,0 +1,425 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef IFADDRS4CPP_INLINE_SOURCE
+#include "../InterfaceRefresher.hpp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#include "../detail/netlink.hpp"
+
+#ifdef ODDSOURCE_HAS_NETLINK
+#include "../detail/system_error.hpp"
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <sstream>
+#endif /* ODDSOURCE_HAS_NETLINK */
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace OddSource::Interfaces
+{
+    class InterfaceRefresher::Implementation
+    {
+    public:
+        using clock = ::std::chrono::steady_clock;
+
+        explicit
+        Implementation(
+            RefresherOptions options )
+            : _options( ::std::move( options ) ),
+              _snapshots( this->_options.enumeration ),
+              _pending( false ),
+              _stopping( false )
+        {
+            this->_statistics.started = clock::now();
+#ifdef ODDSOURCE_HAS_NETLINK
+            this->_wakeDescriptor = ::eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK );
+            if ( this->_wakeDescriptor < 0 )
+            {
+                int const errorCode( errno );
+                ::std::ostringstream oss;
+                oss << "Error " << errorCode << " creating refresher wake-up descriptor: "
+                    << detail::getSystemErrorMessage( errorCode );
+                throw InterfaceBrowserSystemError( oss.str() );
+            }
+#endif /* ODDSOURCE_HAS_NETLINK */
+            try
+            {
+                if ( this->_options.monitor )
+                {
+                    try
+                    {
+                        this->_monitor = ::std::make_unique< InterfaceMonitor >( this->_options.enumeration );
+                    }
+                    catch ( InterfaceBrowserSystemError const & e )
+                    {
+                        this->_statistics.last_error = ::std::string( "Monitoring unavailable: " ) + e.what();
+                    }
+                }
+                this->_thread = ::std::thread( [ this ] { this->run(); } );
+            }
+            catch ( ... )
+            {
+                // the destructor does not run for a constructor that throws, so it cannot close the descriptor
+#ifdef ODDSOURCE_HAS_NETLINK
+                ::close( this->_wakeDescriptor );
+#endif /* ODDSOURCE_HAS_NETLINK */
+                throw;
+            }
+        }
+
+        ~Implementation() noexcept
+        {
+            {
+                ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                this->_stopping = true;
+            }
+            this->wake();
+            this->_thread.join();
+#ifdef ODDSOURCE_HAS_NETLINK
+            ::close( this->_wakeDescriptor );
+#endif /* ODDSOURCE_HAS_NETLINK */
+        }
+
+        void
+        trigger()
+        {
+            {
+                ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                this->_pending = true;
+                ++this->_statistics.manual_triggers;
+            }
+            this->wake();
+        }
+
+        [[nodiscard]]
+        RefresherStatistics
+        statistics() const
+        {
+            ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+            return this->_statistics;
+        }
+
+        [[nodiscard]]
+        InterfaceSnapshots const &
+        snapshots() const
+        {
+            return this->_snapshots;
+        }
+
+    private:
+        void
+        run()
+        {
+            ::std::optional< clock::time_point > lastStart;
+            ::std::optional< clock::time_point > nextTimer;
+            if ( this->_options.interval )
+            {
+                nextTimer = clock::now() + *this->_options.interval;
+            }
+
+            while ( true )
+            {
+                // wait for the first trigger
+                if ( !this->wait( nextTimer, true ) )
+                {
+                    return;
+                }
+
+                // then give the burst time to finish, and keep refreshes apart
+                auto refreshAt( clock::now() + this->_options.coalesce_window );
+                if ( lastStart )
+                {
+                    refreshAt = ::std::max( refreshAt, *lastStart + this->_options.min_interval );
+                }
+                if ( !this->wait( refreshAt, false ) )
+                {
+                    return;
+                }
+
+                {
+                    ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                    this->_pending = false;
+                }
+                lastStart = clock::now();
+                this->refresh();
+                if ( this->_options.interval )
+                {
+                    nextTimer = clock::now() + *this->_options.interval;
+                }
+            }
+        }
+
+        /**
+         * Waits until the deadline or, if untilTriggered, until a trigger is pending.
+         *
+         * @return false if the refresher is stopping.
+         */
+        bool
+        wait(
+            ::std::optional< clock::time_point > const deadline,
+            bool const untilTriggered )
+        {
+            while ( true )
+            {
+                {
+                    ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                    if ( this->_stopping )
+                    {
+                        return false;
+                    }
+                    if ( untilTriggered && this->_pending )
+                    {
+                        return true;
+                    }
+                    if ( deadline && clock::now() >= *deadline )
+                    {
+                        if ( untilTriggered )
+                        {
+                            this->_pending = true;
+                            ++this->_statistics.timer_triggers;
+                        }
+                        return true;
+                    }
+                }
+                this->block( deadline, untilTriggered );
+            }
+        }
+
+        void
+        refresh()
+        {
+            auto const start( clock::now() );
+            ::std::optional< ::std::string > error;
+            ::std::vector< InterfaceEvent > changes;
+            try
+            {
+                changes = this->_snapshots.refresh();
+            }
+            catch ( ::std::exception const & e )
+            {
+                error = e.what();
+            }
+            catch ( ... )
+            {
+                // anything that reached the thread's boundary would end the process
+                error = "Refresh failed with an exception not derived from std::exception";
+            }
+            auto const finish( clock::now() );
+            auto const latency( ::std::chrono::duration_cast< ::std::chrono::nanoseconds >( finish - start ) );
+
+            {
+                ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                auto & statistics( this->_statistics );
+                ++statistics.refreshes;
+                statistics.last_refresh = finish;
+                statistics.last_latency = latency;
+                statistics.max_latency = ::std::max( statistics.max_latency, latency );
+                statistics.total_latency += latency;
+                if ( error )
+                {
+                    ++statistics.failures;
+                    statistics.last_error = ::std::move( error );
+                }
+                else if ( !changes.empty() )
+                {
+                    ++statistics.changed_refreshes;
+                }
+            }
+
+            if ( !changes.empty() && this->_options.on_change )
+            {
+                try
+                {
+                    this->_options.on_change( changes );
+                }
+                catch ( ::std::exception const & e )
+                {
+                    ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                    this->_statistics.last_error = ::std::string( "on_change failed: " ) + e.what();
+                }
+                catch ( ... )
+                {
+                    ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                    this->_statistics.last_error =
+                        "on_change failed with an exception not derived from std::exception";
+                }
+            }
+        }
+
+#ifdef ODDSOURCE_HAS_NETLINK
+        /**
+         * Blocks until the deadline, a wake-up, or a monitor notification.
+         */
+        void
+        block(
+            ::std::optional< clock::time_point > const deadline,
+            [[maybe_unused]] bool const untilTriggered )
+        {
+            int timeout( -1 );
+            if ( deadline )
+            {
+                auto const remaining( ::std::chrono::ceil< ::std::chrono::milliseconds >( *deadline - clock::now() ) );
+                timeout = static_cast< int >( ::std::clamp< ::std::chrono::milliseconds::rep >(
+                    remaining.count(), 0, INT_MAX ) );
+            }
+
+            pollfd descriptors[ 2 ] {
+                { this->_wakeDescriptor, POLLIN, 0 },
+                { this->_monitor ? this->_monitor->native_handle() : -1, POLLIN, 0 },
+            };
+            if ( ::poll( descriptors, 2, timeout ) <= 0 )
+            {
+                return;
+            }
+
+            if ( descriptors[ 0 ].revents & POLLIN )
+            {
+                ::std::uint64_t value;
+                static_cast< void >( ::read( this->_wakeDescriptor, &value, sizeof( value ) ) );
+            }
+            if ( descriptors[ 1 ].revents & POLLIN )
+            {
+                size_t events( 0 );
+                try
+                {
+                    events = this->_monitor->poll_events( []( InterfaceEvent && ) {} );
+                }
+                catch ( InterfaceBrowserSystemError const & e )
+                {
+                    // without the monitor, the timer and manual triggers still work
+                    ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                    this->_statistics.last_error = ::std::string( "Monitoring stopped: " ) + e.what();
+                    this->_monitor.reset();
+                    return;
+                }
+                if ( events > 0 )
+                {
+                    ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+                    this->_pending = true;
+                    ++this->_statistics.monitor_triggers;
+                }
+            }
+        }
+
+        void
+        wake()
+        {
+            ::std::uint64_t const value{ 1 };
+            static_cast< void >( ::write( this->_wakeDescriptor, &value, sizeof( value ) ) );
+        }
+#else /* ODDSOURCE_HAS_NETLINK */
+        /**
+         * Blocks until the deadline or a wake-up.
+         */
+        void
+        block(
+            ::std::optional< clock::time_point > const deadline,
+            bool const untilTriggered )
+        {
+            ::std::unique_lock< ::std::mutex > lock( this->_mutex );
+            auto const woken(
+                [ this, untilTriggered ] { return this->_stopping || ( untilTriggered && this->_pending ); } );
+            if ( deadline )
+            {
+                this->_condition.wait_until( lock, *deadline, woken );
+            }
+            else
+            {
+                this->_condition.wait( lock, woken );
+            }
+        }
+
+        void
+        wake()
+        {
+            this->_condition.notify_all();
+        }
+#endif /* !ODDSOURCE_HAS_NETLINK */
+
+        RefresherOptions const _options;
+        InterfaceSnapshots _snapshots;
+        ::std::unique_ptr< InterfaceMonitor > _monitor;
+        mutable ::std::mutex _mutex;
+        RefresherStatistics _statistics;
+        bool _pending;
+        bool _stopping;
+#ifdef ODDSOURCE_HAS_NETLINK
+        int _wakeDescriptor;
+#else /* ODDSOURCE_HAS_NETLINK */
+        ::std::condition_variable _condition;
+#endif /* !ODDSOURCE_HAS_NETLINK */
+        ::std::thread _thread;
+    };
+
+    OddSource_Inline
+    InterfaceRefresher::
+    InterfaceRefresher(
+        RefresherOptions options )
+        : _implementation( ::std::make_unique< Implementation >( ::std::move( options ) ) )
+    {
+    }
+
+    OddSource_Inline
+    InterfaceRefresher::
+    ~InterfaceRefresher() noexcept
+    {
+    }
+
+    OddSource_Inline
+    InterfaceSnapshots const &
+    InterfaceRefresher::
+    snapshots() const
+    {
+        return this->_implementation->snapshots();
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< InterfaceBrowser const >
+    InterfaceRefresher::
+    latest() const
+    {
+        return this->_implementation->snapshots().load();
+    }
+
+    OddSource_Inline
+    void
+    InterfaceRefresher::
+    trigger()
+    {
+        this->_implementation->trigger();
+    }
+
+    OddSource_Inline
+    RefresherStatistics
+    InterfaceRefresher::
+    statistics() const
+    {
+        return this->_implementation->statistics();
+    }
+}
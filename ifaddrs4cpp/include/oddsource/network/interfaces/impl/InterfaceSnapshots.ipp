@@ -0,0 +1,135 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef IFADDRS4CPP_INLINE_SOURCE
+#include "../InterfaceSnapshots.hpp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#include <cassert>
+#include <utility>
+
+namespace OddSource::Interfaces
+{
+    OddSource_Inline
+    InterfaceSnapshots::Reader::
+    Reader(
+        InterfaceSnapshots const & snapshots )
+        : _snapshots( snapshots ),
+          _version( 0 )
+    {
+        this->update();
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< InterfaceBrowser const > const &
+    InterfaceSnapshots::Reader::
+    pointer() const
+    {
+        return this->_snapshot;
+    }
+
+    OddSource_Inline
+    void
+    InterfaceSnapshots::Reader::
+    update()
+    {
+        // the version is read under the lock so that it always matches the snapshot
+        ::std::lock_guard< ::std::mutex > const lock( this->_snapshots._mutex );
+        this->_snapshot = this->_snapshots._snapshot;
+        this->_version = this->_snapshots._version.load( ::std::memory_order_relaxed );
+    }
+
+    OddSource_Inline
+    InterfaceSnapshots::
+    InterfaceSnapshots(
+        EnumerationOptions const & options )
+        : InterfaceSnapshots( ::std::make_shared< InterfaceBrowser const >( options ) )
+    {
+    }
+
+    OddSource_Inline
+    InterfaceSnapshots::
+    InterfaceSnapshots(
+        ::std::shared_ptr< InterfaceBrowser const > initial )
+        : _version( 1 ),
+          _snapshot( ::std::move( initial ) )
+    {
+        assert( this->_snapshot );
+    }
+
+    OddSource_Inline
+    InterfaceSnapshots::
+    ~InterfaceSnapshots() noexcept
+    {
+    }
+
+    OddSource_Inline
+    void
+    InterfaceSnapshots::
+    publish(
+        ::std::shared_ptr< InterfaceBrowser const > snapshot )
+    {
+        assert( snapshot );
+        ::std::lock_guard< ::std::mutex > const lock( this->_writerMutex );
+        this->install( ::std::move( snapshot ) );
+    }
+
+    OddSource_Inline
+    void
+    InterfaceSnapshots::
+    install(
+        ::std::shared_ptr< InterfaceBrowser const > snapshot )
+    {
+        {
+            ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+            this->_snapshot.swap( snapshot );
+            this->_version.fetch_add( 1, ::std::memory_order_release );
+        }
+        // the previous snapshot, now in snapshot, is released outside the lock if this was its last holder
+    }
+
+    OddSource_Inline
+    ::std::vector< InterfaceEvent >
+    InterfaceSnapshots::
+    refresh()
+    {
+        // held from load to install, so that a concurrent refresh cannot compare against the same snapshot
+        ::std::lock_guard< ::std::mutex > const lock( this->_writerMutex );
+        auto const pCurrent( this->load() );
+        ::std::vector< InterfaceEvent > changes;
+        this->install( ::std::make_shared< InterfaceBrowser const >( *pCurrent, changes ) );
+        return changes;
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< InterfaceBrowser const >
+    InterfaceSnapshots::
+    load() const
+    {
+        ::std::lock_guard< ::std::mutex > const lock( this->_mutex );
+        return this->_snapshot;
+    }
+
+    OddSource_Inline
+    ::std::uint64_t
+    InterfaceSnapshots::
+    version() const
+    {
+        return this->_version.load( ::std::memory_order_acquire );
+    }
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef IFADDRS4CPP_INLINE_SOURCE
+#include "../InterfaceTable.hpp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+namespace OddSource::Interfaces
+{
+    OddSource_Inline
+    InterfaceTable::
+    InterfaceTable(
+        InterfaceBrowser const & browser )
+        : _interfaces( browser.get_interfaces().begin(), browser.get_interfaces().end() )
+    {
+        ::std::size_t ipv4Count{ 0 };
+        ::std::size_t ipv6Count{ 0 };
+        for ( auto const & pInterface : this->_interfaces )
+        {
+            ipv4Count += pInterface->ipv4_addresses().size();
+            ipv6Count += pInterface->ipv6_addresses().size();
+        }
+
+        auto const rows( this->_interfaces.size() );
+        this->_indexes.reserve( rows );
+        this->_flags.reserve( rows );
+        this->_mtus.reserve( rows );
+        this->_ipv4Offsets.reserve( rows + 1 );
+        this->_ipv6Offsets.reserve( rows + 1 );
+        this->_ipv4Rows.reserve( ipv4Count );
+        this->_ipv4Addresses.reserve( ipv4Count );
+        this->_ipv4PrefixLengths.reserve( ipv4Count );
+        this->_ipv4Flags.reserve( ipv4Count );
+        this->_ipv6Rows.reserve( ipv6Count );
+        this->_ipv6Addresses.reserve( ipv6Count );
+        this->_ipv6PrefixLengths.reserve( ipv6Count );
+        this->_ipv6Flags.reserve( ipv6Count );
+        this->_ipv6ScopeIds.reserve( ipv6Count );
+
+        ::std::uint32_t row{ 0 };
+        for ( auto const & pInterface : this->_interfaces )
+        {
+            this->_indexes.push_back( pInterface->index() );
+            this->_flags.push_back( pInterface->flags() );
+            this->_mtus.push_back( pInterface->mtu().value_or( NO_MTU ) );
+
+            this->_ipv4Offsets.push_back( static_cast< ::std::uint32_t >( this->_ipv4Addresses.size() ) );
+            for ( auto const & address : pInterface->ipv4_addresses() )
+            {
+                this->_ipv4Rows.push_back( row );
+                this->_ipv4Addresses.push_back( static_cast< ::std::uint32_t >( address.address() ) );
+                this->_ipv4PrefixLengths.push_back( address.prefix_length().value_or( 0 ) );
+                this->_ipv4Flags.push_back( address.flags() );
+            }
+
+            this->_ipv6Offsets.push_back( static_cast< ::std::uint32_t >( this->_ipv6Addresses.size() ) );
+            for ( auto const & address : pInterface->ipv6_addresses() )
+            {
+                this->_ipv6Rows.push_back( row );
+                this->_ipv6Addresses.push_back( static_cast< IPv6Address::Bytes >( address.address() ) );
+                this->_ipv6PrefixLengths.push_back( address.prefix_length().value_or( 0 ) );
+                this->_ipv6Flags.push_back( address.flags() );
+                this->_ipv6ScopeIds.push_back( address.address().scope_id().value_or( 0 ) );
+            }
+            ++row;
+        }
+        this->_ipv4Offsets.push_back( static_cast< ::std::uint32_t >( this->_ipv4Addresses.size() ) );
+        this->_ipv6Offsets.push_back( static_cast< ::std::uint32_t >( this->_ipv6Addresses.size() ) );
+    }
+
+    OddSource_Inline
+    ::std::size_t
+    InterfaceTable::
+    size() const
+    {
+        return this->_interfaces.size();
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::shared_ptr< Interface const > > const &
+    InterfaceTable::
+    interfaces() const
+    {
+        return this->_interfaces;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    InterfaceTable::
+    indexes() const
+    {
+        return this->_indexes;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    InterfaceTable::
+    flags() const
+    {
+        return this->_flags;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint64_t > const &
+    InterfaceTable::
+    mtus() const
+    {
+        return this->_mtus;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    InterfaceTable::
+    ipv4_offsets() const
+    {
+        return this->_ipv4Offsets;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    InterfaceTable::
+    ipv4_rows() const
+    {
+        return this->_ipv4Rows;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    InterfaceTable::
+    ipv4_addresses() const
+    {
+        return this->_ipv4Addresses;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint8_t > const &
+    InterfaceTable::
+    ipv4_prefix_lengths() const
+    {
+        return this->_ipv4PrefixLengths;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint16_t > const &
+    InterfaceTable::
+    ipv4_flags() const
+    {
+        return this->_ipv4Flags;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    InterfaceTable::
+    ipv6_offsets() const
+    {
+        return this->_ipv6Offsets;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    InterfaceTable::
+    ipv6_rows() const
+    {
+        return this->_ipv6Rows;
+    }
+
+    OddSource_Inline
+    ::std::vector< IPv6Address::Bytes > const &
+    InterfaceTable::
+    ipv6_addresses() const
+    {
+        return this->_ipv6Addresses;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint8_t > const &
+    InterfaceTable::
+    ipv6_prefix_lengths() const
+    {
+        return this->_ipv6PrefixLengths;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint16_t > const &
+    InterfaceTable::
+    ipv6_flags() const
+    {
+        return this->_ipv6Flags;
+    }
+
+    OddSource_Inline
+    ::std::vector< ::std::uint32_t > const &
+    InterfaceTable::
+    ipv6_scope_ids() const
+    {
+        return this->_ipv6ScopeIds;
+    }
+}
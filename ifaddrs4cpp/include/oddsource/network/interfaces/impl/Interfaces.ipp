@@ -20,17 +20,24 @@
 #include "../Interfaces.hpp"
 #endif /* IFADDRS4CPP_INLINE_SOURCE */
 
+#include "../InterfaceProvider.hpp"
+#include "../detail/builder.hpp"
+
 #ifdef ODDSOURCE_IS_WINDOWS
 
 #include "winsock_includes.h"
 
 #else /* ODDSOURCE_IS_WINDOWS */
 
+#include "../detail/netlink.hpp"
+#include "../detail/system_error.hpp"
+
 #include <cerrno>
 #include <cstring>
 #include <ifaddrs.h>
 #include <net/if.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -54,22 +61,166 @@
 
 #endif /* !ODDSOURCE_IS_WINDOWS */
 
+#include <algorithm>
 #include <cassert>
+#include <climits>
+#include <condition_variable>
+#include <exception>
 #include <functional>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 // ReSharper disable once CppUnnamedNamespaceInHeaderFile
 namespace
 {
+    bool
+    _includesFamily(
+        AddressFamilies const families,
+        AddressFamilies const family )
+    {
+        return ( static_cast< ::std::uint8_t >( families ) & static_cast< ::std::uint8_t >( family ) ) != 0;
+    }
+
+    /**
+     * Splits a name's hash into the tag stored in the name table and the slot its probe starts at.
+     */
+    ::std::pair< ::std::uint32_t, ::std::size_t >
+    _nameHash(
+        ::std::string_view const & name,
+        ::std::size_t const slots )
+    {
+        auto const hash( ::std::hash< ::std::string_view >()( name ) );
+        auto const tag( static_cast< ::std::uint32_t >( static_cast< ::std::uint64_t >( hash ) >> 32 ) );
+        return { tag, hash & ( slots - 1 ) };
+    }
+
+    /**
+     * Compares everything but the addresses.
+     */
+    bool
+    _isSameLink(
+        Interface const & lhs,
+        Interface const & rhs )
+    {
+        return lhs.index() == rhs.index() &&
+               lhs.flags() == rhs.flags() &&
+               lhs.mtu() == rhs.mtu() &&
+               lhs.mac_address() == rhs.mac_address() &&
+               lhs.name_view() == rhs.name_view() &&
+               lhs.friendly_name_view() == rhs.friendly_name_view() &&
+               lhs.description_view() == rhs.description_view();
+    }
+
+    void
+    _appendLinkEvent(
+        ::std::vector< InterfaceEvent > & events,
+        InterfaceEventType const type,
+        ::std::shared_ptr< Interface const > const & pInterface )
+    {
+        InterfaceEvent & event( events.emplace_back() );
+        event.type = type;
+        event.index = pInterface->index();
+        event.name = pInterface->name();
+        event.link = pInterface;
+    }
+
+    /**
+     * Tells the installed scope resolver to forget what it remembered about a link that changed.
+     */
+    void
+    _invalidateScope(
+        InterfaceEvent const & event )
+    {
+        switch ( event.type )
+        {
+            case InterfaceEventType::LinkAdded:
+            case InterfaceEventType::LinkRemoved:
+            case InterfaceEventType::LinkChanged:
+                ScopeResolver::installed().invalidate( event.index, event.name );
+                break;
+            case InterfaceEventType::Overflow:
+                ScopeResolver::installed().invalidate();
+                break;
+            default:
+                break;
+        }
+    }
+
+    void
+    _setEventAddress(
+        InterfaceEvent & event,
+        InterfaceIPv4Address const & address )
+    {
+        event.ipv4_address.emplace( address );
+    }
+
+    void
+    _setEventAddress(
+        InterfaceEvent & event,
+        InterfaceIPv6Address const & address )
+    {
+        event.ipv6_address.emplace( address );
+    }
+
+    /**
+     * Appends an event for each of the interface's addresses that isn't also in the excluded list.
+     */
+    template< class IPAddressT >
+    void
+    _appendAddressEvents(
+        ::std::vector< InterfaceEvent > & events,
+        InterfaceEventType const type,
+        Interface const & rInterface,
+        ::std::vector< InterfaceIPAddress< IPAddressT > > const & addresses,
+        ::std::vector< InterfaceIPAddress< IPAddressT > > const & excluded )
+    {
+        for ( auto const & address : addresses )
+        {
+            if ( ::std::find( excluded.begin(), excluded.end(), address ) != excluded.end() )
+            {
+                continue;
+            }
+            InterfaceEvent & event( events.emplace_back() );
+            event.type = type;
+            event.index = rInterface.index();
+            event.name = rInterface.name();
+            _setEventAddress( event, address );
+        }
+    }
+
+    /**
+     * Returns the options with the arena turned off. A refresh enumerates this way: the interfaces it keeps from
+     * the previous snapshot would otherwise hold that snapshot's arena alive, and the new interfaces this one's,
+     * so that each refresh could leave another arena behind. This way only the first snapshot has an arena.
+     */
+    EnumerationOptions
+    _withoutArena(
+        EnumerationOptions options )
+    {
+        options.arena = false;
+        return options;
+    }
+
+    template< typename Builder >
     void
     populateInterfaces(
         ::std::list< ::std::string > & warnings,
         ::std::list< ::std::shared_ptr< Interface const > > & interfaces,
-        ::std::function< void( Interface &, MacAddress && ) > setMacAddress,
-        ::std::function< void( Interface &, InterfaceIPv4Address && ) > addIPv4Address,
-        ::std::function< void( Interface &, InterfaceIPv6Address && ) > addIPv6Address );
+        EnumerationOptions const & options,
+        Builder const & builder );
+
+#ifdef ODDSOURCE_HAS_NETLINK
+    template< typename Builder >
+    void
+    populateInterfacesNetlink(
+        ::std::list< ::std::string > & warnings,
+        ::std::list< ::std::shared_ptr< Interface const > > & interfaces,
+        EnumerationOptions const & options,
+        Builder const & builder );
+#endif /* ODDSOURCE_HAS_NETLINK */
 }
 
 namespace OddSource::Interfaces
@@ -123,29 +274,244 @@ namespace OddSource::Interfaces
     OddSource_Inline
     InterfaceBrowser::
     InterfaceBrowser()
+        : InterfaceBrowser( EnumerationBackend::Automatic )
+    {
+    }
+
+    OddSource_Inline
+    InterfaceBrowser::
+    InterfaceBrowser(
+        EnumerationBackend const backend )
+        : InterfaceBrowser( EnumerationOptions { backend } )
+    {
+    }
+
+    OddSource_Inline
+    InterfaceBrowser::
+    InterfaceBrowser(
+        EnumerationOptions const & options )
+        : _options( options ),
+          _backend( InterfaceBrowser::enumerate( options, this->_warnings, this->_interfaces ) )
+    {
+        this->index();
+    }
+
+    OddSource_Inline
+    InterfaceBrowser::
+    InterfaceBrowser(
+        EnumerationOptions const & options,
+        EnumerationBackend const backend,
+        ::std::list< ::std::string > && warnings,
+        ::std::list< ::std::shared_ptr< Interface const > > && interfaces )
+        : _options( options ),
+          _interfaces( ::std::move( interfaces ) ),
+          _warnings( ::std::move( warnings ) ),
+          _backend( backend )
+    {
+        this->index();
+    }
+
+    OddSource_Inline
+    InterfaceBrowser::
+    InterfaceBrowser(
+        InterfaceBrowser const & previous,
+        ::std::vector< InterfaceEvent > & changes )
+        : _options( previous._options ),
+          _backend( InterfaceBrowser::enumerate( _withoutArena( this->_options ), this->_warnings, this->_interfaces ) )
+    {
+        changes = this->share( previous );
+        this->index();
+    }
+
+    OddSource_Inline
+    EnumerationBackend
+    InterfaceBrowser::
+    enumerate(
+        EnumerationOptions const & options,
+        ::std::list< ::std::string > & warnings,
+        ::std::list< ::std::shared_ptr< Interface const > > & interfaces )
     {
+        detail::InterfaceBuilder const builder;
+
+        if ( options.provider )
+        {
+            InterfaceCollector collector( options, warnings, interfaces );
+            options.provider->populate( collector );
+            return EnumerationBackend::Provider;
+        }
+        if ( options.backend == EnumerationBackend::Provider )
+        {
+            throw InterfaceBrowserSystemError( "The provider enumeration backend requires EnumerationOptions::provider." );
+        }
+
+#ifdef ODDSOURCE_HAS_NETLINK
+        if ( options.backend != EnumerationBackend::Portable )
+        {
+            try
+            {
+                populateInterfacesNetlink(
+                    warnings,
+                    interfaces,
+                    options,
+                    builder );
+                return EnumerationBackend::Netlink;
+            }
+            catch ( InterfaceBrowserSystemError const & e )
+            {
+                if ( options.backend == EnumerationBackend::Netlink )
+                {
+                    throw;
+                }
+                using namespace ::std::string_literals;
+                interfaces.clear();
+                warnings.clear();
+                warnings.push_back( "Netlink enumeration failed, falling back to getifaddrs: "s + e.what() );
+            }
+        }
+#else /* ODDSOURCE_HAS_NETLINK */
+        if ( options.backend == EnumerationBackend::Netlink )
+        {
+            throw InterfaceBrowserSystemError( "The netlink enumeration backend is not available on this platform." );
+        }
+#endif /* !ODDSOURCE_HAS_NETLINK */
+
         populateInterfaces(
-            this->_warnings,
-            this->_interfaces,
-            []( Interface & rInterface, MacAddress && macAddress )
-            { rInterface._macAddress.emplace( std::move( macAddress ) ); },
-            []( Interface & rInterface, InterfaceIPv4Address && ipAddress )
-            { rInterface._ipv4Addresses.push_back( std::move( ipAddress ) ); },
-            []( Interface & rInterface, InterfaceIPv6Address && ipAddress )
-            { rInterface._ipv6Addresses.push_back( std::move( ipAddress ) ); } );
+            warnings,
+            interfaces,
+            options,
+            builder );
+        return EnumerationBackend::Portable;
+    }
+
+    OddSource_Inline
+    void
+    InterfaceBrowser::
+    index()
+    {
+        // indexes are dense on most hosts, so up to this many slots per interface are spent to skip the search
+        static constexpr ::std::size_t const DENSE_SLOTS_PER_INTERFACE{ 4 };
+        static constexpr ::std::size_t const MINIMUM_DENSE_SLOTS{ 256 };
 
+        this->_byIndex.clear();
+        this->_byIndex.reserve( this->_interfaces.size() );
         for ( auto const & pInterface : this->_interfaces )
         {
-            this->_indexToInterface.emplace( pInterface->index(), pInterface );
-            this->_nameToInterface.emplace( pInterface->name(), pInterface );
-#ifdef ODDSOURCE_IS_WINDOWS
-            if ( pInterface->name() != pInterface->description() &&
-                 this->_nameToInterface.find( pInterface->description() ) == this->_nameToInterface.end() )
+            this->_byIndex.push_back( { pInterface->index(), pInterface } );
+        }
+        ::std::stable_sort(
+            this->_byIndex.begin(),
+            this->_byIndex.end(),
+            []( IndexEntry const & lhs, IndexEntry const & rhs ) { return lhs.index < rhs.index; } );
+        this->_byIndex.erase(
+            ::std::unique(
+                this->_byIndex.begin(),
+                this->_byIndex.end(),
+                []( IndexEntry const & lhs, IndexEntry const & rhs ) { return lhs.index == rhs.index; } ),
+            this->_byIndex.end() );
+
+        this->_denseIndexes.clear();
+        if ( !this->_byIndex.empty() )
+        {
+            this->_denseIndexes.resize( ::std::min< ::std::size_t >(
+                static_cast< ::std::size_t >( this->_byIndex.back().index ) + 1,
+                ::std::max( this->_byIndex.size() * DENSE_SLOTS_PER_INTERFACE, MINIMUM_DENSE_SLOTS ) ) );
+            for ( ::std::size_t position{ 0 }; position < this->_byIndex.size(); ++position )
             {
-                this->_nameToInterface.emplace( pInterface->description(), pInterface );
+                auto const index( this->_byIndex[ position ].index );
+                if ( index >= this->_denseIndexes.size() )
+                {
+                    break;
+                }
+                this->_denseIndexes[ index ] = static_cast< ::std::uint32_t >( position + 1 );
             }
+        }
+
+        // names win over Windows descriptions, and earlier interfaces over later ones
+        ::std::size_t slots{ 16 };
+        while ( slots < this->_interfaces.size() * 4 )
+        {
+            slots *= 2;
+        }
+        this->_byName.clear();
+        this->_byName.reserve( this->_interfaces.size() );
+        this->_nameSlots.assign( slots, NameSlot { 0, 0 } );
+        for ( auto const & pInterface : this->_interfaces )
+        {
+            this->indexName( pInterface->name_view(), pInterface );
+        }
+#ifdef ODDSOURCE_IS_WINDOWS
+        for ( auto const & pInterface : this->_interfaces )
+        {
+            this->indexName( pInterface->description_view(), pInterface );
+        }
 #endif /* ODDSOURCE_IS_WINDOWS */
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< Interface const > const *
+    InterfaceBrowser::
+    findIndex(
+        ::std::uint32_t const index ) const
+    {
+        if ( index < this->_denseIndexes.size() )
+        {
+            auto const position( this->_denseIndexes[ index ] );
+            return position == 0 ? nullptr : &this->_byIndex[ position - 1 ].pInterface;
+        }
+        auto const found( ::std::lower_bound(
+            this->_byIndex.begin(),
+            this->_byIndex.end(),
+            index,
+            []( IndexEntry const & entry, ::std::uint32_t const value ) { return entry.index < value; } ) );
+        return found != this->_byIndex.end() && found->index == index ? &found->pInterface : nullptr;
+    }
+
+    OddSource_Inline
+    void
+    InterfaceBrowser::
+    indexName(
+        ::std::string_view const & name,
+        ::std::shared_ptr< Interface const > const & pInterface )
+    {
+        auto const mask( this->_nameSlots.size() - 1 );
+        auto [ tag, slot ] = _nameHash( name, this->_nameSlots.size() );
+        for ( ; this->_nameSlots[ slot ].entry != 0; slot = ( slot + 1 ) & mask )
+        {
+            auto const & existing( this->_nameSlots[ slot ] );
+            if ( existing.tag == tag && this->_byName[ existing.entry - 1 ].name == name )
+            {
+                return;
+            }
+        }
+        this->_byName.push_back( { name, pInterface } );
+        this->_nameSlots[ slot ] = { tag, static_cast< ::std::uint32_t >( this->_byName.size() ) };
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< Interface const > const *
+    InterfaceBrowser::
+    findName(
+        ::std::string_view const & name ) const
+    {
+        if ( this->_nameSlots.empty() )
+        {
+            return nullptr;
         }
+        auto const mask( this->_nameSlots.size() - 1 );
+        auto [ tag, slot ] = _nameHash( name, this->_nameSlots.size() );
+        for ( ; this->_nameSlots[ slot ].entry != 0; slot = ( slot + 1 ) & mask )
+        {
+            auto const & candidate( this->_nameSlots[ slot ] );
+            if ( candidate.tag == tag )
+            {
+                auto const & entry( this->_byName[ candidate.entry - 1 ] );
+                if ( entry.name == name )
+                {
+                    return &entry.pInterface;
+                }
+            }
+        }
+        return nullptr;
     }
 
     OddSource_Inline
@@ -154,6 +520,123 @@ namespace OddSource::Interfaces
     {
     }
 
+    OddSource_Inline
+    ::std::shared_ptr< Interface const >
+    InterfaceBrowser::
+    lookup(
+        ::std::string_view name,
+        EnumerationOptions const & options )
+    {
+        EnumerationOptions filtered( options );
+        filtered.name.emplace( name );
+        filtered.index.reset();
+        InterfaceBrowser const browser( filtered );
+        return browser._interfaces.empty() ? nullptr : browser._interfaces.front();
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< Interface const >
+    InterfaceBrowser::
+    lookup(
+        ::std::uint32_t index,
+        EnumerationOptions const & options )
+    {
+        EnumerationOptions filtered( options );
+        filtered.name.reset();
+        filtered.index.emplace( index );
+        InterfaceBrowser const browser( filtered );
+        return browser._interfaces.empty() ? nullptr : browser._interfaces.front();
+    }
+
+    struct InterfaceBrowser::SharedState
+    {
+        ::std::mutex mutex;
+        ::std::condition_variable finished;
+        ::std::shared_ptr< InterfaceBrowser const > snapshot;
+        ::std::chrono::steady_clock::time_point snapshotStarted;
+        ::std::exception_ptr error;
+        ::std::uint64_t generation{ 0 };
+        bool inFlight{ false };
+    };
+
+    OddSource_Inline
+    InterfaceBrowser::SharedState &
+    InterfaceBrowser::
+    sharedState()
+    {
+        static SharedState state;
+        return state;
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< InterfaceBrowser const >
+    InterfaceBrowser::
+    shared(
+        ::std::chrono::milliseconds const max_age )
+    {
+        using clock = ::std::chrono::steady_clock;
+        auto & state( InterfaceBrowser::sharedState() );
+
+        ::std::unique_lock< ::std::mutex > lock( state.mutex );
+        if ( state.snapshot && clock::now() - state.snapshotStarted <= max_age )
+        {
+            return state.snapshot;
+        }
+        if ( state.inFlight )
+        {
+            // the enumeration in progress started after this call's cached snapshot expired, so it is new enough
+            auto const generation( state.generation );
+            state.finished.wait( lock, [ &state, generation ] { return state.generation != generation; } );
+            if ( state.error )
+            {
+                ::std::rethrow_exception( state.error );
+            }
+            return state.snapshot;
+        }
+
+        state.inFlight = true;
+        auto const pPrevious( state.snapshot );
+        lock.unlock();
+
+        auto const started( clock::now() );
+        ::std::shared_ptr< InterfaceBrowser const > pSnapshot;
+        ::std::exception_ptr error;
+        try
+        {
+            if ( pPrevious )
+            {
+                ::std::vector< InterfaceEvent > changes;
+                pSnapshot = ::std::make_shared< InterfaceBrowser const >( *pPrevious, changes );
+            }
+            else
+            {
+                pSnapshot = ::std::make_shared< InterfaceBrowser const >();
+            }
+        }
+        catch ( ... )
+        {
+            error = ::std::current_exception();
+        }
+
+        lock.lock();
+        state.error = error;
+        if ( pSnapshot )
+        {
+            state.snapshot = pSnapshot;
+            state.snapshotStarted = started;
+        }
+        state.inFlight = false;
+        ++state.generation;
+        lock.unlock();
+        state.finished.notify_all();
+
+        if ( error )
+        {
+            ::std::rethrow_exception( error );
+        }
+        return pSnapshot;
+    }
+
     OddSource_Inline
     bool
     InterfaceBrowser::
@@ -182,11 +665,8 @@ namespace OddSource::Interfaces
     get_interface(
         ::std::uint32_t index ) const
     {
-        if ( auto const found( this->_indexToInterface.find( index ) ); found != this->_indexToInterface.end() )
-        {
-            return found->second;
-        }
-        return nullptr;
+        auto const found( this->findIndex( index ) );
+        return found ? *found : nullptr;
     }
 
     OddSource_Inline
@@ -196,9 +676,9 @@ namespace OddSource::Interfaces
         ::std::uint32_t index ) const
     {
         using namespace std::string_literals;
-        if ( auto const found( this->_indexToInterface.find( index ) ); found != this->_indexToInterface.end() )
+        if ( auto const found( this->findIndex( index ) ); found != nullptr )
         {
-            return *found->second;
+            return **found;
         }
         throw ::std::out_of_range( "interface index not found: "s + std::to_string( index ) );
     }
@@ -209,12 +689,8 @@ namespace OddSource::Interfaces
     get_interface(
         ::std::string_view name ) const
     {
-        if ( auto const found( this->_nameToInterface.find( std::string( name ) ) );
-             found != this->_nameToInterface.end() )
-        {
-            return found->second;
-        }
-        return nullptr;
+        auto const found( this->findName( name ) );
+        return found ? *found : nullptr;
     }
 
     OddSource_Inline
@@ -224,10 +700,9 @@ namespace OddSource::Interfaces
         ::std::string_view name ) const
     {
         using namespace std::string_literals;
-        if ( auto const found( this->_nameToInterface.find( std::string( name ) ) );
-             found != this->_nameToInterface.end() )
+        if ( auto const found( this->findName( name ) ); found != nullptr )
         {
-            return *found->second;
+            return **found;
         }
         throw ::std::out_of_range( "interface name not found: "s + std::string( name ) );
     }
@@ -239,6 +714,137 @@ namespace OddSource::Interfaces
     {
         return this->_warnings;
     }
+
+    OddSource_Inline
+    EnumerationBackend
+    InterfaceBrowser::
+    backend() const
+    {
+        return this->_backend;
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< TableScopeResolver >
+    InterfaceBrowser::
+    scope_resolver() const
+    {
+        ::std::vector< ::std::pair< ::std::uint32_t, ::std::string > > scopes;
+        scopes.reserve( this->_interfaces.size() );
+        for ( auto const & pInterface : this->_interfaces )
+        {
+#ifdef ODDSOURCE_IS_WINDOWS
+            // an interface's name is its adapter GUID, which is too long to be a scope, so use the name the
+            // system resolver would give
+            char buffer[ IF_NAMESIZE ] {};
+            if ( ::if_indextoname( pInterface->index(), buffer ) == nullptr )
+            {
+                continue;
+            }
+            ::std::string name( buffer );
+#else /* ODDSOURCE_IS_WINDOWS */
+            ::std::string const name( pInterface->name() );
+#endif /* ODDSOURCE_IS_WINDOWS */
+            // IPv6Address cannot keep a longer name, so leave it out rather than make addresses fail
+            if ( name.length() <= IPv6Address::MAX_SCOPE_NAME_LENGTH )
+            {
+                scopes.emplace_back( pInterface->index(), name );
+            }
+        }
+        return ::std::make_shared< TableScopeResolver >( scopes );
+    }
+
+    OddSource_Inline
+    ::std::vector< InterfaceEvent >
+    InterfaceBrowser::
+    refresh()
+    {
+        ::std::vector< InterfaceEvent > changes;
+        InterfaceBrowser next( *this, changes );
+        this->_interfaces.swap( next._interfaces );
+        this->_byIndex.swap( next._byIndex );
+        this->_denseIndexes.swap( next._denseIndexes );
+        this->_byName.swap( next._byName );
+        this->_nameSlots.swap( next._nameSlots );
+        this->_warnings.swap( next._warnings );
+        this->_backend = next._backend;
+        return changes;
+    }
+
+    OddSource_Inline
+    ::std::vector< InterfaceEvent >
+    InterfaceBrowser::
+    share(
+        InterfaceBrowser const & previous )
+    {
+        ::std::vector< InterfaceEvent > changes;
+        ::std::unordered_map< ::std::uint32_t, ::std::shared_ptr< Interface const > > unmatched;
+        for ( auto const & entry : previous._byIndex )
+        {
+            unmatched.emplace( entry.index, entry.pInterface );
+        }
+        for ( auto & pInterface : this->_interfaces )
+        {
+            auto const found( unmatched.find( pInterface->index() ) );
+            if ( found == unmatched.end() )
+            {
+                _appendLinkEvent( changes, InterfaceEventType::LinkAdded, pInterface );
+                _appendAddressEvents( changes, InterfaceEventType::AddressAdded, *pInterface, pInterface->ipv4_addresses(), {} );
+                _appendAddressEvents( changes, InterfaceEventType::AddressAdded, *pInterface, pInterface->ipv6_addresses(), {} );
+                continue;
+            }
+
+            auto const pPrevious( ::std::move( found->second ) );
+            unmatched.erase( found );
+            bool const sameLink( _isSameLink( *pPrevious, *pInterface ) );
+            bool const sameIPv4( pPrevious->ipv4_addresses() == pInterface->ipv4_addresses() );
+            bool const sameIPv6( pPrevious->ipv6_addresses() == pInterface->ipv6_addresses() );
+            if ( sameLink && sameIPv4 && sameIPv6 )
+            {
+                pInterface = pPrevious;
+                continue;
+            }
+
+            if ( !sameLink )
+            {
+                _appendLinkEvent( changes, InterfaceEventType::LinkChanged, pInterface );
+            }
+            if ( !sameIPv4 )
+            {
+                _appendAddressEvents(
+                    changes, InterfaceEventType::AddressRemoved, *pPrevious,
+                    pPrevious->ipv4_addresses(), pInterface->ipv4_addresses() );
+                _appendAddressEvents(
+                    changes, InterfaceEventType::AddressAdded, *pInterface,
+                    pInterface->ipv4_addresses(), pPrevious->ipv4_addresses() );
+            }
+            if ( !sameIPv6 )
+            {
+                _appendAddressEvents(
+                    changes, InterfaceEventType::AddressRemoved, *pPrevious,
+                    pPrevious->ipv6_addresses(), pInterface->ipv6_addresses() );
+                _appendAddressEvents(
+                    changes, InterfaceEventType::AddressAdded, *pInterface,
+                    pInterface->ipv6_addresses(), pPrevious->ipv6_addresses() );
+            }
+        }
+
+        // whatever was not matched above is gone; report those in the order they were enumerated before
+        for ( auto const & pPrevious : previous._interfaces )
+        {
+            if ( unmatched.find( pPrevious->index() ) != unmatched.end() )
+            {
+                _appendAddressEvents( changes, InterfaceEventType::AddressRemoved, *pPrevious, pPrevious->ipv4_addresses(), {} );
+                _appendAddressEvents( changes, InterfaceEventType::AddressRemoved, *pPrevious, pPrevious->ipv6_addresses(), {} );
+                _appendLinkEvent( changes, InterfaceEventType::LinkRemoved, pPrevious );
+            }
+        }
+
+        for ( auto const & event : changes )
+        {
+            _invalidateScope( event );
+        }
+        return changes;
+    }
 }
 
 #ifndef ODDSOURCE_IS_WINDOWS
@@ -249,14 +855,6 @@ namespace OddSource::Interfaces
 #    define ODDSOURCE_AF_MAC_ADDRESS AF_PACKET
 #  endif /* AF_LINK */
 
-#  if defined(__clang__) && ODDSOURCE_IS_MACOS
-#    define STRERROR_R_RETURNS_INT 1
-#  elif ( _POSIX_C_SOURCE >= 200112L || _XOPEN_SOURCE >= 600 ) && !_GNU_SOURCE
-#    define STRERROR_R_RETURNS_INT 1
-#  else
-#    define STRERROR_R_RETURNS_INT 0
-#  endif
-
 #endif /* ODDSOURCE_IS_WINDOWS */
 
 // ReSharper disable once CppUnnamedNamespaceInHeaderFile
@@ -423,10 +1021,11 @@ namespace
         }
     }
 
+    template< typename Builder >
     void
     _addIPv4Address(
         ::std::list< ::std::string > & /* warnings */,
-        ::std::function< void( Interface &, InterfaceIPv4Address && ) > addIPv4Address,
+        Builder const & builder,
         Interface & rInterface,
         bool & isBroadcast,
         LPSOCKADDR sa,
@@ -479,7 +1078,7 @@ namespace
         static constexpr ::std::uint32_t const flags{ 0 };
         if ( broadcast )
         {
-            addIPv4Address( rInterface, InterfaceIPv4Address(
+            builder.addIPv4Address( rInterface, InterfaceIPv4Address(
                 address,
                 flags,
                 prefixLength,
@@ -488,17 +1087,18 @@ namespace
         }
         else
         {
-            addIPv4Address( rInterface, InterfaceIPv4Address(
+            builder.addIPv4Address( rInterface, InterfaceIPv4Address(
                 address,
                 flags,
                 prefixLength );
         }
     }
 
+    template< typename Builder >
     void
     _addIPv6Address(
         ::std::list< ::std::string > & /* warnings */,
-        ::std::function< void( Interface &, InterfaceIPv6Address && ) > addIPv6Address,
+        Builder const & builder,
         Interface & rInterface,
         LPSOCKADDR sa,
         ::std::uint8_t const prefixLength,
@@ -507,30 +1107,34 @@ namespace
         auto addr( reinterpret_cast< sockaddr_in6 * >( sa ) );
         if ( addr->sin6_scope_id )
         {
-            addIPv6Address( rInterface, InterfaceIPv6Address(
+            builder.addIPv6Address( rInterface, InterfaceIPv6Address(
                 IPv6Address( &addr->sin6_addr, addr->sin6_scope_id ),
                 flags,
                 prefixLength ) );
         }
         else
         {
-            addIPv6Address( rInterface, InterfaceIPv6Address(
+            builder.addIPv6Address( rInterface, InterfaceIPv6Address(
                 IPv6Address( &addr->sin6_addr ),
                 flags,
                 prefixLength ) );
         }
     }
 
+    template< typename Builder >
     void
     populateInterfaces(
         ::std::list< ::std::string > & warnings,
         ::std::list< ::std::shared_ptr< Interface const > > & interfaces,
-        ::std::function< void( Interface &, MacAddress && ) > setMacAddress,
-        ::std::function< void( Interface &, InterfaceIPv4Address && ) > addIPv4Address,
-        ::std::function< void( Interface &, InterfaceIPv6Address && ) > addIPv6Address )
+        EnumerationOptions const & options,
+        Builder const & builder )
     {
         using namespace ::std::string_literals;
 
+        bool const includeIPv4( _includesFamily( options.address_families, AddressFamilies::IPv4 ) );
+        bool const includeIPv6( _includesFamily( options.address_families, AddressFamilies::IPv6 ) );
+        detail::SnapshotAllocator const allocator( options.arena );
+
         ::std::unique_ptr< IP_ADAPTER_ADDRESSES, decltype( &freeIpAdapterAddresses ) > pAdapterAddresses(
             nullptr,
             &freeIpAdapterAddresses );
@@ -538,7 +1142,12 @@ namespace
         {
             DWORD result{ 0 };
             ULONG iterations{ 0 };
-            ULONG const flags{ GAA_FLAG_INCLUDE_PREFIX | GAA_FLAG_SKIP_MULTICAST | GAA_FLAG_SKIP_DNS_SERVER };
+            ULONG flags{ GAA_FLAG_INCLUDE_PREFIX | GAA_FLAG_SKIP_MULTICAST | GAA_FLAG_SKIP_DNS_SERVER };
+            if ( !includeIPv4 && !includeIPv6 )
+            {
+                flags |= GAA_FLAG_SKIP_UNICAST | GAA_FLAG_SKIP_ANYCAST;
+            }
+            ULONG const family( includeIPv4 == includeIPv6 ? AF_UNSPEC : ( includeIPv4 ? AF_INET : AF_INET6 ) );
             ULONG bufferLength{ sizeof( IP_ADAPTER_ADDRESSES ) * 30 };
 
             do
@@ -550,7 +1159,7 @@ namespace
                         "Adapter addresses unexpectedly a null pointer before call to GetAdapterAddresses." );
                 }
 
-                result = ::GetAdaptersAddresses( AF_UNSPEC, flags, nullptr, pAdapterAddresses, &bufferLength );
+                result = ::GetAdaptersAddresses( family, flags, nullptr, pAdapterAddresses, &bufferLength );
                 iterations++;
 
                 if ( result == ERROR_BUFFER_OVERFLOW )
@@ -580,7 +1189,15 @@ namespace
 
         for ( PIP_ADAPTER_ADDRESSES pIfAddr = pAdapterAddresses.get(); pIfAddr != nullptr; pIfAddr = pIfAddr->Next )
         {
-            ::std::uint16_t flags{ 0 };
+            ::std::uint32_t const index{ pIfAddr->IfIndex == 0 ? pIfAddr->Ipv6IfIndex : pIfAddr->IfIndex };
+            if ( ( options.index && *options.index != index ) ||
+                 ( options.name && *options.name != pIfAddr->AdapterName ) ||
+                 ( options.up_only && pIfAddr->OperStatus != IfOperStatusUp ) )
+            {
+                continue;
+            }
+
+            ::std::uint16_t flags{ 0 };
             if ( pIfAddr->IfType == IF_TYPE_SOFTWARE_LOOPBACK )
             {
                 flags |= InterfaceFlag::IsLoopback;
@@ -595,22 +1212,26 @@ namespace
                 flags |= InterfaceFlag::SupportsMulticast;
             }
 
-            ::std::uint32_t const index{ pIfAddr->IfIndex == 0 ? pIfAddr->Ipv6IfIndex : pIfAddr->IfIndex };
             assert( index > 0 );
 
             ::std::string const guid( pIfAddr->AdapterName );
-            auto pInterface( ::std::make_shared< Interface >(
+            ::std::optional< ::std::uint64_t const > mtu;
+            if ( !options.skip_mtu )
+            {
+                mtu.emplace( pIfAddr->Mtu );
+            }
+            auto pInterface( allocator.make_shared< Interface >(
                 index,
                 guid,
                 utf8Encode( ::std::wstring( pIfAddr->FriendlyName ) ),
                 utf8Encode( ::std::wstring( pIfAddr->Description ) ),
                 flags,
-                pIfAddr->Mtu ) );
+                mtu ) );
             interfaces.emplace_back( pInterface );
 
-            if ( pIfAddr->PhysicalAddress && pIfAddr->PhysicalAddressLength > 0 )
+            if ( !options.skip_mac_address && pIfAddr->PhysicalAddress && pIfAddr->PhysicalAddressLength > 0 )
             {
-                setMacAddress( pInterface, MacAddress(
+                builder.setMacAddress( pInterface, MacAddress(
                     pIfAddr->PhysicalAddress,
                     static_cast< ::std::uint8_t >( pIfAddr->PhysicalAddressLength ) ) );
             }
@@ -626,7 +1247,7 @@ namespace
                     bool isBroadcast{ false };
                     _addIPv4Address(
                         warnings,
-                        addIPv4Address,
+                        builder,
                         *pInterface,
                         isBroadcast,
                         sa,
@@ -641,13 +1262,13 @@ namespace
                 else if ( sa->sa_family == AF_INET6 )
                 {
                     ::std::uint16_t flags{ 0 };
-                    if ( pUnicastAddr->SuffixOrigin == IpSuffixOriginRandom )
+                    if ( !options.skip_address_flags && pUnicastAddr->SuffixOrigin == IpSuffixOriginRandom )
                     {
-                        flags |= InterfaceIPAddressFlag::Temporary;
+                        flags = flags | InterfaceIPAddressFlag::Temporary;
                     }
                     _addIPv6Address(
                         warnings,
-                        addIPv6Address,
+                        builder,
                         *pInterface,
                         sa,
                         unicast->OnLinkPrefixLength,
@@ -675,7 +1296,7 @@ namespace
                     bool isBroadcast{ false };
                     _addIPv4Address(
                         warnings,
-                        addIPv4Address,
+                        builder,
                         *pInterface,
                         isBroadcast,
                         sa,
@@ -687,11 +1308,11 @@ namespace
                 {
                     _addIPv6Address(
                         warnings,
-                        addIPv6Address,
+                        builder,
                         *pInterface,
                         sa,
                         0,
-                        0 | InterfaceIPAddressFlag::Anycast );
+                        options.skip_address_flags ? 0 : 0 | InterfaceIPAddressFlag::Anycast );
                 }
                 else
                 {
@@ -726,25 +1347,7 @@ namespace
         }
     };*/
 
-    ::std::string
-    getSystemErrorMessage(
-        int const errorCode )
-    {
-        static constexpr size_t const MAX_LENGTH{ 4096 };
-        char errorMessageBuffer[ MAX_LENGTH ];
-#if STRERROR_R_RETURNS_INT == 1
-        ::std::string errorMessage;
-        if ( int const result( ::strerror_r( errorCode, errorMessageBuffer, MAX_LENGTH ) ); result == 0 )
-        {
-            errorMessage = errorMessageBuffer;
-        }
-#else
-        ::std::string const errorMessage( ::strerror_r( errorCode, errorMessageBuffer, MAX_LENGTH ) );
-#endif
-
-        using namespace ::std::string_literals;
-        return errorMessage.empty() ? "Unknown error"s : errorMessage;
-    }
+    using ::OddSource::Interfaces::detail::getSystemErrorMessage;
 
     ::std::optional< ::std::uint64_t const >
     getMtu(
@@ -784,74 +1387,97 @@ namespace
         return mtu;
     }
 
-    void
-    _setMacAddress(
+#ifndef AF_LINK
+    bool
+    _isEthernetHardwareType(
         ::std::list< ::std::string > & warnings,
-        ::std::function< void( Interface &, MacAddress && ) > const & setMacAddress,
-        Interface & rInterface,
-        struct ifaddrs const * pIfAddr )
+        Interface const & rInterface,
+        unsigned short const hardwareType )
     {
-#ifdef AF_LINK
-
-        assert( pIfAddr->ifa_addr->sa_family == AF_LINK );
-        auto const addr( reinterpret_cast< sockaddr_dl * >( pIfAddr->ifa_addr ) );
-        // LLADDR returns a signed char, not unsigned, but the data itself is
-        // actually unsigned. (This is because addr->sdl_data contains two sets
-        // of data in a signed char, and LLADDR merely extracts the one we need.)
-        // So we have to cast to unsigned in order to make use of the data.
-        auto const dataLength{ addr->sdl_alen }; // should always be 6, but you never know
-        if ( dataLength < MIN_ADAPTER_ADDRESS_LENGTH )
-        {
-            ::std::ostringstream oss;
-            oss << "Mac address for interface " << rInterface.name() << " had unexpected length " << dataLength
-                << " bytes, should be at least " << MIN_ADAPTER_ADDRESS_LENGTH << " bytes.";
-            warnings.push_back( oss.str() );
-            return;
-        }
-        auto const data( reinterpret_cast< ::std::uint8_t const * >( LLADDR( addr ) ) );
-
-#else /* AF_LINK */
-
-        assert( pIfAddr->ifa_addr->sa_family == AF_PACKET );
-        auto const addr( reinterpret_cast< sockaddr_ll * >( pIfAddr->ifa_addr ) );
-        if ( addr->sll_hatype != ARPHRD_ETHER )
+        if ( hardwareType != ARPHRD_ETHER )
         {
             ::std::ostringstream oss;
-            oss << "Mac address for interface " << rInterface.name() << " had unexpected HA type " << addr->sll_hatype
+            oss << "Mac address for interface " << rInterface.name_view() << " had unexpected HA type " << hardwareType
                 << ", should be " << ARPHRD_ETHER << ".";
             warnings.push_back( oss.str() );
-            return;
+            return false;
         }
-        auto const dataLength{ addr->sll_halen }; // should always be 6, but you never know
+        return true;
+    }
+#endif /* !AF_LINK */
+
+    template< typename Builder >
+    void
+    _setMacAddress(
+        ::std::list< ::std::string > & warnings,
+        Builder const & builder,
+        Interface & rInterface,
+        ::std::uint8_t const * data,
+        ::std::uint8_t const dataLength ) // should always be 6, but you never know
+    {
         if ( dataLength < MIN_ADAPTER_ADDRESS_LENGTH )
         {
             ::std::ostringstream oss;
-            oss << "Mac address for interface " << rInterface.name() << " had unexpected length " << dataLength
-                << " bytes, should be at least " << MIN_ADAPTER_ADDRESS_LENGTH << " bytes.";
+            oss << "Mac address for interface " << rInterface.name_view() << " had unexpected length "
+                << ::std::to_string( dataLength ) << " bytes, should be at least " << MIN_ADAPTER_ADDRESS_LENGTH
+                << " bytes.";
             warnings.push_back( oss.str() );
             return;
         }
-        auto const data( addr->sll_addr );
-
-#endif /* !AF_LINK */
         for ( ::std::uint8_t i{ 0 }; i < dataLength; i++ )
         {
             if ( data[ i ] > 0 )
             {
                 // make sure at least one byte is nonzero
-                setMacAddress( rInterface, MacAddress( data, dataLength ) );
+                builder.setMacAddress( rInterface, MacAddress( data, dataLength ) );
                 return;
             }
         }
         ::std::ostringstream oss;
-        oss << "Mac address for interface " << rInterface.name() << " was unexpectedly all zeroes.";
+        oss << "Mac address for interface " << rInterface.name_view() << " was unexpectedly all zeroes.";
         warnings.push_back( oss.str() );
     }
 
+    template< typename Builder >
+    void
+    _setMacAddress(
+        ::std::list< ::std::string > & warnings,
+        Builder const & builder,
+        Interface & rInterface,
+        struct ifaddrs const * pIfAddr )
+    {
+#ifdef AF_LINK
+
+        assert( pIfAddr->ifa_addr->sa_family == AF_LINK );
+        auto const addr( reinterpret_cast< sockaddr_dl * >( pIfAddr->ifa_addr ) );
+        // LLADDR returns a signed char, not unsigned, but the data itself is
+        // actually unsigned. (This is because addr->sdl_data contains two sets
+        // of data in a signed char, and LLADDR merely extracts the one we need.)
+        // So we have to cast to unsigned in order to make use of the data.
+        _setMacAddress(
+            warnings,
+            builder,
+            rInterface,
+            reinterpret_cast< ::std::uint8_t const * >( LLADDR( addr ) ),
+            addr->sdl_alen );
+
+#else /* AF_LINK */
+
+        assert( pIfAddr->ifa_addr->sa_family == AF_PACKET );
+        auto const addr( reinterpret_cast< sockaddr_ll * >( pIfAddr->ifa_addr ) );
+        if ( _isEthernetHardwareType( warnings, rInterface, addr->sll_hatype ) )
+        {
+            _setMacAddress( warnings, builder, rInterface, addr->sll_addr, addr->sll_halen );
+        }
+
+#endif /* !AF_LINK */
+    }
+
+    template< typename Builder >
     void
     _addIPv4Address(
         ::std::list< ::std::string > & /* warnings */,
-        ::std::function< void( Interface &, InterfaceIPv4Address && ) > const & addIPv4Address,
+        Builder const & builder,
         Interface & rInterface,
         struct ifaddrs const * pIfAddr )
     {
@@ -874,7 +1500,7 @@ namespace
         if ( rInterface.is_flag_enabled( InterfaceFlag::BroadcastAddressSet ) && pIfAddr->ifa_broadaddr )
         {
             auto broadcastAddress( reinterpret_cast< sockaddr_in * >( pIfAddr->ifa_broadaddr ) );
-            addIPv4Address( rInterface, InterfaceIPv4Address(
+            builder.addIPv4Address( rInterface, InterfaceIPv4Address(
                 address,
                 flags,
                 prefixLength,
@@ -884,7 +1510,7 @@ namespace
         else if( rInterface.is_flag_enabled( InterfaceFlag::IsPointToPoint ) && pIfAddr->ifa_dstaddr )
         {
             auto pointToPointDestination( reinterpret_cast< sockaddr_in * >( pIfAddr->ifa_dstaddr ) );
-            addIPv4Address( rInterface, InterfaceIPv4Address(
+            builder.addIPv4Address( rInterface, InterfaceIPv4Address(
                 address,
                 flags,
                 prefixLength,
@@ -893,16 +1519,18 @@ namespace
         }
         else
         {
-            addIPv4Address( rInterface, InterfaceIPv4Address( address, flags, prefixLength ) );
+            builder.addIPv4Address( rInterface, InterfaceIPv4Address( address, flags, prefixLength ) );
         }
     }
 
+    template< typename Builder >
     void
     _addIPv6Address(
-        ::std::list< ::std::string > & warnings,
-        ::std::function< void( Interface &, InterfaceIPv6Address && ) > const & addIPv6Address,
+        [[maybe_unused]] ::std::list< ::std::string > & warnings,
+        Builder const & builder,
         Interface & rInterface,
         ::std::unordered_map< ::std::uint32_t, ::std::string > const & indexToName,
+        [[maybe_unused]] bool const skipAddressFlags,
         struct ifaddrs const * pIfAddr )
     {
         auto addr( reinterpret_cast< sockaddr_in6 * >( pIfAddr->ifa_addr ) );
@@ -943,7 +1571,11 @@ namespace
         ::strncpy( ifr6.ifr_name, pIfAddr->ifa_name, IFNAMSIZ - 1 );
         ifr6.ifr_addr = *addr;
         ::std::uint32_t flags{ 0 };
-        if ( int sock( ::socket( AF_INET6, SOCK_DGRAM, 0 ) ); sock > -1 )
+        if ( skipAddressFlags )
+        {
+            // the caller doesn't want flags, so don't pay for a socket and an ioctl per address
+        }
+        else if ( int sock( ::socket( AF_INET6, SOCK_DGRAM, 0 ) ); sock > -1 )
         {
             if ( ::ioctl( sock, SIOCGIFAFLAG_IN6, &ifr6 ) >= 0 )
             {
@@ -956,7 +1588,7 @@ namespace
                 auto const errorCode( errno );
                 ::std::ostringstream oss;
                 oss << "Error " << errorCode << " calling ioctl on datagram socket to determine flags for address "
-                    << IPv6Address( &addr->sin6_addr ) << " on interface " << rInterface.name() << ": "
+                    << IPv6Address( &addr->sin6_addr ) << " on interface " << rInterface.name_view() << ": "
                     << getSystemErrorMessage( errorCode );
                 warnings.push_back( oss.str() );
             }
@@ -966,7 +1598,7 @@ namespace
             auto const errorCode( errno );
             ::std::ostringstream oss;
             oss << "Error " << errorCode << " creating datagram socket to determine flags for address "
-                << IPv6Address( &addr->sin6_addr ) << " on interface " << rInterface.name() << ": "
+                << IPv6Address( &addr->sin6_addr ) << " on interface " << rInterface.name_view() << ": "
                 << getSystemErrorMessage( errorCode );
             warnings.push_back( oss.str() );
         }
@@ -976,35 +1608,59 @@ namespace
 
         if ( scope )
         {
-            addIPv6Address( rInterface, InterfaceIPv6Address(
+            builder.addIPv6Address( rInterface, InterfaceIPv6Address(
                 IPv6Address( &addr->sin6_addr, *scope ),
                 flags,
                 prefixLength ) );
         }
         else if ( scopeId )
         {
-            addIPv6Address( rInterface, InterfaceIPv6Address(
+            builder.addIPv6Address( rInterface, InterfaceIPv6Address(
                 IPv6Address( &addr->sin6_addr, *scopeId ),
                 flags,
                 prefixLength ) );
         }
         else
         {
-            addIPv6Address( rInterface, InterfaceIPv6Address(
+            builder.addIPv6Address( rInterface, InterfaceIPv6Address(
                 IPv6Address( &addr->sin6_addr ),
                 flags,
                 prefixLength ) );
         }
     }
 
+    template< typename Builder >
     void
     populateInterfaces(
         ::std::list< ::std::string > & warnings,
         ::std::list< ::std::shared_ptr< Interface const > > & interfaces,
-        ::std::function< void( Interface &, MacAddress && ) > setMacAddress,
-        ::std::function< void( Interface &, InterfaceIPv4Address && ) > addIPv4Address,
-        ::std::function< void( Interface &, InterfaceIPv6Address && ) > addIPv6Address )
+        EnumerationOptions const & options,
+        Builder const & builder )
     {
+        // getifaddrs can't filter, so resolve an index filter to a name up front and compare
+        // names before allocating anything for an entry
+        char indexName[ IF_NAMESIZE ] {};
+        ::std::optional< ::std::string_view > nameFilter;
+        if ( options.index )
+        {
+            if ( ::if_indextoname( *options.index, indexName ) == nullptr )
+            {
+                return;
+            }
+            nameFilter = indexName;
+            if ( options.name && *options.name != *nameFilter )
+            {
+                return;
+            }
+        }
+        else if ( options.name )
+        {
+            nameFilter = *options.name;
+        }
+        bool const includeIPv4( _includesFamily( options.address_families, AddressFamilies::IPv4 ) );
+        bool const includeIPv6( _includesFamily( options.address_families, AddressFamilies::IPv6 ) );
+        detail::SnapshotAllocator const allocator( options.arena );
+
         ::std::unique_ptr< struct ifaddrs, decltype( &::freeifaddrs ) > pIfAddrs(
             nullptr,
             &::freeifaddrs );
@@ -1024,6 +1680,12 @@ namespace
         ::std::unordered_map< ::std::uint32_t, ::std::string > indexToName;
         for ( struct ifaddrs * pIfAddr = pIfAddrs.get(); pIfAddr != nullptr; pIfAddr = pIfAddr->ifa_next )
         {
+            if ( ( nameFilter && *nameFilter != pIfAddr->ifa_name ) ||
+                 ( options.up_only && !( pIfAddr->ifa_flags & IFF_UP ) ) )
+            {
+                continue;
+            }
+
             ::std::string const name( pIfAddr->ifa_name );
             ::std::shared_ptr< Interface > pInterface;
             if ( auto const found = nameToInterface.find( name ); found != nameToInterface.end() )
@@ -1041,13 +1703,13 @@ namespace
             {
                 ::std::uint32_t const index( ::if_nametoindex( pIfAddr->ifa_name ) );
                 assert( index > 0 );
-                pInterface = ::std::make_shared< Interface >(
+                pInterface = allocator.make_shared< Interface >(
                     index,
                     name,
                     name,
                     name,
                     pIfAddr->ifa_flags,
-                    getMtu( warnings, pIfAddr->ifa_name ) );
+                    options.skip_mtu ? ::std::nullopt : getMtu( warnings, pIfAddr->ifa_name ) );
                 interfaces.emplace_back( pInterface );
                 nameToInterface.emplace( name, pInterface );
                 indexToName.emplace( index, name );
@@ -1057,15 +1719,30 @@ namespace
             {
                 if ( AddressFamily const family( pIfAddr->ifa_addr->sa_family ); family == ODDSOURCE_AF_MAC_ADDRESS )
                 {
-                    _setMacAddress( warnings, setMacAddress, *pInterface, pIfAddr );
+                    if ( !options.skip_mac_address )
+                    {
+                        _setMacAddress( warnings, builder, *pInterface, pIfAddr );
+                    }
                 }
                 else if ( family == AF_INET )
                 {
-                    _addIPv4Address( warnings, addIPv4Address, *pInterface, pIfAddr );
+                    if ( includeIPv4 )
+                    {
+                        _addIPv4Address( warnings, builder, *pInterface, pIfAddr );
+                    }
                 }
                 else if ( family == AF_INET6 )
                 {
-                    _addIPv6Address( warnings, addIPv6Address, *pInterface, indexToName, pIfAddr );
+                    if ( includeIPv6 )
+                    {
+                        _addIPv6Address(
+                            warnings,
+                            builder,
+                            *pInterface,
+                            indexToName,
+                            options.skip_address_flags,
+                            pIfAddr );
+                    }
                 }
                 else
                 {
@@ -1077,6 +1754,570 @@ namespace
         }
     }
 
+#ifdef ODDSOURCE_HAS_NETLINK
+
+    ::std::uint16_t
+    _netlinkIPv6Flags(
+        ::std::uint32_t const addressFlags )
+    {
+        ::std::uint16_t flags{ 0 };
+        if ( addressFlags & IFA_F_TEMPORARY )
+        {
+            flags = flags | InterfaceIPAddressFlag::Temporary;
+        }
+        if ( addressFlags & IFA_F_NODAD )
+        {
+            flags = flags | InterfaceIPAddressFlag::NoDad;
+        }
+        if ( addressFlags & IFA_F_OPTIMISTIC )
+        {
+            flags = flags | InterfaceIPAddressFlag::Optimistic;
+        }
+        if ( addressFlags & IFA_F_DADFAILED )
+        {
+            flags = flags | InterfaceIPAddressFlag::Duplicated;
+        }
+        if ( addressFlags & IFA_F_DEPRECATED )
+        {
+            flags = flags | InterfaceIPAddressFlag::Deprecated;
+        }
+        if ( addressFlags & IFA_F_TENTATIVE )
+        {
+            flags = flags | InterfaceIPAddressFlag::Tentative;
+        }
+#ifdef IFA_F_STABLE_PRIVACY
+        if ( addressFlags & IFA_F_STABLE_PRIVACY )
+        {
+            // RFC 7217 stable privacy addresses are the Linux equivalent of BSD's "secured" addresses
+            flags = flags | InterfaceIPAddressFlag::Secured;
+        }
+#endif /* IFA_F_STABLE_PRIVACY */
+        return flags;
+    }
+
+    /**
+     * Builds an interface from an RTM_NEWLINK or RTM_DELLINK message, or returns nullptr if the
+     * options filter it out or it has no name.
+     */
+    template< typename Builder >
+    ::std::shared_ptr< Interface >
+    _newNetlinkLink(
+        ::std::list< ::std::string > & warnings,
+        EnumerationOptions const & options,
+        detail::SnapshotAllocator const & allocator,
+        Builder const & builder,
+        ifinfomsg const & info,
+        nlmsghdr const & message )
+    {
+        auto const index( static_cast< ::std::uint32_t >( info.ifi_index ) );
+        if ( ( options.up_only && !( info.ifi_flags & IFF_UP ) ) || ( options.index && *options.index != index ) )
+        {
+            return nullptr;
+        }
+
+        ::std::string_view name;
+        ::std::optional< ::std::uint64_t const > mtu;
+        ::std::uint8_t const * hardwareAddress( nullptr );
+        size_t hardwareAddressLength( 0 );
+        detail::forEachNetlinkAttribute< ifinfomsg >(
+            message,
+            [ &options, &name, &mtu, &hardwareAddress, &hardwareAddressLength ]
+            ( ::std::uint16_t const type, void const * data, size_t const length )
+            {
+                if ( type == IFLA_IFNAME )
+                {
+                    auto const chars( static_cast< char const * >( data ) );
+                    name = ::std::string_view( chars, ::strnlen( chars, length ) );
+                }
+                else if ( type == IFLA_MTU && !options.skip_mtu && length >= sizeof( ::std::uint32_t ) )
+                {
+                    ::std::uint32_t value;
+                    ::std::memcpy( &value, data, sizeof( value ) );
+                    mtu.emplace( value );
+                }
+                else if ( type == IFLA_ADDRESS && !options.skip_mac_address )
+                {
+                    hardwareAddress = static_cast< ::std::uint8_t const * >( data );
+                    hardwareAddressLength = length;
+                }
+            } );
+
+        if ( options.name && *options.name != name )
+        {
+            return nullptr;
+        }
+        if ( name.empty() )
+        {
+            ::std::ostringstream oss;
+            oss << "Netlink reported interface index " << index << " without a name; skipping it.";
+            warnings.push_back( oss.str() );
+            return nullptr;
+        }
+
+        auto pInterface( allocator.make_shared< Interface >( index, name, name, name, info.ifi_flags, mtu ) );
+        if ( hardwareAddress && _isEthernetHardwareType( warnings, *pInterface, info.ifi_type ) )
+        {
+            _setMacAddress(
+                warnings,
+                builder,
+                *pInterface,
+                hardwareAddress,
+                static_cast< ::std::uint8_t >( ::std::min< size_t >( hardwareAddressLength, UINT8_MAX ) ) );
+        }
+        return pInterface;
+    }
+
+    template< typename Builder >
+    void
+    _addNetlinkLink(
+        ::std::list< ::std::string > & warnings,
+        EnumerationOptions const & options,
+        detail::SnapshotAllocator const & allocator,
+        Builder const & builder,
+        ::std::list< ::std::shared_ptr< Interface const > > & interfaces,
+        ::std::unordered_map< ::std::uint32_t, ::std::shared_ptr< Interface > > & indexToInterface,
+        nlmsghdr const & message )
+    {
+        auto const info( detail::netlinkHeader< ifinfomsg >( message ) );
+        if ( message.nlmsg_type != RTM_NEWLINK || info == nullptr )
+        {
+            return;
+        }
+
+        auto pInterface( _newNetlinkLink( warnings, options, allocator, builder, *info, message ) );
+        if ( pInterface )
+        {
+            interfaces.emplace_back( pInterface );
+        }
+        // filtered-out links are remembered as nullptr so that their addresses are skipped quietly
+        indexToInterface.emplace( static_cast< ::std::uint32_t >( info->ifi_index ), ::std::move( pInterface ) );
+    }
+
+    /**
+     * Adds the address in an RTM_NEWADDR or RTM_DELADDR message to the given interface, which
+     * only needs its index and name to be accurate.
+     */
+    template< typename Builder >
+    void
+    _addNetlinkAddress(
+        ::std::list< ::std::string > & warnings,
+        EnumerationOptions const & options,
+        Builder const & builder,
+        Interface & rInterface,
+        ifaddrmsg const & info,
+        nlmsghdr const & message )
+    {
+        size_t const addressLength( info.ifa_family == AF_INET6 ? sizeof( in6_addr ) : sizeof( in_addr ) );
+        void const * address( nullptr );
+        void const * local( nullptr );
+        void const * broadcast( nullptr );
+        ::std::uint32_t addressFlags( info.ifa_flags );
+        detail::forEachNetlinkAttribute< ifaddrmsg >(
+            message,
+            [ addressLength, &address, &local, &broadcast, &addressFlags ]
+            ( ::std::uint16_t const type, void const * data, size_t const length )
+            {
+                if ( type == IFA_FLAGS && length >= sizeof( ::std::uint32_t ) )
+                {
+                    ::std::memcpy( &addressFlags, data, sizeof( addressFlags ) );
+                }
+                else if ( length < addressLength )
+                {
+                    return;
+                }
+                else if ( type == IFA_ADDRESS )
+                {
+                    address = data;
+                }
+                else if ( type == IFA_LOCAL )
+                {
+                    local = data;
+                }
+                else if ( type == IFA_BROADCAST )
+                {
+                    broadcast = data;
+                }
+            } );
+
+        // On point-to-point links, IFA_LOCAL is this end and IFA_ADDRESS is the peer.
+        // Everywhere else, only IFA_ADDRESS is guaranteed and the two are identical.
+        if ( local == nullptr )
+        {
+            local = address;
+        }
+        if ( local == nullptr )
+        {
+            return;
+        }
+
+        if ( info.ifa_family == AF_INET )
+        {
+            if ( !_includesFamily( options.address_families, AddressFamilies::IPv4 ) )
+            {
+                return;
+            }
+
+            in_addr data {};
+            ::std::memcpy( &data, local, sizeof( data ) );
+            IPv4Address const ipAddress( &data );
+
+            static constexpr ::std::uint32_t const flags{ 0 };
+            if ( broadcast )
+            {
+                ::std::memcpy( &data, broadcast, sizeof( data ) );
+                builder.addIPv4Address( rInterface, InterfaceIPv4Address(
+                    ipAddress,
+                    flags,
+                    info.ifa_prefixlen,
+                    Broadcast,
+                    IPv4Address( &data ) ) );
+            }
+            else if ( address != local && ::std::memcmp( address, local, sizeof( data ) ) != 0 )
+            {
+                ::std::memcpy( &data, address, sizeof( data ) );
+                builder.addIPv4Address( rInterface, InterfaceIPv4Address(
+                    ipAddress,
+                    flags,
+                    info.ifa_prefixlen,
+                    PointToPoint,
+                    IPv4Address( &data ) ) );
+            }
+            else
+            {
+                builder.addIPv4Address( rInterface, InterfaceIPv4Address( ipAddress, flags, info.ifa_prefixlen ) );
+            }
+        }
+        else if ( info.ifa_family == AF_INET6 )
+        {
+            if ( !_includesFamily( options.address_families, AddressFamilies::IPv6 ) )
+            {
+                return;
+            }
+
+            in6_addr data {};
+            ::std::memcpy( &data, local, sizeof( data ) );
+            auto const flags( options.skip_address_flags ? ::std::uint16_t{ 0 } : _netlinkIPv6Flags( addressFlags ) );
+
+            // link-local addresses are only meaningful with a scope, which getifaddrs reports as the interface
+            if ( IN6_IS_ADDR_LINKLOCAL( &data ) || IN6_IS_ADDR_MC_LINKLOCAL( &data ) )
+            {
+                v6Scope scope { rInterface.index() };
+                if ( auto const name( rInterface.name_view() ); !name.empty() )
+                {
+                    scope.scope_name.emplace( name );
+                }
+                builder.addIPv6Address( rInterface, InterfaceIPv6Address(
+                    IPv6Address( &data, scope ),
+                    flags,
+                    info.ifa_prefixlen ) );
+            }
+            else
+            {
+                builder.addIPv6Address( rInterface, InterfaceIPv6Address(
+                    IPv6Address( &data ),
+                    flags,
+                    info.ifa_prefixlen ) );
+            }
+        }
+        else
+        {
+            ::std::ostringstream oss;
+            oss << "Unrecognized address family " << ::std::to_string( info.ifa_family ) << " on interface "
+                << rInterface.name_view();
+            warnings.push_back( oss.str() );
+        }
+    }
+
+    template< typename Builder >
+    void
+    _addNetlinkAddress(
+        ::std::list< ::std::string > & warnings,
+        EnumerationOptions const & options,
+        Builder const & builder,
+        ::std::unordered_map< ::std::uint32_t, ::std::shared_ptr< Interface > > const & indexToInterface,
+        nlmsghdr const & message )
+    {
+        auto const info( detail::netlinkHeader< ifaddrmsg >( message ) );
+        if ( message.nlmsg_type != RTM_NEWADDR || info == nullptr )
+        {
+            return;
+        }
+
+        auto const found( indexToInterface.find( info->ifa_index ) );
+        if ( found == indexToInterface.end() )
+        {
+            // without strict checking, the kernel ignores the index filter and sends everything
+            if ( !options.index && !options.name )
+            {
+                ::std::ostringstream oss;
+                oss << "Netlink reported an address for unknown interface index " << info->ifa_index
+                    << "; skipping it.";
+                warnings.push_back( oss.str() );
+            }
+            return;
+        }
+        if ( found->second )
+        {
+            _addNetlinkAddress( warnings, options, builder, *found->second, *info, message );
+        }
+    }
+
+    /**
+     * Returns false if no interface can have the name or index the options filter for, in which
+     * case the kernel would reject the request.
+     */
+    bool
+    _isNetlinkFilterSatisfiable(
+        EnumerationOptions const & options )
+    {
+        return !( options.name && ( options.name->empty() || options.name->size() >= IFNAMSIZ ) ) &&
+               !( options.index && ( *options.index == 0 || *options.index > INT_MAX ) );
+    }
+
+    /**
+     * Builds the RTM_GETLINK request for the options: a dump, or a get when filtering for one
+     * interface.
+     */
+    detail::NetlinkRequest< ifinfomsg >
+    _newNetlinkLinkRequest(
+        EnumerationOptions const & options )
+    {
+        bool const singleInterface( options.index || options.name );
+        ifinfomsg linkHeader {};
+        linkHeader.ifi_index = static_cast< int >( options.index.value_or( 0 ) );
+        detail::NetlinkRequest< ifinfomsg > linkRequest(
+            RTM_GETLINK,
+            singleInterface ? 0 : NLM_F_DUMP,
+            linkHeader );
+#ifdef RTEXT_FILTER_SKIP_STATS
+        // interface statistics are most of each RTM_NEWLINK message and are never used here
+        ::std::uint32_t const extensionMask{ RTEXT_FILTER_SKIP_STATS };
+        linkRequest.addAttribute( IFLA_EXT_MASK, &extensionMask, sizeof( extensionMask ) );
+#endif /* RTEXT_FILTER_SKIP_STATS */
+        if ( options.name && !options.index )
+        {
+            linkRequest.addAttribute( IFLA_IFNAME, options.name->c_str(), options.name->size() + 1 );
+        }
+        return linkRequest;
+    }
+
+    /**
+     * Builds the RTM_GETADDR dump request for the options' address families and, if not 0, the
+     * given interface index.
+     */
+    detail::NetlinkRequest< ifaddrmsg >
+    _newNetlinkAddressRequest(
+        EnumerationOptions const & options,
+        ::std::uint32_t const index )
+    {
+        ifaddrmsg addressHeader {};
+        if ( options.address_families == AddressFamilies::IPv4 )
+        {
+            addressHeader.ifa_family = AF_INET;
+        }
+        else if ( options.address_families == AddressFamilies::IPv6 )
+        {
+            addressHeader.ifa_family = AF_INET6;
+        }
+        addressHeader.ifa_index = index;
+        return detail::NetlinkRequest< ifaddrmsg >( RTM_GETADDR, NLM_F_DUMP, addressHeader );
+    }
+
+    ::std::string
+    _netlinkInconsistentWarning(
+        int const attempts )
+    {
+        ::std::ostringstream oss;
+        oss << "Interfaces changed during each of " << attempts
+            << " netlink dump attempts; results may be inconsistent.";
+        return oss.str();
+    }
+
+    template< typename Builder >
+    void
+    populateInterfacesNetlink(
+        ::std::list< ::std::string > & warnings,
+        ::std::list< ::std::shared_ptr< Interface const > > & interfaces,
+        EnumerationOptions const & options,
+        Builder const & builder )
+    {
+        bool const singleInterface( options.index || options.name );
+        if ( !_isNetlinkFilterSatisfiable( options ) )
+        {
+            return;
+        }
+
+        detail::NetlinkSocket socket;
+        for ( int attempt{ 1 }; ; ++attempt )
+        {
+            ::std::list< ::std::string > dumpWarnings;
+            ::std::list< ::std::shared_ptr< Interface const > > dumpInterfaces;
+            ::std::unordered_map< ::std::uint32_t, ::std::shared_ptr< Interface > > indexToInterface;
+            detail::SnapshotAllocator const allocator( options.arena );
+            auto const linkHandler(
+                [ & ]( nlmsghdr const & message )
+                {
+                    _addNetlinkLink(
+                        dumpWarnings, options, allocator, builder, dumpInterfaces, indexToInterface, message );
+                } );
+
+            auto linkRequest( _newNetlinkLinkRequest( options ) );
+            bool consistent{ true };
+            if ( singleInterface )
+            {
+                socket.get( linkRequest, linkHandler );
+            }
+            else
+            {
+                consistent = socket.dump( linkRequest, linkHandler );
+            }
+
+            if ( options.address_families != AddressFamilies::None && !( singleInterface && dumpInterfaces.empty() ) )
+            {
+                auto addressRequest( _newNetlinkAddressRequest(
+                    options,
+                    singleInterface ? dumpInterfaces.front()->index() : 0 ) );
+                consistent = socket.dump(
+                    addressRequest,
+                    [ & ]( nlmsghdr const & message )
+                    {
+                        _addNetlinkAddress(
+                            dumpWarnings,
+                            options,
+                            builder,
+                            indexToInterface,
+                            message );
+                    } ) && consistent;
+            }
+
+            // NLM_F_DUMP_INTR means links or addresses changed mid-dump, so start over to get a consistent view
+            if ( consistent || attempt >= ODDSOURCE_MAX_TRIES )
+            {
+                if ( !consistent )
+                {
+                    dumpWarnings.push_back( _netlinkInconsistentWarning( attempt ) );
+                }
+                warnings.splice( warnings.end(), dumpWarnings );
+                interfaces.splice( interfaces.end(), dumpInterfaces );
+                return;
+            }
+        }
+    }
+
+    /**
+     * Converts one rtnetlink notification into an event, or returns false if it is not a link or
+     * address notification or the options filter it out.
+     */
+    template< typename Builder >
+    bool
+    _fillNetlinkEvent(
+        ::std::list< ::std::string > & warnings,
+        EnumerationOptions const & options,
+        Builder const & builder,
+        InterfaceEvent & event,
+        nlmsghdr const & message )
+    {
+        if ( message.nlmsg_type == RTM_NEWLINK || message.nlmsg_type == RTM_DELLINK )
+        {
+            auto const info( detail::netlinkHeader< ifinfomsg >( message ) );
+            if ( info == nullptr )
+            {
+                return false;
+            }
+            // a monitor's interfaces are independent of each other, so they come from the heap
+            auto pInterface( _newNetlinkLink(
+                warnings, options, detail::SnapshotAllocator( false ), builder, *info, message ) );
+            if ( !pInterface )
+            {
+                return false;
+            }
+            if ( message.nlmsg_type == RTM_DELLINK )
+            {
+                event.type = InterfaceEventType::LinkRemoved;
+            }
+            else
+            {
+                // the kernel reports every flag as changed only when it announces a newly registered link
+                event.type = info->ifi_change == ~0U ? InterfaceEventType::LinkAdded : InterfaceEventType::LinkChanged;
+            }
+            event.index = pInterface->index();
+            event.name = pInterface->name();
+            event.link = ::std::move( pInterface );
+            return true;
+        }
+
+        if ( message.nlmsg_type != RTM_NEWADDR && message.nlmsg_type != RTM_DELADDR )
+        {
+            return false;
+        }
+        auto const info( detail::netlinkHeader< ifaddrmsg >( message ) );
+        if ( info == nullptr || ( options.index && *options.index != info->ifa_index ) )
+        {
+            return false;
+        }
+
+        ::std::string name;
+        if ( char buffer[ IF_NAMESIZE ]; ::if_indextoname( info->ifa_index, buffer ) )
+        {
+            name = buffer;
+        }
+        else
+        {
+            // the interface is already gone, as when its addresses are removed along with it
+            detail::forEachNetlinkAttribute< ifaddrmsg >(
+                message,
+                [ &name ]( ::std::uint16_t const type, void const * data, size_t const length )
+                {
+                    if ( type == IFA_LABEL )
+                    {
+                        auto const chars( static_cast< char const * >( data ) );
+                        name.assign( chars, ::strnlen( chars, length ) );
+                    }
+                } );
+        }
+        if ( options.name && *options.name != name )
+        {
+            return false;
+        }
+
+        // records the address in the event instead of adding it to the interface
+        struct EventBuilder
+        {
+            InterfaceEvent & event;
+
+            void
+            addIPv4Address(
+                Interface &,
+                InterfaceIPv4Address && ipAddress ) const
+            {
+                this->event.ipv4_address.emplace( ::std::move( ipAddress ) );
+            }
+
+            void
+            addIPv6Address(
+                Interface &,
+                InterfaceIPv6Address && ipAddress ) const
+            {
+                this->event.ipv6_address.emplace( ::std::move( ipAddress ) );
+            }
+        };
+
+        Interface transient( info->ifa_index, name, name, name, 0 );
+        _addNetlinkAddress( warnings, options, EventBuilder { event }, transient, *info, message );
+        if ( !event.ipv4_address && !event.ipv6_address )
+        {
+            return false;
+        }
+        event.type = message.nlmsg_type == RTM_NEWADDR ?
+                     InterfaceEventType::AddressAdded :
+                     InterfaceEventType::AddressRemoved;
+        event.index = info->ifa_index;
+        event.name = ::std::move( name );
+        return true;
+    }
+
+#endif /* ODDSOURCE_HAS_NETLINK */
+
 #endif /* !ODDSOURCE_IS_WINDOWS */
 
     /*void
@@ -1088,9 +2329,407 @@ namespace
     }*/
 }
 
+namespace OddSource::Interfaces
+{
+#ifdef ODDSOURCE_HAS_NETLINK
+    class InterfaceMonitor::Implementation
+    {
+    public:
+        explicit
+        Implementation(
+            EnumerationOptions const & options )
+            : _options( options )
+        {
+            // a monitor reports links going down, so it can't ignore links that aren't up
+            this->_options.up_only = false;
+        }
+
+        EnumerationOptions _options;
+        detail::NetlinkSocket _socket;
+    };
+#else /* ODDSOURCE_HAS_NETLINK */
+    class InterfaceMonitor::Implementation
+    {
+    };
+#endif /* !ODDSOURCE_HAS_NETLINK */
+
+    OddSource_Inline
+    InterfaceMonitor::
+    InterfaceMonitor(
+        [[maybe_unused]] EnumerationOptions const & options )
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        this->_implementation = ::std::make_unique< Implementation >( options );
+        auto & socket( this->_implementation->_socket );
+        socket.subscribe( RTNLGRP_LINK );
+        if ( _includesFamily( options.address_families, AddressFamilies::IPv4 ) )
+        {
+            socket.subscribe( RTNLGRP_IPV4_IFADDR );
+        }
+        if ( _includesFamily( options.address_families, AddressFamilies::IPv6 ) )
+        {
+            socket.subscribe( RTNLGRP_IPV6_IFADDR );
+        }
+#else /* ODDSOURCE_HAS_NETLINK */
+        throw InterfaceBrowserSystemError( "Interface monitoring is not available on this platform." );
+#endif /* !ODDSOURCE_HAS_NETLINK */
+    }
+
+    OddSource_Inline
+    InterfaceMonitor::
+    ~InterfaceMonitor() noexcept
+    {
+    }
+
+    OddSource_Inline
+    size_t
+    InterfaceMonitor::
+    poll_events(
+        [[maybe_unused]] ::std::function< void( InterfaceEvent && ) > const & handler )
+    {
+        this->_warnings.clear();
+        size_t count{ 0 };
+#ifdef ODDSOURCE_HAS_NETLINK
+        detail::InterfaceBuilder const builder;
+        auto & implementation( *this->_implementation );
+        for ( ; ; )
+        {
+            auto const result( implementation._socket.receive(
+                [ this, &implementation, &builder, &handler, &count ]( nlmsghdr const & message )
+                {
+                    InterfaceEvent event;
+                    if ( _fillNetlinkEvent( this->_warnings, implementation._options, builder, event, message ) )
+                    {
+                        _invalidateScope( event );
+                        ++count;
+                        handler( ::std::move( event ) );
+                    }
+                } ) );
+            if ( result == detail::NetlinkReceiveResult::WouldBlock )
+            {
+                break;
+            }
+            if ( result == detail::NetlinkReceiveResult::Overflow )
+            {
+                ScopeResolver::installed().invalidate();
+                ++count;
+                handler( InterfaceEvent {} );
+            }
+        }
+#endif /* ODDSOURCE_HAS_NETLINK */
+        return count;
+    }
+
+    OddSource_Inline
+    size_t
+    InterfaceMonitor::
+    wait_for_events(
+        ::std::function< void( InterfaceEvent && ) > const & handler,
+        [[maybe_unused]] ::std::optional< ::std::chrono::milliseconds > timeout )
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        pollfd descriptor { this->native_handle(), POLLIN, 0 };
+        int const milliseconds( timeout ? static_cast< int >( ::std::min< ::std::chrono::milliseconds::rep >(
+            ::std::max< ::std::chrono::milliseconds::rep >( timeout->count(), 0 ),
+            INT_MAX ) ) : -1 );
+        // an interrupted wait is treated like a timeout, after delivering whatever did arrive
+        if ( ::poll( &descriptor, 1, milliseconds ) < 0 && errno != EINTR )
+        {
+            int const errorCode( errno );
+            ::std::ostringstream oss;
+            oss << "Error " << errorCode << " waiting for interface events: "
+                << detail::getSystemErrorMessage( errorCode );
+            throw InterfaceBrowserSystemError( oss.str() );
+        }
+#endif /* ODDSOURCE_HAS_NETLINK */
+        return this->poll_events( handler );
+    }
+
+    OddSource_Inline
+    int
+    InterfaceMonitor::
+    native_handle() const
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        return this->_implementation->_socket.fd();
+#else /* ODDSOURCE_HAS_NETLINK */
+        return -1;
+#endif /* !ODDSOURCE_HAS_NETLINK */
+    }
+
+    OddSource_Inline
+    ::std::list< ::std::string > const &
+    InterfaceMonitor::
+    getWarnings() const
+    {
+        return this->_warnings;
+    }
+
+    class InterfaceEnumeration::Implementation
+    {
+    public:
+        explicit
+        Implementation(
+            EnumerationOptions const & enumerationOptions )
+            : options( enumerationOptions )
+        {
+        }
+
+        EnumerationOptions const options;
+        ::std::shared_ptr< InterfaceBrowser const > result;
+        ::std::exception_ptr error;
+        bool done{ false };
+#ifdef ODDSOURCE_HAS_NETLINK
+        enum class Phase
+        {
+            Links,
+            Addresses,
+        };
+
+        ::std::unique_ptr< detail::NetlinkSocket > socket;
+        Phase phase{ Phase::Links };
+        int attempt{ 1 };
+        bool consistent{ true };
+        ::std::list< ::std::string > warnings;
+        ::std::list< ::std::shared_ptr< Interface const > > interfaces;
+        ::std::unordered_map< ::std::uint32_t, ::std::shared_ptr< Interface > > indexToInterface;
+        detail::SnapshotAllocator allocator{ false };
+        detail::InterfaceBuilder const builder{};
+
+        void
+        sendLinkRequest()
+        {
+            this->phase = Phase::Links;
+            this->consistent = true;
+            this->warnings.clear();
+            this->interfaces.clear();
+            this->indexToInterface.clear();
+            this->allocator.reset( this->options.arena );
+            auto request( _newNetlinkLinkRequest( this->options ) );
+            this->socket->send( request );
+        }
+#endif /* ODDSOURCE_HAS_NETLINK */
+    };
+
+    OddSource_Inline
+    InterfaceEnumeration::
+    InterfaceEnumeration(
+        EnumerationOptions const & options )
+        : _implementation( ::std::make_unique< Implementation >( options ) )
+    {
+        auto & implementation( *this->_implementation );
+#ifdef ODDSOURCE_HAS_NETLINK
+        bool const system( !options.provider && options.backend != EnumerationBackend::Provider );
+        if ( system && options.backend != EnumerationBackend::Portable && _isNetlinkFilterSatisfiable( options ) )
+        {
+            try
+            {
+                implementation.socket = ::std::make_unique< detail::NetlinkSocket >();
+                implementation.sendLinkRequest();
+                return;
+            }
+            catch ( InterfaceBrowserSystemError const & )
+            {
+                if ( options.backend == EnumerationBackend::Netlink )
+                {
+                    throw;
+                }
+                // fall back the same way InterfaceBrowser does, synchronously
+                implementation.socket.reset();
+            }
+        }
+        else if ( system && options.backend != EnumerationBackend::Portable )
+        {
+            // no interface can match the filter
+            implementation.result = ::std::shared_ptr< InterfaceBrowser const >( new InterfaceBrowser(
+                options, EnumerationBackend::Netlink, {}, {} ) );
+            implementation.done = true;
+            return;
+        }
+#endif /* ODDSOURCE_HAS_NETLINK */
+        implementation.result = ::std::make_shared< InterfaceBrowser const >( options );
+        implementation.done = true;
+    }
+
+    OddSource_Inline
+    InterfaceEnumeration::
+    ~InterfaceEnumeration() noexcept
+    {
+    }
+
+    OddSource_Inline
+    int
+    InterfaceEnumeration::
+    native_handle() const
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        if ( !this->_implementation->done && this->_implementation->socket )
+        {
+            return this->_implementation->socket->fd();
+        }
+#endif /* ODDSOURCE_HAS_NETLINK */
+        return -1;
+    }
+
+    OddSource_Inline
+    bool
+    InterfaceEnumeration::
+    on_readable()
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        auto & implementation( *this->_implementation );
+        while ( !implementation.done )
+        {
+            try
+            {
+                int error{ 0 };
+                auto const received( implementation.socket->receiveReply(
+                    false,
+                    implementation.consistent,
+                    error,
+                    [ &implementation ]( nlmsghdr const & message )
+                    {
+                        if ( implementation.phase == Implementation::Phase::Links )
+                        {
+                            _addNetlinkLink(
+                                implementation.warnings,
+                                implementation.options,
+                                implementation.allocator,
+                                implementation.builder,
+                                implementation.interfaces,
+                                implementation.indexToInterface,
+                                message );
+                        }
+                        else
+                        {
+                            _addNetlinkAddress(
+                                implementation.warnings,
+                                implementation.options,
+                                implementation.builder,
+                                implementation.indexToInterface,
+                                message );
+                        }
+                    } ) );
+                if ( received == detail::NetlinkReceiveResult::WouldBlock )
+                {
+                    return false;
+                }
+                if ( received != detail::NetlinkReceiveResult::Finished )
+                {
+                    continue;
+                }
+
+                bool const singleInterface( implementation.options.index || implementation.options.name );
+                if ( error != 0 && !( error == ENODEV && singleInterface ) )
+                {
+                    ::std::ostringstream oss;
+                    oss << "Error " << error << " processing netlink request: " << detail::getSystemErrorMessage( error );
+                    throw InterfaceBrowserSystemError( oss.str() );
+                }
+                this->advance();
+            }
+            catch ( InterfaceBrowserSystemError const & )
+            {
+                implementation.socket.reset();
+                implementation.done = true;
+                if ( implementation.options.backend == EnumerationBackend::Netlink )
+                {
+                    implementation.error = ::std::current_exception();
+                    break;
+                }
+
+                // fall back the same way InterfaceBrowser does, synchronously
+                try
+                {
+                    implementation.result = ::std::make_shared< InterfaceBrowser const >( [ &implementation ]
+                    {
+                        auto options( implementation.options );
+                        options.backend = EnumerationBackend::Portable;
+                        return options;
+                    }() );
+                }
+                catch ( InterfaceBrowserSystemError const & )
+                {
+                    implementation.error = ::std::current_exception();
+                }
+            }
+        }
+#endif /* ODDSOURCE_HAS_NETLINK */
+        return true;
+    }
+
+    OddSource_Inline
+    void
+    InterfaceEnumeration::
+    advance()
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        auto & implementation( *this->_implementation );
+        auto const & options( implementation.options );
+        bool const singleInterface( options.index || options.name );
+        if ( implementation.phase == Implementation::Phase::Links &&
+             options.address_families != AddressFamilies::None &&
+             !( singleInterface && implementation.interfaces.empty() ) )
+        {
+            implementation.phase = Implementation::Phase::Addresses;
+            auto request( _newNetlinkAddressRequest(
+                options,
+                singleInterface ? implementation.interfaces.front()->index() : 0 ) );
+            implementation.socket->send( request );
+            return;
+        }
+
+        // NLM_F_DUMP_INTR means links or addresses changed mid-dump, so start over to get a consistent view
+        if ( !implementation.consistent && implementation.attempt < ODDSOURCE_MAX_TRIES )
+        {
+            ++implementation.attempt;
+            implementation.sendLinkRequest();
+            return;
+        }
+        if ( !implementation.consistent )
+        {
+            implementation.warnings.push_back( _netlinkInconsistentWarning( implementation.attempt ) );
+        }
+
+        implementation.result = ::std::shared_ptr< InterfaceBrowser const >( new InterfaceBrowser(
+            options,
+            EnumerationBackend::Netlink,
+            ::std::move( implementation.warnings ),
+            ::std::move( implementation.interfaces ) ) );
+        implementation.indexToInterface.clear();
+        implementation.allocator.reset( false );
+        implementation.socket.reset();
+        implementation.done = true;
+#endif /* ODDSOURCE_HAS_NETLINK */
+    }
+
+    OddSource_Inline
+    bool
+    InterfaceEnumeration::
+    done() const
+    {
+        return this->_implementation->done;
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< InterfaceBrowser const >
+    InterfaceEnumeration::
+    result() const
+    {
+        if ( !this->_implementation->done )
+        {
+            throw ::std::logic_error( "The enumeration is not done yet." );
+        }
+        if ( this->_implementation->error )
+        {
+            ::std::rethrow_exception( this->_implementation->error );
+        }
+        return this->_implementation->result;
+    }
+}
+
 #ifndef ODDSOURCE_IS_WINDOWS
 
 #  undef ODDSOURCE_AF_MAC_ADDRESS
-#  undef STRERROR_R_RETURNS_INT
 
 #endif /* ODDSOURCE_IS_WINDOWS */
@@ -21,29 +21,26 @@
 #endif /* IFADDRS4CPP_INLINE_SOURCE */
 
 #include "../detail/flip.hpp"
+#include "../detail/ip_codec.hpp"
 
 #ifdef ODDSOURCE_IS_WINDOWS
 #include "winsock_includes.h"
 #else /* ODDSOURCE_IS_WINDOWS */
 #include <arpa/inet.h>
-#include <cerrno>
-#include <netdb.h>
-#include <net/if.h>
 #include <netinet/in.h>
-#include <sys/socket.h>
 #endif /* ODDSOURCE_IS_WINDOWS */
 
+#include <algorithm>
 #include <array>
+#include <charconv>
 #include <cstring>
+#include <memory>
+#include <new>
 #include <string>
 #include <string_view>
 #include <sstream>
 #include <utility>
 
-#define BYTES reinterpret_cast< ::std::uint8_t const * >( this->_data.get() )
-#define WORDS reinterpret_cast< ::std::uint16_t const * >( this->_data.get() )
-#define DOUBLEWORDS reinterpret_cast< ::std::uint32_t const * >( this->_data.get() )
-
 // ReSharper disable once CppUnnamedNamespaceInHeaderFile
 namespace
 {
@@ -53,166 +50,101 @@ namespace
     using Enable_If_Addr = ::std::enable_if_t< ::std::is_same_v<Addr, in_addr> ||
                                                ::std::is_same_v<Addr, in6_addr> >;
 
+    /**
+     * Parses an address string into data without throwing, so that both the constructors and the parse
+     * functions can use it.
+     */
     template< typename Addr, typename = Enable_If_Addr<Addr> >
-    ::std::unique_ptr< Addr >
-    fromRepr(
-        ::std::string_view const & repr )
+    ParseError
+    parseRepr(
+        ::std::string_view const & repr,
+        Addr & data ) noexcept
     {
-        using namespace ::std::string_literals;
         if ( repr.empty() )
         {
-            throw InvalidIPAddress("Invalid empty IP address string.");
+            return ParseError::Empty;
+        }
+        if ( repr.length() >= detail::MAX_REPR_LENGTH )
+        {
+            return ParseError::TooLong;
         }
 
-        ::std::string repr_str(repr);
-        auto data = ::std::make_unique<Addr>();
-        int success;
         if constexpr (::std::is_same_v<Addr, in6_addr>)
         {
-            // inet_pton can also handle IPv4 addresses, but only in dotted-decimal format
-            // (1.2.3.4), not in octal, hexadecimal, or any other valid IPv4 format.
-            success = inet_pton(AF_INET6, repr_str.c_str(), data.get());
+            return detail::parseIPv6(repr, data) ? ParseError::None : ParseError::Malformed;
         }
         else
         {
-            int num_dots(0);
-            for (char c : repr)
-            {
-                if (c == '.')
-                {
-                    num_dots++;
-                }
-            }
+            // like inet_aton, this accepts decimal, octal, and hexadecimal parts, but only four of them
+            return detail::parseIPv4(repr, data) ? ParseError::None : ParseError::Malformed;
+        }
+    }
+
+    template< typename Addr, typename = Enable_If_Addr<Addr> >
+    Addr
+    fromRepr(
+        ::std::string_view const & repr )
+    {
+        using namespace ::std::string_literals;
+        Addr data{};
+        switch (parseRepr(repr, data))
+        {
+            case ParseError::None:
+                return data;
+            case ParseError::Empty:
+                throw InvalidIPAddress("Invalid empty IP address string.");
+            case ParseError::TooLong:
+                throw InvalidIPAddress("Malformed IP address string '"s + ::std::string(repr) + "' is too long."s);
+            default:
+                break;
+        }
+        if constexpr (::std::is_same_v<Addr, in_addr>)
+        {
+            auto const num_dots(::std::count(repr.begin(), repr.end(), '.'));
             if (num_dots != 3)
             {
-                // some implementations of inet_aton tolerate incomplete addresses, but we do not
                 throw InvalidIPAddress(
-                        "Malformed IPv4 address string '"s + repr_str + "' with "s +
+                        "Malformed IPv4 address string '"s + ::std::string(repr) + "' with "s +
                         ::std::to_string(num_dots + 1) + " parts instead of 4"s);
             }
-            // inet_aton/RtlIpv4StringToAddress, however, can handle IPv4 addresses in all valid formats.
-#ifdef ODDSOURCE_IS_WINDOWS
-            char const * end = nullptr;
-            success = RtlIpv4StringToAddress(repr_str.c_str(), false, &end, data.get());
-            if (success == STATUS_INVALID_PARAMETER)
-            {
-                throw InvalidIPAddress(
-                    "An invalid parameter was passed to RtlIpv4StringToAddress while converting '"s +
-                    repr_str + "'"s);
-            }
-            else if (success != 0)
-            {
-                char * s = nullptr;
-                ::FormatMessage(
-                    FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
-                    nullptr, success,
-                    MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
-                    (LPTSTR)&s, 0, nullptr);
-                ::std::string err(s == nullptr ? "" : s);
-                LocalFree(s);
-                throw InvalidIPAddress(
-                    "Malformed IP address string '"s + repr_str + "' or unknown RtlIpv4StringToAddress error ("s +
-                    ::std::to_string(success) + "): "s + err);
-            }
-            success = 1;
-#else /* ODDSOURCE_IS_WINDOWS */
-            success = inet_aton(repr_str.c_str(), data.get());
-#endif /* !ODDSOURCE_IS_WINDOWS */
         }
-        if (success != 1)
-        {
-            throw InvalidIPAddress("Malformed IP address string '"s + repr_str + "' or unknown inet_*ton error."s);
-        }
-
-        return data;
+        throw InvalidIPAddress(
+            "Malformed IP address string '"s + ::std::string(repr) + "'."s);
     }
 
-    template< typename Addr, typename = Enable_If_Addr< Addr > >
-    ::std::string
+    template< typename Addr, size_t N, typename = Enable_If_Addr< Addr > >
+    size_t
     toRepr(
-        Addr const * data )
+        Addr const & data,
+        char (& buffer)[N] ) noexcept
     {
-        using namespace ::std::string_literals;
-        AddressFamily family;
         if constexpr (::std::is_same_v<Addr, in6_addr>)
         {
-            family = AF_INET6;
+            static_assert(N > detail::IPV6_TEXT_LENGTH, "The buffer is too short for an IPv6 address.");
+            return detail::formatIPv6(data, buffer);
         }
         else
         {
-            family = AF_INET;
-        }
-
-        static constexpr size_t host_length(100);
-        char host_chars[host_length];
-        auto ptr = ::inet_ntop(family, data, host_chars, host_length);
-        if (ptr == nullptr)
-        {
-#ifdef ODDSOURCE_IS_WINDOWS
-            auto err_no(::WSAGetLastError());
-            char * s = nullptr;
-            ::FormatMessage(
-                FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
-                nullptr, err_no,
-                MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
-                (LPTSTR)&s, 0, nullptr);
-            ::std::string err(s == nullptr ? "" : s);
-            LocalFree(s);
-#else /* ODDSOURCE_IS_WINDOWS */
-            auto err_no(errno);
-            char const * err(
-                    err_no == EAFNOSUPPORT ? "Address family not supported" :
-                    (err_no == ENOSPC ? "Converted address would exceed string size" :
-                     ::gai_strerror(errno)));
-#endif /* !ODDSOURCE_IS_WINDOWS */
-            throw InvalidIPAddress(
-                "Malformed in_addr data or inet_ntop system error: "s +
-                ::std::to_string(err_no) + " ('"s + err + "')"s);
+            static_assert(N > detail::IPV4_TEXT_LENGTH, "The buffer is too short for an IPv4 address.");
+            return detail::formatIPv4(data, buffer);
         }
-        return host_chars;
-    }
-
-    template< typename Addr, typename = Enable_If_Addr< Addr > >
-    ::std::string
-    toRepr(
-        ::std::unique_ptr< Addr const > const & data )
-    {
-        return toRepr(data.get());
     }
 
-    template< typename Addr, typename = Enable_If_Addr< Addr > >
-    ::std::unique_ptr< Addr >
-    copy_in_addr(
-        Addr const * data )
-    {
-        auto new_data = ::std::make_unique< Addr >();
-        ::std::memcpy(new_data.get(), data, sizeof(Addr));
-        return new_data;
-    }
-
-    template< typename Addr, typename = Enable_If_Addr< Addr > >
-    ::std::unique_ptr< Addr >
-    copy_in_addr(
-        ::std::unique_ptr< Addr const > const & data )
-    {
-        return copy_in_addr(data.get());
-    }
-
-    ::std::unique_ptr< in_addr >
+    in_addr
     to_in_addr(
         ::std::uint32_t const data )
     {
-        auto addr( ::std::make_unique< in_addr >() );
-        addr->s_addr = htonl( data );
+        in_addr addr{};
+        addr.s_addr = htonl( data );
         return addr;
     }
 
-    ::std::unique_ptr< in6_addr >
+    in6_addr
     to_in6_addr(
         IPv6Address::Bytes const & data )
     {
-        auto addr( ::std::make_unique< in6_addr >() );
-        ::std::memcpy( &addr->s6_addr, data.data(), sizeof( addr->s6_addr ) );
+        in6_addr addr{};
+        ::std::memcpy( &addr.s6_addr, data.data(), sizeof( addr.s6_addr ) );
         return addr;
     }
 
@@ -222,19 +154,17 @@ namespace
     {
         if (scope.scope_id && !scope.scope_name)
         {
-            char buffer[IF_NAMESIZE];
-            if (::if_indextoname(*scope.scope_id, buffer) != nullptr)
+            // a name too long to store inline is dropped, so that an address the caller gave only an ID for does
+            // not allocate for a name it did not ask for
+            scope.scope_name = ScopeResolver::installed().scope_name( *scope.scope_id );
+            if (scope.scope_name && scope.scope_name->length() > IPv6Address::MAX_SCOPE_NAME_LENGTH)
             {
-                scope.scope_name = ::std::string(buffer);
+                scope.scope_name.reset();
             }
         }
         else if(scope.scope_name && !scope.scope_id)
         {
-            ::std::uint32_t scope_id = ::if_nametoindex(scope.scope_name->c_str());
-            if (scope_id > 0)
-            {
-                scope.scope_id = scope_id;
-            }
+            scope.scope_id = ScopeResolver::installed().scope_id( *scope.scope_name );
         }
         return std::move( scope );
     }
@@ -261,6 +191,21 @@ namespace
         return fillOutScope( { ::std::nullopt, ::std::string(scope_name) } );
     }
 
+    // copies an IPv6Address's heap representation, if it has one
+    ::std::unique_ptr< char[] >
+    copyRepresentation(
+        ::std::unique_ptr< char[] > const & representation )
+    {
+        if ( !representation )
+        {
+            return nullptr;
+        }
+        auto const length( ::std::strlen( representation.get() ) + 1 );
+        auto copy( ::std::make_unique< char[] >( length ) );
+        ::std::memcpy( copy.get(), representation.get(), length );
+        return copy;
+    }
+
     ::std::string_view
     stripScope(
         ::std::string_view const & repr )
@@ -273,42 +218,253 @@ namespace
         return repr;
     }
 
+    /**
+     * Parses the scope after the % in an IPv6 address string, if there is one, without throwing. An empty scope
+     * is the same as none. A scope name of up to MAX_SCOPE_NAME_LENGTH characters fits in std::string's small
+     * buffer, so this does not allocate for one, unless the installed resolver does.
+     */
+    ParseError
+    parseScope(
+        ::std::string_view const & repr,
+        ::std::optional< v6Scope > & scope ) noexcept
+    {
+        size_t const i = repr.find('%');
+        if (i == ::std::string_view::npos || i + 1 == repr.length())
+        {
+            return ParseError::None;
+        }
+
+        auto const text(repr.substr(i + 1));
+        v6Scope parsed;
+        if (text.find_first_not_of("0123456789") == ::std::string_view::npos)
+        {
+            ::std::uint32_t scope_id{ 0 };
+            auto const [ end, error ] = ::std::from_chars(text.data(), text.data() + text.length(), scope_id);
+            if (error != ::std::errc() || scope_id == 0)
+            {
+                return ParseError::InvalidScope;
+            }
+            parsed.scope_id = scope_id;
+        }
+        else
+        {
+            try
+            {
+                parsed.scope_name.emplace(text);
+            }
+            catch (...)
+            {
+                // a name too long for the small buffer could not be allocated
+                return ParseError::InvalidScope;
+            }
+        }
+
+        try
+        {
+            static_cast< void >( fillOutScope( ::std::move( parsed ) ) );
+        }
+        catch (...)
+        {
+            // the half of the scope the resolver could not supply stays unknown
+        }
+        scope.emplace(::std::move(parsed));
+        return ParseError::None;
+    }
+
     ::std::optional< v6Scope >
     extractScope(
         ::std::string_view const & repr )
     {
-        size_t const i = repr.find('%');
-        if (i != ::std::string_view::npos)
+        using namespace ::std::string_literals;
+        ::std::optional< v6Scope > scope;
+        if (parseScope(repr, scope) != ParseError::None)
         {
-            ::std::string const scope(repr.substr(i + 1));
-            if (!scope.empty())
+            auto const text(repr.substr(repr.find('%') + 1));
+            if (text.find_first_not_of("0123456789") == ::std::string_view::npos)
             {
-                if (scope.find_first_not_of("0123456789") == std::string::npos)
-                {
-                    try
-                    {
-                        return scopeFrom(::std::stoul(scope));
-                    }
-                    catch (::std::invalid_argument const &)
-                    {
-                    }
-                }
-                return scopeFrom(scope);
+                throw InvalidIPAddress(
+                    "IPv6 address scope ID '"s + ::std::string(text) + "' is not between 1 and 4294967295."s);
             }
+            // the only way a scope name fails is that it could not be allocated
+            throw ::std::bad_alloc();
         }
-        return ::std::nullopt;
+        return scope;
     }
 
-    ::std::string
+    /**
+     * Appends the scope, if there is one, to the first length characters of repr, and terminates it. repr must
+     * have room for the scope: MAX_REPRESENTATION_LENGTH + 1 characters, unless the scope name is longer than
+     * MAX_SCOPE_NAME_LENGTH.
+     */
+    void
     addScope(
-        ::std::string const & repr,
+        char * repr,
+        size_t length,
         ::std::optional< v6Scope > const & scope )
     {
         if (!scope)
         {
-            return repr;
+            repr[length] = '\0';
+            return;
+        }
+
+        repr[length++] = '%';
+        if (scope->scope_name)
+        {
+            ::std::memcpy(repr + length, scope->scope_name->data(), scope->scope_name->length());
+            length += scope->scope_name->length();
+        }
+        else
+        {
+            // a 32-bit scope ID has at most 10 digits, which always fits after a 45-character address
+            length = ::std::to_chars(repr + length, repr + length + 10, *scope->scope_id).ptr - repr;
+        }
+        repr[length] = '\0';
+    }
+
+    // the bits of IPAddress::_classification; CLASSIFIED is set once the address has been classified, so that a
+    // zero word means it has not been yet
+    constexpr ::std::uint32_t const CLASSIFIED{ 1u << 0 };
+    constexpr ::std::uint32_t const IS_UNSPECIFIED{ 1u << 1 };
+    constexpr ::std::uint32_t const IS_LOOPBACK{ 1u << 2 };
+    constexpr ::std::uint32_t const IS_LINK_LOCAL{ 1u << 3 };
+    constexpr ::std::uint32_t const IS_PRIVATE{ 1u << 4 };
+    constexpr ::std::uint32_t const IS_MULTICAST{ 1u << 5 };
+    constexpr ::std::uint32_t const IS_RESERVED{ 1u << 6 };
+    constexpr ::std::uint32_t const IS_UNIQUE_LOCAL{ 1u << 7 };
+    constexpr ::std::uint32_t const IS_SITE_LOCAL{ 1u << 8 };
+    constexpr ::std::uint32_t const IS_V4_MAPPED{ 1u << 9 };
+    constexpr ::std::uint32_t const IS_V4_COMPATIBLE{ 1u << 10 };
+    constexpr ::std::uint32_t const IS_V4_TRANSLATED{ 1u << 11 };
+    constexpr ::std::uint32_t const IS_6TO4{ 1u << 12 };
+    // the multicast scope plus one (zero meaning no scope) in bits 16-19, and the IPv6 multicast flags in bits 20-23
+    constexpr unsigned const SCOPE_SHIFT{ 16 };
+    constexpr unsigned const MULTICAST_FLAGS_SHIFT{ 20 };
+
+    constexpr
+    ::std::uint32_t
+    scopeBits(
+        MulticastScope scope )
+    {
+        return ( static_cast< ::std::uint32_t >( scope ) + 1 ) << SCOPE_SHIFT;
+    }
+
+    // indexed by the scope bits, so that IPAddress::multicast_scope() can return a reference
+    ::std::optional< MulticastScope > const MULTICAST_SCOPES[]
+    {
+        ::std::nullopt,
+        MulticastScope::Reserved,
+        MulticastScope::InterfaceLocal,
+        MulticastScope::LinkLocal,
+        MulticastScope::RealmLocal,
+        MulticastScope::AdminLocal,
+        MulticastScope::SiteLocal,
+        MulticastScope::OrganizationLocal,
+        MulticastScope::Global,
+        MulticastScope::Unassigned,
+    };
+
+    struct IPv4Range
+    {
+        ::std::uint32_t network; // host byte order
+        ::std::uint8_t prefix_length;
+        ::std::uint32_t classification;
+    };
+
+    constexpr ::std::uint32_t const V4_PRIVATE{ IS_PRIVATE | IS_RESERVED };
+    constexpr ::std::uint32_t const V4_MULTICAST{ IS_MULTICAST | IS_RESERVED };
+
+    // the first range that contains an address classifies it; see https://en.wikipedia.org/wiki/Reserved_IP_addresses
+    constexpr IPv4Range const IPV4_RANGES[]
+    {
+        { 0x00000000, 32, IS_UNSPECIFIED | IS_RESERVED }, // 0.0.0.0/32
+        { 0x7f000000, 8, IS_LOOPBACK | IS_RESERVED }, // 127.0.0.0/8
+        { 0xa9fe0000, 16, IS_LINK_LOCAL | IS_RESERVED }, // 169.254.0.0/16
+        { 0x0a000000, 8, V4_PRIVATE }, // 10.0.0.0/8
+        { 0x64400000, 10, V4_PRIVATE }, // 100.64.0.0/10
+        { 0xac100000, 12, V4_PRIVATE }, // 172.16.0.0/12
+        { 0xc0000000, 24, V4_PRIVATE }, // 192.0.0.0/24
+        { 0xc0a80000, 16, V4_PRIVATE }, // 192.168.0.0/16
+        { 0xc6120000, 15, V4_PRIVATE }, // 198.18.0.0/15
+        { 0xe0000000, 24, V4_MULTICAST | scopeBits( MulticastScope::LinkLocal ) }, // 224.0.0.0/24
+        { 0xefff0000, 16, V4_MULTICAST | scopeBits( MulticastScope::RealmLocal ) }, // 239.255.0.0/16
+        { 0xefc00000, 14, V4_MULTICAST | scopeBits( MulticastScope::OrganizationLocal ) }, // 239.192.0.0/14
+        { 0xef000000, 8, V4_MULTICAST | scopeBits( MulticastScope::Unassigned ) }, // 239.0.0.0/8
+        { 0xe0000000, 4, V4_MULTICAST | scopeBits( MulticastScope::Global ) }, // 224.0.1.0-238.255.255.255
+        { 0x00000000, 8, IS_RESERVED }, // 0.0.0.0/8
+        { 0xc0000200, 24, IS_RESERVED }, // 192.0.2.0/24
+        { 0xc0586300, 24, IS_RESERVED }, // 192.88.99.0/24
+        { 0xc6336400, 24, IS_RESERVED }, // 198.51.100.0/24
+        { 0xcb007100, 24, IS_RESERVED }, // 203.0.113.0/24
+        { 0xf0000000, 4, IS_RESERVED }, // 240.0.0.0/4
+    };
+
+    struct IPv6Range
+    {
+        IPv6Address::Bytes network;
+        ::std::uint8_t prefix_length;
+        ::std::uint32_t classification;
+    };
+
+    // the first range that contains an address classifies it; see https://en.wikipedia.org/wiki/Reserved_IP_addresses
+    constexpr IPv6Range const IPV6_RANGES[]
+    {
+        { { }, 128, IS_UNSPECIFIED | IS_RESERVED }, // ::/128
+        { { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 }, 128, IS_LOOPBACK | IS_RESERVED }, // ::1/128
+        { { 0xfe, 0x80 }, 64, IS_LINK_LOCAL | IS_RESERVED }, // fe80::/64
+        { { 0xfc }, 7, IS_UNIQUE_LOCAL | IS_PRIVATE | IS_RESERVED }, // fc00::/7
+        { { 0xfe, 0xc0 }, 10, IS_SITE_LOCAL | IS_PRIVATE | IS_RESERVED }, // fec0::/10
+        { { 0xff }, 8, IS_MULTICAST | IS_RESERVED }, // ff00::/8
+        { { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff }, 96, IS_V4_MAPPED | IS_RESERVED }, // ::ffff:0:0/96
+        { { }, 96, IS_V4_COMPATIBLE | IS_RESERVED }, // ::/96, less :: and ::1 above
+        { { 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff }, 96, IS_V4_TRANSLATED | IS_RESERVED }, // ::ffff:0:0:0/96
+        { { 0x20, 0x02 }, 16, IS_6TO4 | IS_RESERVED }, // 2002::/16
+        { { 0, 0x64, 0xff, 0x9b }, 96, IS_RESERVED }, // 64:ff9b::/96
+        { { 0, 0x64, 0xff, 0x9b, 0, 0x01 }, 48, IS_RESERVED }, // 64:ff9b:1::/48
+        { { 0x01, 0x00 }, 64, IS_RESERVED }, // 100::/64
+        { { 0x20, 0x01, 0, 0 }, 32, IS_RESERVED }, // 2001:0000::/32
+        { { 0x20, 0x01, 0, 0x20 }, 28, IS_RESERVED }, // 2001:20::/28
+        { { 0x20, 0x01, 0x0d, 0xb8 }, 32, IS_RESERVED }, // 2001:db8::/32
+    };
+
+    // indexed by the low four bits of the second byte of an IPv6 multicast address
+    constexpr MulticastScope const IPV6_MULTICAST_SCOPES[]
+    {
+        MulticastScope::Reserved, // 0x0
+        MulticastScope::InterfaceLocal, // 0x1
+        MulticastScope::LinkLocal, // 0x2
+        MulticastScope::RealmLocal, // 0x3
+        MulticastScope::AdminLocal, // 0x4
+        MulticastScope::SiteLocal, // 0x5
+        MulticastScope::Unassigned, // 0x6
+        MulticastScope::Unassigned, // 0x7
+        MulticastScope::OrganizationLocal, // 0x8
+        MulticastScope::Unassigned, // 0x9
+        MulticastScope::Unassigned, // 0xa
+        MulticastScope::Unassigned, // 0xb
+        MulticastScope::Unassigned, // 0xc
+        MulticastScope::Unassigned, // 0xd
+        MulticastScope::Global, // 0xe
+        MulticastScope::Reserved, // 0xf
+    };
+
+    bool
+    inRange(
+        ::std::uint8_t const * address,
+        IPv6Range const & range )
+    {
+        size_t const whole_bytes( range.prefix_length / 8 );
+        if ( ::std::memcmp( address, range.network.data(), whole_bytes ) != 0 )
+        {
+            return false;
         }
-        return repr + "%" + (scope->scope_name ? *scope->scope_name : ::std::to_string(*scope->scope_id));
+        auto const remaining_bits( range.prefix_length % 8 );
+        if ( remaining_bits == 0 )
+        {
+            return true;
+        }
+        auto const mask( static_cast< ::std::uint8_t >( 0xff << ( 8 - remaining_bits ) ) );
+        return ( address[ whole_bytes ] & mask ) == range.network[ whole_bytes ];
     }
 }
 
@@ -426,24 +582,16 @@ namespace OddSource::Interfaces
 
     OddSource_Inline
     IPAddress::
-    IPAddress(
-        ::std::string_view const & repr )
-        : _representation(repr)
+    IPAddress()
+        : _classification( 0 )
     {
     }
 
     OddSource_Inline
     IPAddress::
-    IPAddress( // NOLINT(*-use-equals-default)
+    IPAddress(
         IPAddress const & other )
-        : _representation( other._representation ),
-          _is_unspecified( other._is_unspecified ),
-          _is_loopback( other._is_loopback ),
-          _is_link_local( other._is_link_local ),
-          _is_private( other._is_private ),
-          _is_multicast( other._is_multicast ),
-          _is_reserved( other._is_reserved ),
-          _multicast_scope( other._multicast_scope )
+        : _classification( other._classification.load( ::std::memory_order_relaxed ) )
     {
     }
 
@@ -451,41 +599,49 @@ namespace OddSource::Interfaces
     IPAddress::
     IPAddress(
         IPAddress && other ) noexcept
-        : _representation( std::move( other._representation ) ),
-          _is_unspecified(other._is_unspecified),
-          _is_loopback(other._is_loopback),
-          _is_link_local(other._is_link_local),
-          _is_private(other._is_private),
-          _is_multicast(other._is_multicast),
-          _is_reserved(other._is_reserved),
-          _multicast_scope( ::std::move( other._multicast_scope ) ) // NOLINT(*-move-const-arg)
+        : _classification( other._classification.load( ::std::memory_order_relaxed ) )
     {
-        other._is_unspecified = false;
-        other._is_loopback = false;
-        other._is_link_local = false;
-        other._is_private = false;
-        other._is_multicast = false;
-        other._is_reserved = false;
     }
 
     OddSource_Inline
+    IPAddress &
     IPAddress::
-    ~IPAddress() noexcept // NOLINT(*-use-equals-default)
+    operator=(
+        IPAddress const & other )
     {
+        this->_classification.store(
+            other._classification.load( ::std::memory_order_relaxed ), ::std::memory_order_relaxed );
+        return *this;
     }
 
     OddSource_Inline
+    IPAddress &
     IPAddress::
-    operator ::std::string() const
+    operator=(
+        IPAddress && other ) noexcept
     {
-        return this->_representation;
+        return this->operator=( static_cast< IPAddress const & >( other ) );
     }
 
     OddSource_Inline
     IPAddress::
-    operator char const *() const
+    ~IPAddress() noexcept // NOLINT(*-use-equals-default)
+    {
+    }
+
+    OddSource_Inline
+    ::std::uint32_t
+    IPAddress::
+    classification() const noexcept
     {
-        return this->_representation.c_str();
+        // classify() is a pure function of the address, so threads racing to classify store the same value
+        auto classification( this->_classification.load( ::std::memory_order_relaxed ) );
+        if ( classification == 0 )
+        {
+            classification = this->classify() | CLASSIFIED;
+            this->_classification.store( classification, ::std::memory_order_relaxed );
+        }
+        return classification;
     }
 
     OddSource_Inline
@@ -493,7 +649,7 @@ namespace OddSource::Interfaces
     IPAddress::
     is_unspecified() const
     {
-        return this->_is_unspecified;
+        return ( this->classification() & IS_UNSPECIFIED ) != 0;
     }
 
     OddSource_Inline
@@ -501,7 +657,7 @@ namespace OddSource::Interfaces
     IPAddress::
     is_loopback() const
     {
-        return this->_is_loopback;
+        return ( this->classification() & IS_LOOPBACK ) != 0;
     }
 
     OddSource_Inline
@@ -509,7 +665,7 @@ namespace OddSource::Interfaces
     IPAddress::
     is_link_local() const
     {
-        return this->_is_link_local;
+        return ( this->classification() & IS_LINK_LOCAL ) != 0;
     }
 
     OddSource_Inline
@@ -517,7 +673,7 @@ namespace OddSource::Interfaces
     IPAddress::
     is_private() const
     {
-        return this->_is_private;
+        return ( this->classification() & IS_PRIVATE ) != 0;
     }
 
     OddSource_Inline
@@ -525,7 +681,7 @@ namespace OddSource::Interfaces
     IPAddress::
     is_multicast() const
     {
-        return this->_is_multicast;
+        return ( this->classification() & IS_MULTICAST ) != 0;
     }
 
     OddSource_Inline
@@ -533,7 +689,7 @@ namespace OddSource::Interfaces
     IPAddress::
     is_reserved() const
     {
-        return this->_is_reserved;
+        return ( this->classification() & IS_RESERVED ) != 0;
     }
 
     OddSource_Inline
@@ -541,7 +697,7 @@ namespace OddSource::Interfaces
     IPAddress::
     multicast_scope() const
     {
-        return this->_multicast_scope;
+        return MULTICAST_SCOPES[ ( this->classification() >> SCOPE_SHIFT ) & 0xf ];
     }
 
     OddSource_Inline
@@ -556,7 +712,7 @@ namespace OddSource::Interfaces
     IPv4Address::
     IPv4Address(
         in_addr const * data )
-        : IPv4Address( copy_in_addr( data ) )
+        : IPv4Address( *data )
     {
     }
 
@@ -569,105 +725,88 @@ namespace OddSource::Interfaces
     }
 
     OddSource_Inline
+    ParseResult< IPv4Address >
     IPv4Address::
-    IPv4Address(
-        ::std::unique_ptr< in_addr const > && data )
-        : IPAddress( toRepr( data ) ),
-          _data( ::std::move( data ) )
+    parse(
+        ::std::string_view const & repr ) noexcept
     {
-        auto const bytes = BYTES;
-
-        if (*reinterpret_cast<::std::uint32_t const *>(this->_data.get()) == 0)
-        {
-            this->_is_unspecified = true;
-            this->_is_reserved = true;
-        }
-        else if (bytes[0] == 127) // 127.0.0.0/8
-        {
-            this->_is_loopback = true;
-            this->_is_reserved = true;
-        }
-        else if (bytes[0] == 169 && bytes[1] == 254) // 169.254.0.0/16
-        {
-            this->_is_link_local = true;
-            this->_is_reserved = true;
-        }
-        else if (bytes[0] == 10 || // 10.0.0.0/8
-                 (bytes[0] == 100 && bytes[1] >= 64 && bytes[1] <= 127) || // 100.64.0.0/10
-                 (bytes[0] == 172 && bytes[1] >= 16 && bytes[1] <= 31) || // 172.16.0.0/12
-                 (bytes[0] == 192 && bytes[1] == 0 && bytes[2] == 0) || // 192.0.0.0/24
-                 (bytes[0] == 192 && bytes[1] == 168) || // 192.168.0.0/16
-                 (bytes[0] == 198 && bytes[1] >= 18 && bytes[1] <= 19) // 198.18.0.0/15
-                )
-        {
-            this->_is_private = true;
-            this->_is_reserved = true;
-        }
-        else if (bytes[0] >= 224 && bytes[0] <= 239) // 224.0.0.0/4
+        in_addr data{};
+        if ( auto const error( parseRepr( repr, data ) ); error != ParseError::None )
         {
-            this->_is_multicast = true;
-            this->_is_reserved = true;
-        }
-        // various other reserved ranges, see https://en.wikipedia.org/wiki/Reserved_IP_addresses
-        else if (bytes[0] == 0 || // 0.0.0.0/8
-                 (bytes[0] == 192 && bytes[1] == 0 && bytes[2] == 2) || // 192.0.2.0/24
-                 (bytes[0] == 192 && bytes[1] == 88 && bytes[2] == 99) || // 192.88.99.0/24
-                 (bytes[0] == 198 && bytes[1] == 51 && bytes[2] == 100) || // 198.51.100.0/24
-                 (bytes[0] == 203 && bytes[1] == 0 && bytes[2] == 113) || // 203.0.113.0/24
-                 (bytes[0] == 233 && bytes[1] == 252 && bytes[2] == 0) || // 233.252.0.0/24
-                 bytes[0] >= 240 // 240.0.0.0/4
-                )
-        {
-            this->_is_reserved = true;
+            return { ::std::nullopt, error };
         }
+        return { IPv4Address( data ), ParseError::None };
+    }
 
-        if (this->is_multicast())
-        {
-            if (bytes[0] == 224 && bytes[1] == 0 && bytes[2] == 0) // 224.0.0.0/24
-            {
-                this->_multicast_scope = MulticastScope::LinkLocal;
-            }
-            else if (bytes[0] == 239 && bytes[1] == 255) // 239.255.0.0/16
-            {
-                this->_multicast_scope = MulticastScope::RealmLocal;
-            }
-            else if (bytes[0] == 239 && bytes[1] >= 192 && bytes[1] <= 195) // 239.192.0.0/14
-            {
-                this->_multicast_scope = MulticastScope::OrganizationLocal;
-            }
-            else if (bytes[0] != 239) // // 224.0.1.0-238.255.255.255
-            {
-                this->_multicast_scope = MulticastScope::Global;
-            }
-            else
-            {
-                this->_multicast_scope = MulticastScope::Unassigned;
-            }
-        }
+    OddSource_Inline
+    ::std::optional< IPv4Address >
+    IPv4Address::
+    try_parse(
+        ::std::string_view const & repr ) noexcept
+    {
+        return IPv4Address::parse( repr ).address;
     }
 
     OddSource_Inline
     IPv4Address::
     IPv4Address(
-       IPv4Address const & other )
-        : IPAddress( other ),
-          _data( copy_in_addr( other._data ) )
+        in_addr const & data )
+        : _representation(),
+          _data( data )
     {
     }
 
     OddSource_Inline
     IPv4Address::
     IPv4Address(
-       IPv4Address && other ) noexcept
-        : IPAddress( std::move( other ) ),
-          _data( std::move( other._data ) )
+       IPv4Address const & other ) = default;
+
+    OddSource_Inline
+    IPv4Address::
+    IPv4Address(
+       IPv4Address && other ) noexcept = default;
+
+    OddSource_Inline
+    IPv4Address &
+    IPv4Address::
+    operator=(
+        IPv4Address const & other ) = default;
+
+    OddSource_Inline
+    IPv4Address &
+    IPv4Address::
+    operator=(
+        IPv4Address && other ) noexcept = default;
+
+    OddSource_Inline
+    IPv4Address::
+    ~IPv4Address() noexcept // NOLINT(*-use-equals-default)
     {
     }
 
     OddSource_Inline
     IPv4Address::
-    ~IPv4Address() noexcept // NOLINT(*-use-equals-default)
+    operator ::std::string() const
+    {
+        return this->representation();
+    }
+
+    OddSource_Inline
+    IPv4Address::
+    operator char const *() const
     {
+        return this->representation();
+    }
+
+    OddSource_Inline
+    char const *
+    IPv4Address::
+    representation() const
+    {
+        return this->_representation.get( [ this ]( auto & chars )
+        {
+            toRepr( this->_data, chars );
+        } );
     }
 
     OddSource_Inline
@@ -678,18 +817,35 @@ namespace OddSource::Interfaces
         return 4;
     }
 
+    OddSource_Inline
+    ::std::uint32_t
+    IPv4Address::
+    classify() const noexcept
+    {
+        auto const address( ntohl( this->_data.s_addr ) );
+        for ( auto const & range : IPV4_RANGES )
+        {
+            auto const mask( range.prefix_length == 0 ? 0u : ~0u << ( 32 - range.prefix_length ) );
+            if ( ( address & mask ) == range.network )
+            {
+                return range.classification;
+            }
+        }
+        return 0;
+    }
+
     OddSource_Inline
     IPv4Address::
     operator in_addr const *() const
     {
-        return this->_data.get();
+        return &this->_data;
     }
 
     OddSource_Inline
     IPv4Address::
     operator ::std::uint32_t() const
     {
-        return ntohl( this->_data->s_addr );
+        return ntohl( this->_data.s_addr );
     }
 
     OddSource_Inline
@@ -698,8 +854,7 @@ namespace OddSource::Interfaces
     operator==(
         IPv4Address const & other ) const
     {
-        return (*reinterpret_cast<::std::uint32_t const *>(this->_data.get()) ==
-                *reinterpret_cast<::std::uint32_t const *>(other._data.get()));
+        return this->_data.s_addr == other._data.s_addr;
     }
 
     OddSource_Inline
@@ -723,7 +878,7 @@ namespace OddSource::Interfaces
     IPv6Address::
     IPv6Address(
         in6_addr const * data )
-        : IPv6Address( copy_in_addr( data ), std::nullopt )
+        : IPv6Address( *data, std::nullopt )
     {
     }
 
@@ -733,7 +888,7 @@ namespace OddSource::Interfaces
         in6_addr const * data,
         ::std::uint32_t const scopeId )
         : IPv6Address(
-            copy_in_addr( data ),
+            *data,
             scopeId > 0 ? ::std::optional( scopeFrom( scopeId ) ) : ::std::nullopt )
     {
     }
@@ -743,7 +898,7 @@ namespace OddSource::Interfaces
     IPv6Address(
         in6_addr const * data,
         ::std::string_view const & scopeName )
-        : IPv6Address( copy_in_addr( data ), scopeFrom( scopeName ) )
+        : IPv6Address( *data, scopeFrom( scopeName ) )
     {
     }
 
@@ -752,7 +907,7 @@ namespace OddSource::Interfaces
     IPv6Address(
         in6_addr const * data,
         v6Scope const & scope )
-        : IPv6Address( copy_in_addr( data ), scope )
+        : IPv6Address( *data, scope )
     {
     }
 
@@ -793,13 +948,50 @@ namespace OddSource::Interfaces
     {
     }
 
+    OddSource_Inline
+    ParseResult< IPv6Address >
+    IPv6Address::
+    parse(
+        ::std::string_view const & repr ) noexcept
+    {
+        auto const reprWithoutScope( stripScope( repr ) );
+        in6_addr data{};
+        if ( auto const error( parseRepr( reprWithoutScope, data ) ); error != ParseError::None )
+        {
+            return { ::std::nullopt, error };
+        }
+        ::std::optional< v6Scope > scope;
+        if ( auto const error( parseScope( repr, scope ) ); error != ParseError::None )
+        {
+            return { ::std::nullopt, error };
+        }
+        try
+        {
+            return { IPv6Address( reprWithoutScope, data, ::std::move( scope ) ), ParseError::None };
+        }
+        catch ( ... )
+        {
+            // only an address with a scope name too long to store inline allocates, and this one could not
+            return { ::std::nullopt, ParseError::InvalidScope };
+        }
+    }
+
+    OddSource_Inline
+    ::std::optional< IPv6Address >
+    IPv6Address::
+    try_parse(
+        ::std::string_view const & repr ) noexcept
+    {
+        return IPv6Address::parse( repr ).address;
+    }
+
     OddSource_Inline
     IPv6Address::
     IPv6Address(
         ::std::string_view const & reprWithScope,
         ::std::string_view const & reprWithoutScope )
         : IPv6Address(
-            std::string( reprWithoutScope ),
+            reprWithoutScope,
             fromRepr< in6_addr >( reprWithoutScope ),
             extractScope( reprWithScope ) )
     {
@@ -808,111 +1000,50 @@ namespace OddSource::Interfaces
     OddSource_Inline
     IPv6Address::
     IPv6Address(
-        ::std::unique_ptr< in6_addr const > && data,
+        in6_addr const & data,
         ::std::optional< v6Scope > && scope )
-        : IPv6Address( toRepr( data.get() ), std::move( data ), std::move( scope ) )
+        : IPv6Address( ::std::string_view(), data, std::move( scope ) )
     {
     }
 
     OddSource_Inline
     IPv6Address::
     IPv6Address(
-        ::std::string && reprWithoutScope,
-        ::std::unique_ptr< in6_addr const > && data,
+        ::std::string_view const & reprWithoutScope,
+        in6_addr const & data,
         ::std::optional< v6Scope > && scope )
-        : IPAddress( addScope( reprWithoutScope, scope ) ),
-          _data( ::std::move( data ) ),
+        : _data( data ),
           _scope( std::move( scope ) ),
-          _without_scope( reprWithoutScope )
+          _representation(),
+          _longRepresentation()
     {
-        auto const bytes = BYTES;
-        auto const words = WORDS;
-        auto const doublewords = DOUBLEWORDS;
-
-        if (IN6_IS_ADDR_UNSPECIFIED(this->_data.get()))
+        if ( this->_scope && this->_scope->scope_name &&
+             this->_scope->scope_name->length() > MAX_SCOPE_NAME_LENGTH )
         {
-            this->_is_unspecified = true;
-            this->_is_reserved = true;
-        }
-        else if(IN6_IS_ADDR_LOOPBACK(this->_data.get()))
-        {
-            this->_is_loopback = true;
-            this->_is_reserved = true;
-        }
-        else if(IN6_IS_ADDR_LINKLOCAL(this->_data.get()) && // some impls erroneously check *only* fe80
-                words[1] == 0 && words[2] == 0 && words[3] == 0)
-        {
-            this->_is_link_local = true;
-            this->_is_reserved = true;
-        }
-        // IN6_IS_ADDR_UNIQUE_LOCAL is available only on BSD-based systems like macOS
-        else if(bytes[0] == 0xfc || bytes[0] == 0xfd)
-        {
-            this->_is_unique_local = true;
-            this->_is_private = true;
-            this->_is_reserved = true;
-        }
-        else if(IN6_IS_ADDR_SITELOCAL(this->_data.get()))
-        {
-            this->_is_site_local = true;
-            this->_is_private = true;
-            this->_is_reserved = true;
-        }
-        else if(IN6_IS_ADDR_MULTICAST(this->_data.get()))
-        {
-            this->_is_multicast = true;
-            this->_is_reserved = true;
-        }
-        else if(IN6_IS_ADDR_V4MAPPED(this->_data.get()))
-        {
-            this->_is_v4_mapped = true;
-            this->_is_reserved = true;
-        }
-        else if(IN6_IS_ADDR_V4COMPAT(this->_data.get()))
-        {
-            this->_is_v4_compatible = true;
-            this->_is_reserved = true;
-        }
-        // IN6_IS_ADDR_V4TRANSLATED is available only on Windows SDK / Winsock 2
-        else if(doublewords[0] == 0 && doublewords[1] == 0 && words[4] == 0xffff && words[5] == 0)
-        {
-            this->_is_v4_translated = true;
-            this->_is_reserved = true;
-        }
-        // IN6_IS_ADDR_6TO4 is available only on BSD-based systems like macOS
-        else if(ntohs(words[0]) == 0x2002)
-        {
-            this->_is_6to4 = true;
-            this->_is_reserved = true;
-        }
-        // various other reserved ranges, see https://en.wikipedia.org/wiki/Reserved_IP_addresses
-        else if((ntohs(words[0]) == 0x64 && ntohs(words[1]) == 0xff9b && doublewords[1] == 0 && doublewords[2] == 0) || // 64:ff9b::/96
-                (ntohs(words[0]) == 0x64 && ntohs(words[1]) == 0xff9b && doublewords[1] == 1) || // 64:ff9b:1::/48
-                (ntohs(words[0]) == 0x100 && words[1] == 0 && doublewords[1] == 0) || // 100::/64
-                (ntohs(words[0]) == 0x2001 && words[1] == 0) || // 2001:0000::/32
-                (ntohs(words[0]) == 0x2001 && ntohs(words[1]) >= 0x20 && ntohs(words[1]) <= 0x2f) || // 2001:20::/28
-                (ntohs(words[0]) == 0x2001 && ntohs(words[1]) == 0xdb8) // 2001:db8::/32
-               )
-        {
-            this->_is_reserved = true;
+            // too long for the inline representation, so format the whole thing now, on the heap
+            char address[ MAX_REPRESENTATION_LENGTH + 1 ];
+            size_t length( reprWithoutScope.length() );
+            if ( reprWithoutScope.empty() )
+            {
+                length = toRepr( this->_data, address );
+            }
+            else
+            {
+                ::std::memcpy( address, reprWithoutScope.data(), length );
+            }
+            auto const size( length + this->_scope->scope_name->length() + 2 );
+            this->_longRepresentation = ::std::make_unique< char[] >( size );
+            ::std::memcpy( this->_longRepresentation.get(), address, length );
+            addScope( this->_longRepresentation.get(), length, this->_scope );
         }
-
-        if (this->is_multicast())
+        else if ( !reprWithoutScope.empty() )
         {
-            this->_multicast_flags = (bytes[1] & 0b11110000) >> 4;
-            switch (bytes[1] & 0b1111)
+            // keep the string the address was parsed from (it's already been validated), which costs only a copy
+            static_cast< void >( this->_representation.get( [ & ]( auto & chars )
             {
-                case 0x0:
-                case 0xf: this->_multicast_scope = MulticastScope::Reserved; break;
-                case 0x1: this->_multicast_scope = MulticastScope::InterfaceLocal; break;
-                case 0x2: this->_multicast_scope = MulticastScope::LinkLocal; break;
-                case 0x3: this->_multicast_scope = MulticastScope::RealmLocal; break;
-                case 0x4: this->_multicast_scope = MulticastScope::AdminLocal; break;
-                case 0x5: this->_multicast_scope = MulticastScope::SiteLocal; break;
-                case 0x8: this->_multicast_scope = MulticastScope::OrganizationLocal; break;
-                case 0xe: this->_multicast_scope = MulticastScope::Global; break;
-                default: this->_multicast_scope = MulticastScope::Unassigned; break;
-            }
+                ::std::memcpy( chars, reprWithoutScope.data(), reprWithoutScope.length() );
+                addScope( chars, reprWithoutScope.length(), this->_scope );
+            } ) );
         }
     }
 
@@ -921,43 +1052,77 @@ namespace OddSource::Interfaces
     IPv6Address(
         IPv6Address const & other )
         : IPAddress( other ),
-          _data( copy_in_addr( other._data ) ),
+          _data( other._data ),
           _scope( other._scope ),
-          _without_scope( other._without_scope ),
-          _is_unique_local( other._is_unique_local ),
-          _is_site_local( other._is_site_local ),
-          _is_v4_mapped( other._is_v4_mapped ),
-          _is_v4_compatible( other._is_v4_compatible ),
-          _is_v4_translated( other._is_v4_translated ),
-          _is_6to4( other._is_6to4 ),
-          _multicast_flags( other._multicast_flags )
+          _representation( other._representation ),
+          _longRepresentation( copyRepresentation( other._longRepresentation ) )
     {
     }
 
     OddSource_Inline
     IPv6Address::
     IPv6Address(
-        IPv6Address && other ) noexcept
-        : IPAddress( std::move( other ) ),
-          _data( copy_in_addr( other._data ) ),
-          _scope( other._scope ),
-          _without_scope( other._without_scope ),
-          _is_unique_local( other._is_unique_local ),
-          _is_site_local( other._is_site_local ),
-          _is_v4_mapped( other._is_v4_mapped ),
-          _is_v4_compatible( other._is_v4_compatible ),
-          _is_v4_translated( other._is_v4_translated ),
-          _is_6to4( other._is_6to4 ),
-          _multicast_flags( other._multicast_flags )
+        IPv6Address && other ) noexcept = default;
+
+    OddSource_Inline
+    IPv6Address &
+    IPv6Address::
+    operator=(
+        IPv6Address const & other )
     {
+        if ( this != &other )
+        {
+            auto longRepresentation( copyRepresentation( other._longRepresentation ) );
+            IPAddress::operator=( other );
+            this->_data = other._data;
+            this->_scope = other._scope;
+            this->_representation = other._representation;
+            this->_longRepresentation = ::std::move( longRepresentation );
+        }
+        return *this;
     }
 
+    OddSource_Inline
+    IPv6Address &
+    IPv6Address::
+    operator=(
+        IPv6Address && other ) noexcept = default;
+
     OddSource_Inline
     IPv6Address::
     ~IPv6Address() noexcept // NOLINT(*-use-equals-default)
     {
     }
 
+    OddSource_Inline
+    IPv6Address::
+    operator ::std::string() const
+    {
+        return this->representation();
+    }
+
+    OddSource_Inline
+    IPv6Address::
+    operator char const *() const
+    {
+        return this->representation();
+    }
+
+    OddSource_Inline
+    char const *
+    IPv6Address::
+    representation() const
+    {
+        if ( this->_longRepresentation )
+        {
+            return this->_longRepresentation.get();
+        }
+        return this->_representation.get( [ this ]( auto & chars )
+        {
+            addScope( chars, toRepr( this->_data, chars ), this->_scope );
+        } );
+    }
+
     OddSource_Inline
     size_t
     IPv6Address::
@@ -966,11 +1131,33 @@ namespace OddSource::Interfaces
         return 16;
     }
 
+    OddSource_Inline
+    ::std::uint32_t
+    IPv6Address::
+    classify() const noexcept
+    {
+        auto const bytes( this->_data.s6_addr );
+        for ( auto const & range : IPV6_RANGES )
+        {
+            if ( inRange( bytes, range ) )
+            {
+                if ( range.classification & IS_MULTICAST )
+                {
+                    return range.classification |
+                           scopeBits( IPV6_MULTICAST_SCOPES[ bytes[ 1 ] & 0xf ] ) |
+                           ( static_cast< ::std::uint32_t >( bytes[ 1 ] >> 4 ) << MULTICAST_FLAGS_SHIFT );
+                }
+                return range.classification;
+            }
+        }
+        return 0;
+    }
+
     OddSource_Inline
     IPv6Address::
     operator in6_addr const *() const
     {
-        return this->_data.get();
+        return &this->_data;
     }
 
     OddSource_Inline
@@ -978,7 +1165,7 @@ namespace OddSource::Interfaces
     operator Bytes() const
     {
         Bytes result{};
-        ::std::memcpy( result.data(), this->_data->s6_addr, 16 );
+        ::std::memcpy( result.data(), this->_data.s6_addr, 16 );
         return result;
     }
 
@@ -989,9 +1176,9 @@ namespace OddSource::Interfaces
     {
         if (this->_scope)
         {
-            return { this->_data.get(), *this->_scope };
+            return { &this->_data, *this->_scope };
         }
-        return IPv6Address( this->_data.get() );
+        return IPv6Address( &this->_data );
     }
 
     OddSource_Inline
@@ -999,7 +1186,7 @@ namespace OddSource::Interfaces
     IPv6Address::
     is_unique_local() const
     {
-        return this->_is_unique_local;
+        return ( this->classification() & IS_UNIQUE_LOCAL ) != 0;
     }
 
     OddSource_Inline
@@ -1007,7 +1194,7 @@ namespace OddSource::Interfaces
     IPv6Address::
     is_site_local() const
     {
-        return this->_is_site_local;
+        return ( this->classification() & IS_SITE_LOCAL ) != 0;
     }
 
     OddSource_Inline
@@ -1015,7 +1202,7 @@ namespace OddSource::Interfaces
     IPv6Address::
     is_v4_mapped() const
     {
-        return this->_is_v4_mapped;
+        return ( this->classification() & IS_V4_MAPPED ) != 0;
     }
 
     OddSource_Inline
@@ -1023,7 +1210,7 @@ namespace OddSource::Interfaces
     IPv6Address::
     is_v4_translated() const
     {
-        return this->_is_v4_translated;
+        return ( this->classification() & IS_V4_TRANSLATED ) != 0;
     }
 
     OddSource_Inline
@@ -1031,7 +1218,7 @@ namespace OddSource::Interfaces
     IPv6Address::
     is_v4_compatible() const
     {
-        return this->_is_v4_compatible;
+        return ( this->classification() & IS_V4_COMPATIBLE ) != 0;
     }
 
     OddSource_Inline
@@ -1039,7 +1226,7 @@ namespace OddSource::Interfaces
     IPv6Address::
     is_6to4() const
     {
-        return this->_is_6to4;
+        return ( this->classification() & IS_6TO4 ) != 0;
     }
 
     OddSource_Inline
@@ -1055,7 +1242,8 @@ namespace OddSource::Interfaces
     IPv6Address::
     without_scope_id() const
     {
-        return this->_without_scope;
+        auto const repr( this->representation() );
+        return { repr, ::std::strcspn( repr, "%" ) };
     }
 
     OddSource_Inline
@@ -1106,7 +1294,9 @@ namespace OddSource::Interfaces
     is_multicast_flag_enabled(
         MulticastV6Flag const & flag ) const
     {
-        return this->_multicast_flags && ( *this->_multicast_flags & flag ) == flag;
+        auto const classification( this->classification() );
+        auto const flags( static_cast< ::std::uint8_t >( ( classification >> MULTICAST_FLAGS_SHIFT ) & 0xf ) );
+        return ( classification & IS_MULTICAST ) != 0 && ( flags & flag ) == flag;
     }
 
     OddSource_Inline
@@ -1115,17 +1305,7 @@ namespace OddSource::Interfaces
     operator==(
         IPv6Address const & other ) const
     {
-        auto data1 = reinterpret_cast<::std::uint8_t const *>(this->_data.get());
-        auto data2 = reinterpret_cast<::std::uint8_t const *>(other._data.get());
-        auto length = this->data_length();
-        for(size_t i(0); i < length; i++)
-        {
-            if (data1[i] != data2[i])
-            {
-                return false;
-            }
-        }
-        return true;
+        return ::std::memcmp( &this->_data, &other._data, sizeof( in6_addr ) ) == 0;
     }
 
     OddSource_Inline
@@ -1151,10 +1331,7 @@ namespace OddSource::Interfaces
         ::std::ostream & os,
         IPAddress const & address )
     {
-        return os << address.operator::std::string();
+        return os << static_cast< char const * >( address );
     }
 } // end namespace OddSource::Interfaces
 
-#undef BYTES
-#undef WORDS
-#undef DOUBLEWORDS
@@ -20,14 +20,10 @@
 #include "../MacAddress.hpp"
 #endif /* IFADDRS4CPP_INLINE_SOURCE */
 
-// ReSharper disable once CppUnusedIncludeDirective
-#include <cctype>
-// ReSharper disable once CppUnusedIncludeDirective
-#include <cstdio>
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <iostream>
-#include <memory>
-#include <sstream>
 #include <utility>
 
 // ReSharper disable once CppUnnamedNamespaceInHeaderFile
@@ -35,144 +31,230 @@ namespace
 {
     using namespace OddSource::Interfaces;
 
-    ::std::unique_ptr< ::std::uint8_t[] >
+    using HardwareAddress = ::std::array< ::std::uint8_t, MAX_ADAPTER_ADDRESS_LENGTH >;
+
+    HardwareAddress
     copyHardwareAddress(
         ::std::uint8_t const data[ MAX_ADAPTER_ADDRESS_LENGTH ],
         ::std::uint8_t dataLength )
     {
-        auto new_data = ::std::make_unique< ::std::uint8_t[] >( dataLength );
-        ::std::memcpy( new_data.get(), data, dataLength );
+        // only dataLength bytes are readable; the rest stay zero
+        HardwareAddress new_data {};
+        ::std::memcpy( new_data.data(), data, dataLength );
         return new_data;
     }
 
-    ::std::uint8_t
-    predictReprLength(
-        ::std::string_view const & repr )
+    /**
+     * The two lowercase hex digits of every byte, so that formatting a byte is a two-character copy.
+     */
+    struct HexDigitPairs
     {
-        ::std::uint8_t count{ 0 };
-        for ( char const & c: repr )
+        char pairs[ 256 ][ 2 ];
+
+        constexpr
+        HexDigitPairs()
+            : pairs()
         {
-            if ( c == ':' || c == '-' )
+            constexpr char const digits[] { "0123456789abcdef" };
+            for ( size_t i{ 0 }; i < 256; i++ )
             {
-                count++;
+                pairs[ i ][ 0 ] = digits[ i >> 4 ];
+                pairs[ i ][ 1 ] = digits[ i & 0xf ];
             }
         }
-        return count + 1;
-    }
+    };
 
-#define MAC_ADDR_REPR_POS ::std::string( repr ) + "' at position "s + std::to_string( position )
+    constexpr HexDigitPairs const HEX_DIGIT_PAIRS {};
 
-    ::std::unique_ptr< ::std::uint8_t[] >
-    fromRepr(
-        ::std::string_view const & repr )
+    // what each character of a MAC address string is: the value of a hex digit, or one of these
+    enum : ::std::uint8_t
     {
-        using namespace ::std::string_literals;
-        // GNUC has ether_aton_r, which is thread-safe, but BSD systems have
-        // ether_aton, which is not thread safe and basically cannot safely be used.
-        // Windows has no built-in method until C#. So ... let's try something simple-ish.
-        auto predicted_length( static_cast< size_t >( predictReprLength( repr ) ) );
-        if (predicted_length > MAX_ADAPTER_ADDRESS_LENGTH)
+        PAIR_SEPARATOR = 0x10,
+        QUAD_SEPARATOR = 0x20,
+        INVALID_CHARACTER = 0xff,
+    };
+
+    constexpr auto const MAC_CHARACTER_CLASSES( []
+    {
+        ::std::array< ::std::uint8_t, 256 > classes{};
+        for ( auto & c : classes )
+        {
+            c = INVALID_CHARACTER;
+        }
+        for ( ::std::uint8_t i{ 0 }; i < 10; i++ )
         {
-            ::std::ostringstream oss;
-            oss << "MAC address length (" << ::std::to_string(predicted_length)
-                << " bytes) too long (max " << ::std::to_string(MAX_ADAPTER_ADDRESS_LENGTH)
-                << " bytes).";
-            throw InvalidMacAddress(oss.str());
+            classes[ '0' + i ] = i;
         }
-        if (predicted_length < MIN_ADAPTER_ADDRESS_LENGTH)
+        for ( ::std::uint8_t i{ 0 }; i < 6; i++ )
         {
-            ::std::ostringstream oss;
-            oss << "MAC address length (" << ::std::to_string(predicted_length)
-                 << " bytes) too short (min " << ::std::to_string(MIN_ADAPTER_ADDRESS_LENGTH)
-                 << " bytes).";
-            throw InvalidMacAddress(oss.str());
+            classes[ 'a' + i ] = classes[ 'A' + i ] = static_cast< ::std::uint8_t >( 10 + i );
+        }
+        classes[ static_cast< unsigned char >( ':' ) ] = PAIR_SEPARATOR;
+        classes[ static_cast< unsigned char >( '-' ) ] = PAIR_SEPARATOR;
+        classes[ static_cast< unsigned char >( '.' ) ] = QUAD_SEPARATOR;
+        return classes;
+    }() );
+
+    /**
+     * Parses a MAC address string in one pass without throwing, so that the constructor, the parse functions, and
+     * parse_all can all use it. The string may be pairs of hex digits separated by : or - (aa:bb:cc:dd:ee:ff),
+     * groups of four hex digits separated by . as Cisco devices print them (aabb.ccdd.eeff), or bare hex digits
+     * (aabbccddeeff). The first separator decides which. Only data[0, data_length) is written. On failure,
+     * position is where parsing stopped.
+     */
+    ParseError
+    parseRepr(
+        ::std::string_view const & repr,
+        ::std::uint8_t * data,
+        ::std::uint8_t & data_length,
+        size_t & position ) noexcept
+    {
+        position = 0;
+        if ( repr.empty() )
+        {
+            return ParseError::Empty;
         }
 
-        auto data = ::std::make_unique<::std::uint8_t[]>(MAX_ADAPTER_ADDRESS_LENGTH);
-        size_t size(0), position(0);
-        ::std::uint8_t byte(0), chars_in_byte(0);
-        for (char c : repr)
+        // the digits per group is 0 until the first separator, and stays 0 for bare hex digits
+        size_t size{ 0 }, digits{ 0 }, group{ 0 };
+        ::std::uint8_t byte{ 0 }, separator{ 0 };
+        for ( ; position < repr.length(); position++ )
         {
-            char ch = (char)::std::tolower(c);
-            if (ch == ':' || ch == '-')
+            auto const value( MAC_CHARACTER_CLASSES[ static_cast< unsigned char >( repr[ position ] ) ] );
+            if ( value < 16 )
             {
-                if (chars_in_byte != 2)
+                if ( digits == group && group != 0 )
                 {
-                    throw InvalidMacAddress("Unexpected separator in MAC address '"s + MAC_ADDR_REPR_POS);
+                    return ParseError::Malformed;
                 }
-                data[size++] = byte;
-                byte = chars_in_byte = 0;
-            }
-            else if ((ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'f'))
-            {
-                chars_in_byte++;
-                if (chars_in_byte > 2)
+                byte = static_cast< ::std::uint8_t >( ( byte << 4 ) | value );
+                if ( ++digits % 2 == 0 )
                 {
-                    throw InvalidMacAddress(
-                        "Invalid number of characters "s + ::std::to_string(chars_in_byte) +
-                        " between separators in MAC address '"s + MAC_ADDR_REPR_POS);
+                    if ( size == MAX_ADAPTER_ADDRESS_LENGTH )
+                    {
+                        return ParseError::InvalidLength;
+                    }
+                    data[ size++ ] = byte;
                 }
-                byte <<= 4;
-                byte += ::std::isdigit(ch) ? (ch - '0') : (ch - 'a' + 10);
+                continue;
             }
-            else
+            if ( value == INVALID_CHARACTER )
             {
-                throw InvalidMacAddress("Invalid character '"s + ch + "' in MAC address "s + MAC_ADDR_REPR_POS);
+                return ParseError::Malformed;
             }
+            if ( separator == 0 )
+            {
+                separator = value;
+                group = value == PAIR_SEPARATOR ? 2 : 4;
+            }
+            if ( value != separator || digits != group )
+            {
+                return ParseError::Malformed;
+            }
+            digits = 0;
+        }
+        if ( group == 0 ? digits % 2 != 0 : digits != group )
+        {
+            return ParseError::Malformed;
+        }
+        if ( size < MIN_ADAPTER_ADDRESS_LENGTH )
+        {
+            return ParseError::InvalidLength;
+        }
+        data_length = static_cast< ::std::uint8_t >( size );
+        return ParseError::None;
+    }
 
-            position++;
+    /**
+     * Parses a MAC address string, throwing InvalidMacAddress if it is not one. Only strings that fail are parsed
+     * twice, to find out what is wrong with them.
+     */
+    MacAddress
+    fromRepr(
+        ::std::string_view const & repr )
+    {
+        using namespace ::std::string_literals;
+        auto result( MacAddress::parse( repr ) );
+        if ( result )
+        {
+            return *::std::move( result.address );
         }
-        if (chars_in_byte != 2)
+
+        HardwareAddress data {};
+        ::std::uint8_t data_length( 0 );
+        size_t position( 0 );
+        static_cast< void >( parseRepr( repr, data.data(), data_length, position ) );
+        if ( result.error == ParseError::Empty )
         {
-            throw InvalidMacAddress("Unexpected separator in MAC address '"s + MAC_ADDR_REPR_POS);
+            throw InvalidMacAddress( "MAC address length (0 bytes) too short (min "s +
+                                     ::std::to_string( MIN_ADAPTER_ADDRESS_LENGTH ) + " bytes)."s );
         }
-        data[size++] = byte;
-        if(size != predicted_length)
+        if ( result.error == ParseError::InvalidLength )
         {
-            throw InvalidMacAddress(
-                "Malformed MAC address '"s + ::std::string(repr) + "' did not match expected length "s +
-                ::std::to_string(predicted_length) + "."s);
+            throw InvalidMacAddress( position < repr.length()
+                ? "MAC address '"s + ::std::string( repr ) + "' too long (max "s +
+                  ::std::to_string( MAX_ADAPTER_ADDRESS_LENGTH ) + " bytes)."s
+                : "MAC address '"s + ::std::string( repr ) + "' too short (min "s +
+                  ::std::to_string( MIN_ADAPTER_ADDRESS_LENGTH ) + " bytes)."s );
         }
 
-        return data;
+        auto const where( "' at position "s + ::std::to_string( position ) );
+        if ( position == repr.length() )
+        {
+            throw InvalidMacAddress( "Incomplete last group of digits in MAC address '"s + ::std::string( repr ) +
+                                     where );
+        }
+        auto const c( repr[ position ] );
+        auto const value( MAC_CHARACTER_CLASSES[ static_cast< unsigned char >( c ) ] );
+        if ( value == PAIR_SEPARATOR || value == QUAD_SEPARATOR )
+        {
+            throw InvalidMacAddress( "Unexpected separator in MAC address '"s + ::std::string( repr ) + where );
+        }
+        if ( value < 16 )
+        {
+            throw InvalidMacAddress( "Too many digits between separators in MAC address '"s + ::std::string( repr ) +
+                                     where );
+        }
+        throw InvalidMacAddress( "Invalid character '"s + c + "' in MAC address '"s + ::std::string( repr ) + where );
     }
 
-#undef MAC_ADDR_REPR_POS
-
-    ::std::string
-    toRepr(
-        ::std::uint8_t const data[MAX_ADAPTER_ADDRESS_LENGTH],
+    ::std::uint8_t
+    checkLength(
         ::std::uint8_t data_length )
     {
-        ::std::ostringstream oss;
-        if (data_length > MAX_ADAPTER_ADDRESS_LENGTH)
+        using namespace ::std::string_literals;
+        if ( data_length > MAX_ADAPTER_ADDRESS_LENGTH )
         {
-            oss << "MAC address length (" << ::std::to_string(data_length)
-                << ") greater than allowed length " << ::std::to_string(MAX_ADAPTER_ADDRESS_LENGTH);
-            throw InvalidMacAddress(oss.str());
+            throw InvalidMacAddress( "MAC address length ("s + ::std::to_string( data_length ) +
+                                     ") greater than allowed length "s +
+                                     ::std::to_string( MAX_ADAPTER_ADDRESS_LENGTH ) );
         }
-        if (data_length < MIN_ADAPTER_ADDRESS_LENGTH)
+        if ( data_length < MIN_ADAPTER_ADDRESS_LENGTH )
         {
-            oss << "MAC address length (" << ::std::to_string(data_length)
-                << " bytes) too short (min " << ::std::to_string(MIN_ADAPTER_ADDRESS_LENGTH) << " bytes).";
-            throw InvalidMacAddress(oss.str());
+            throw InvalidMacAddress( "MAC address length ("s + ::std::to_string( data_length ) +
+                                     " bytes) too short (min "s + ::std::to_string( MIN_ADAPTER_ADDRESS_LENGTH ) +
+                                     " bytes)."s );
         }
+        return data_length;
+    }
 
-        static const ::std::uint8_t formatted_byte_size(3);
-
-        auto buffer = new char[formatted_byte_size];
-        for(::std::uint8_t i(0); i < data_length; i++)
+    // the length must have passed checkLength, so that the result fits
+    void
+    toRepr(
+        HardwareAddress const & data,
+        ::std::uint8_t data_length,
+        char (& repr)[MAX_ADAPTER_ADDRESS_LENGTH * 3] )
+    {
+        // each byte is two digits and a separator, and the last separator becomes the terminator
+        size_t const length( ::std::min< size_t >( data_length, MAX_ADAPTER_ADDRESS_LENGTH ) );
+        for( size_t i( 0 ); i < length; i++ )
         {
-            ::std::snprintf( buffer, formatted_byte_size, "%02x", data[i] );
-            if (i > 0)
-            {
-                oss << ':';
-            }
-            oss << buffer;
+            char const * pair( HEX_DIGIT_PAIRS.pairs[ data[i] ] );
+            repr[i * 3] = pair[0];
+            repr[i * 3 + 1] = pair[1];
+            repr[i * 3 + 2] = ':';
         }
-        delete[] buffer;
-
-        return oss.str();
+        repr[length > 0 ? length * 3 - 1 : 0] = '\0';
     }
 }
 
@@ -204,7 +286,7 @@ namespace OddSource::Interfaces
     MacAddress::
     MacAddress(
         ::std::string_view const & repr )
-        : MacAddress( std::string( repr ), fromRepr(repr), predictReprLength(repr) )
+        : MacAddress( fromRepr( repr ) )
     {
     }
 
@@ -213,20 +295,92 @@ namespace OddSource::Interfaces
     MacAddress(
         ::std::uint8_t const data[MAX_ADAPTER_ADDRESS_LENGTH],
         ::std::uint8_t dataLength )
-        : MacAddress( toRepr(data, dataLength), copyHardwareAddress(data, dataLength), dataLength )
+        : MacAddress( ::std::string_view(), copyHardwareAddress(data, checkLength(dataLength)), dataLength )
     {
     }
 
+    OddSource_Inline
+    ParseResult< MacAddress >
+    MacAddress::
+    parse(
+        ::std::string_view const & repr ) noexcept
+    {
+        HardwareAddress data {};
+        ::std::uint8_t dataLength( 0 );
+        size_t position( 0 );
+        if ( auto const error( parseRepr( repr, data.data(), dataLength, position ) ); error != ParseError::None )
+        {
+            return { ::std::nullopt, error };
+        }
+        return { MacAddress( repr, data, dataLength ), ParseError::None };
+    }
+
+    OddSource_Inline
+    ::std::size_t
+    MacAddress::
+    parse_all(
+        ::std::string_view const * reprs,
+        ::std::size_t count,
+        ::std::uint8_t * data,
+        ::std::uint8_t * lengths,
+        ParseError * errors ) noexcept
+    {
+        size_t parsed{ 0 };
+        for ( size_t i{ 0 }; i < count; i++ )
+        {
+            // parse straight into the caller's array, which is cleared again if the string is not an address
+            auto const bytes( data + i * MAX_ADAPTER_ADDRESS_LENGTH );
+            ::std::memset( bytes, 0, MAX_ADAPTER_ADDRESS_LENGTH );
+            ::std::uint8_t length( 0 );
+            size_t position( 0 );
+            auto const error( parseRepr( reprs[ i ], bytes, length, position ) );
+            if ( error == ParseError::None )
+            {
+                parsed++;
+            }
+            else
+            {
+                ::std::memset( bytes, 0, MAX_ADAPTER_ADDRESS_LENGTH );
+                length = 0;
+            }
+            lengths[ i ] = length;
+            if ( errors != nullptr )
+            {
+                errors[ i ] = error;
+            }
+        }
+        return parsed;
+    }
+
+    OddSource_Inline
+    ::std::optional< MacAddress >
+    MacAddress::
+    try_parse(
+        ::std::string_view const & repr ) noexcept
+    {
+        return MacAddress::parse( repr ).address;
+    }
+
     OddSource_Inline
     MacAddress::
     MacAddress(
-        ::std::string && repr,
-        ::std::unique_ptr< ::std::uint8_t const[] > && data,
+        ::std::string_view const & repr,
+        Bytes const & data,
         ::std::uint8_t dataLength )
-        : _representation( std::move( repr ) ),
-          _data( ::std::move( data ) ),
+        : _representation(),
+          _data( data ),
           _data_length( dataLength )
     {
+        if ( !repr.empty() )
+        {
+            // keep the string the address was parsed from (it's already been validated, and no valid string is
+            // longer than MAX_ADAPTER_ADDRESS_LENGTH colon-separated pairs), which costs only a copy
+            static_cast< void >( this->_representation.get( [ & ]( auto & chars )
+            {
+                ::std::memcpy( chars, repr.data(), repr.length() );
+                chars[ repr.length() ] = '\0';
+            } ) );
+        }
     }
 
     OddSource_Inline
@@ -234,7 +388,7 @@ namespace OddSource::Interfaces
     MacAddress(
         MacAddress const & other )
         : _representation(other._representation),
-          _data(copyHardwareAddress(other._data.get(), other._data_length)),
+          _data(other._data),
           _data_length(other._data_length)
     {
     }
@@ -243,8 +397,8 @@ namespace OddSource::Interfaces
     MacAddress::
     MacAddress(
         MacAddress && other ) noexcept
-        : _representation( std::move( other._representation ) ),
-          _data( std::move( other._data ) ),
+        : _representation( other._representation ),
+          _data( other._data ),
           _data_length( other._data_length )
     {
     }
@@ -259,21 +413,32 @@ namespace OddSource::Interfaces
     MacAddress::
     operator ::std::string() const
     {
-        return this->_representation;
+        return this->representation();
     }
 
     OddSource_Inline
     MacAddress::
     operator char const *() const
     {
-        return this->_representation.c_str();
+        return this->representation();
+    }
+
+    OddSource_Inline
+    char const *
+    MacAddress::
+    representation() const
+    {
+        return this->_representation.get( [ this ]( auto & chars )
+        {
+            toRepr( this->_data, this->_data_length, chars );
+        } );
     }
 
     OddSource_Inline
     MacAddress::
     operator ::std::uint8_t const *() const
     {
-        return this->_data.get();
+        return this->_data.data();
     }
 
     OddSource_Inline
@@ -290,18 +455,8 @@ namespace OddSource::Interfaces
     operator==(
         MacAddress const & other ) const
     {
-        if (this->_data_length != other._data_length)
-        {
-            return false;
-        }
-        for (::std::uint8_t i(0); i < this->_data_length; i++)
-        {
-            if (this->_data[i] != other._data[i])
-            {
-                return false;
-            }
-        }
-        return true;
+        // the bytes past the length are always zero, so all of them can be compared at once
+        return this->_data_length == other._data_length && this->_data == other._data;
     }
 
     OddSource_Inline
@@ -327,6 +482,6 @@ namespace OddSource::Interfaces
         ::std::ostream & os,
         MacAddress const & address )
     {
-        return os << address.operator::std::string();
+        return os << static_cast< char const * >( address );
     }
 }
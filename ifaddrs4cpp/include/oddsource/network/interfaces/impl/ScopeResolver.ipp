@@ -0,0 +1,291 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef IFADDRS4CPP_INLINE_SOURCE
+#include "../ScopeResolver.hpp"
+#endif /* IFADDRS4CPP_INLINE_SOURCE */
+
+#ifdef ODDSOURCE_IS_WINDOWS
+#include "../detail/winsock_includes.h"
+#else /* ODDSOURCE_IS_WINDOWS */
+#include <net/if.h>
+#endif /* ODDSOURCE_IS_WINDOWS */
+
+namespace OddSource::Interfaces
+{
+    OddSource_Inline
+    ScopeResolver::
+    ~ScopeResolver() noexcept = default;
+
+    OddSource_Inline
+    void
+    ScopeResolver::
+    invalidate(
+        ::std::uint32_t,
+        ::std::string_view ) noexcept
+    {
+    }
+
+    OddSource_Inline
+    void
+    ScopeResolver::
+    invalidate() noexcept
+    {
+    }
+
+    OddSource_Inline
+    ScopeResolver::Installation &
+    ScopeResolver::
+    installation()
+    {
+        static Installation installation;
+        return installation;
+    }
+
+    OddSource_Inline
+    ScopeResolver &
+    ScopeResolver::
+    installed()
+    {
+        thread_local ::std::shared_ptr< ScopeResolver > cached;
+        thread_local ::std::uint64_t cachedVersion { 0 };
+
+        auto & state( ScopeResolver::installation() );
+        if ( state.version.load( ::std::memory_order_acquire ) != cachedVersion )
+        {
+            ::std::lock_guard< ::std::mutex > const lock( state.mutex );
+            if ( !state.resolver )
+            {
+                state.resolver = ::std::make_shared< SystemScopeResolver >();
+            }
+            cached = state.resolver;
+            cachedVersion = state.version.load( ::std::memory_order_relaxed );
+        }
+        return *cached;
+    }
+
+    OddSource_Inline
+    ::std::shared_ptr< ScopeResolver >
+    ScopeResolver::
+    install(
+        ::std::shared_ptr< ScopeResolver > resolver )
+    {
+        if ( !resolver )
+        {
+            resolver = ::std::make_shared< SystemScopeResolver >();
+        }
+        auto & state( ScopeResolver::installation() );
+        ::std::lock_guard< ::std::mutex > const lock( state.mutex );
+        state.resolver.swap( resolver );
+        state.version.fetch_add( 1, ::std::memory_order_release );
+        return resolver;
+    }
+
+    OddSource_Inline
+    ::std::optional< ::std::string >
+    SystemScopeResolver::
+    scope_name(
+        ::std::uint32_t const scopeId ) const
+    {
+        char buffer[IF_NAMESIZE];
+        if ( ::if_indextoname( scopeId, buffer ) != nullptr )
+        {
+            return ::std::string( buffer );
+        }
+        return ::std::nullopt;
+    }
+
+    OddSource_Inline
+    ::std::optional< ::std::uint32_t >
+    SystemScopeResolver::
+    scope_id(
+        ::std::string_view const scopeName ) const
+    {
+        // if_nametoindex needs a null-terminated name, and no interface name is longer than IF_NAMESIZE - 1
+        char buffer[IF_NAMESIZE];
+        if ( scopeName.size() >= sizeof( buffer ) )
+        {
+            return ::std::nullopt;
+        }
+        scopeName.copy( buffer, scopeName.size() );
+        buffer[scopeName.size()] = '\0';
+        ::std::uint32_t const scopeId( ::if_nametoindex( buffer ) );
+        if ( scopeId > 0 )
+        {
+            return scopeId;
+        }
+        return ::std::nullopt;
+    }
+
+    OddSource_Inline
+    CachingScopeResolver::
+    CachingScopeResolver(
+        ::std::shared_ptr< ScopeResolver const > source )
+        : _source( source ? ::std::move( source ) : ::std::make_shared< SystemScopeResolver const >() ),
+          _mutex(),
+          _idToName(),
+          _nameToId()
+    {
+    }
+
+    OddSource_Inline
+    ::std::optional< ::std::string >
+    CachingScopeResolver::
+    scope_name(
+        ::std::uint32_t const scopeId ) const
+    {
+        {
+            ::std::shared_lock< ::std::shared_mutex > const lock( this->_mutex );
+            auto const found( this->_idToName.find( scopeId ) );
+            if ( found != this->_idToName.end() )
+            {
+                return found->second;
+            }
+        }
+        auto scopeName( this->_source->scope_name( scopeId ) );
+        if ( scopeName )
+        {
+            this->remember( scopeId, *scopeName );
+        }
+        return scopeName;
+    }
+
+    OddSource_Inline
+    ::std::optional< ::std::uint32_t >
+    CachingScopeResolver::
+    scope_id(
+        ::std::string_view const scopeName ) const
+    {
+        // interface names fit in std::string's small buffer, so the key does not allocate
+        ::std::string const key( scopeName );
+        {
+            ::std::shared_lock< ::std::shared_mutex > const lock( this->_mutex );
+            auto const found( this->_nameToId.find( key ) );
+            if ( found != this->_nameToId.end() )
+            {
+                return found->second;
+            }
+        }
+        auto const scopeId( this->_source->scope_id( scopeName ) );
+        if ( scopeId )
+        {
+            this->remember( *scopeId, key );
+        }
+        return scopeId;
+    }
+
+    OddSource_Inline
+    void
+    CachingScopeResolver::
+    remember(
+        ::std::uint32_t const scopeId,
+        ::std::string const & scopeName ) const
+    {
+        ::std::unique_lock< ::std::shared_mutex > const lock( this->_mutex );
+        this->_idToName[scopeId] = scopeName;
+        this->_nameToId[scopeName] = scopeId;
+    }
+
+    OddSource_Inline
+    void
+    CachingScopeResolver::
+    invalidate(
+        ::std::uint32_t const scopeId,
+        ::std::string_view const scopeName ) noexcept
+    {
+        try
+        {
+            ::std::unique_lock< ::std::shared_mutex > const lock( this->_mutex );
+            auto const byId( this->_idToName.find( scopeId ) );
+            if ( byId != this->_idToName.end() )
+            {
+                this->_nameToId.erase( byId->second );
+                this->_idToName.erase( byId );
+            }
+            if ( !scopeName.empty() )
+            {
+                auto const byName( this->_nameToId.find( ::std::string( scopeName ) ) );
+                if ( byName != this->_nameToId.end() )
+                {
+                    this->_idToName.erase( byName->second );
+                    this->_nameToId.erase( byName );
+                }
+            }
+        }
+        catch ( ... )
+        {
+            // a name too long for the small buffer could not be copied; forget everything instead
+            this->invalidate();
+        }
+    }
+
+    OddSource_Inline
+    void
+    CachingScopeResolver::
+    invalidate() noexcept
+    {
+        ::std::unique_lock< ::std::shared_mutex > const lock( this->_mutex );
+        this->_idToName.clear();
+        this->_nameToId.clear();
+    }
+
+    OddSource_Inline
+    TableScopeResolver::
+    TableScopeResolver(
+        ::std::vector< ::std::pair< ::std::uint32_t, ::std::string > > const & scopes )
+        : _idToName(),
+          _nameToId()
+    {
+        this->_idToName.reserve( scopes.size() );
+        this->_nameToId.reserve( scopes.size() );
+        for ( auto const & [ scopeId, scopeName ] : scopes )
+        {
+            this->_idToName.emplace( scopeId, scopeName );
+            this->_nameToId.emplace( scopeName, scopeId );
+        }
+    }
+
+    OddSource_Inline
+    ::std::optional< ::std::string >
+    TableScopeResolver::
+    scope_name(
+        ::std::uint32_t const scopeId ) const
+    {
+        auto const found( this->_idToName.find( scopeId ) );
+        if ( found != this->_idToName.end() )
+        {
+            return found->second;
+        }
+        return ::std::nullopt;
+    }
+
+    OddSource_Inline
+    ::std::optional< ::std::uint32_t >
+    TableScopeResolver::
+    scope_id(
+        ::std::string_view const scopeName ) const
+    {
+        auto const found( this->_nameToId.find( ::std::string( scopeName ) ) );
+        if ( found != this->_nameToId.end() )
+        {
+            return found->second;
+        }
+        return ::std::nullopt;
+    }
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <oddsource/network/interfaces/AddressList.hpp>
+#include "main.h"
+
+#include <memory>
+#include <string>
+
+using namespace OddSource::Interfaces;
+
+class TestAddressList : public Tests::Test
+{
+public:
+    TestAddressList()
+    {
+        add_test( test_columns );
+        add_test( test_separators_and_comments );
+        add_test( test_errors );
+        add_test( test_threads_match_one_thread );
+    }
+
+    void
+    test_columns()
+    {
+        AddressList const list( "10.0.0.0/8\n2001:db8::/32\n192.168.1.17\n::ffff:192.0.2.1\n0x7f.0.0.1/32\n" );
+
+        assert_equals( list.ipv4_addresses().size(), 3u );
+        assert_equals( list.ipv4_addresses()[ 0 ], static_cast< ::std::uint32_t >( IPv4Address( "10.0.0.0" ) ) );
+        assert_equals( list.ipv4_addresses()[ 1 ], static_cast< ::std::uint32_t >( IPv4Address( "192.168.1.17" ) ) );
+        assert_equals( list.ipv4_addresses()[ 2 ], 0x7f000001u );
+        assert_equals( list.ipv4_prefix_lengths()[ 0 ], 8u );
+        assert_equals( list.ipv4_prefix_lengths()[ 1 ], 32u );
+        assert_equals( list.ipv4_prefix_lengths()[ 2 ], 32u );
+        assert_equals( list.ipv4_lines()[ 0 ], 1u );
+        assert_equals( list.ipv4_lines()[ 1 ], 3u );
+        assert_equals( list.ipv4_lines()[ 2 ], 5u );
+
+        assert_equals( list.ipv6_addresses().size(), 2u );
+        assert_that( list.ipv6_addresses()[ 0 ] ==
+                     static_cast< IPv6Address::Bytes >( IPv6Address( "2001:db8::" ) ) );
+        assert_that( list.ipv6_addresses()[ 1 ] ==
+                     static_cast< IPv6Address::Bytes >( IPv6Address( "::ffff:192.0.2.1" ) ) );
+        assert_equals( list.ipv6_prefix_lengths()[ 0 ], 32u );
+        assert_equals( list.ipv6_prefix_lengths()[ 1 ], 128u );
+        assert_equals( list.ipv6_lines()[ 0 ], 2u );
+        assert_equals( list.ipv6_lines()[ 1 ], 4u );
+
+        assert_that( list.errors().empty() );
+    }
+
+    void
+    test_separators_and_comments()
+    {
+        AddressList const list(
+            "# allowed networks\r\n"
+            "  10.1.0.0/16 ,10.2.0.0/16,,\t10.3.0.0/16\r\n"
+            "\n"
+            "fe80::/10 # link-local, not 10.4.0.0/16\n"
+            "10.5.0.0/16" );
+
+        assert_equals( list.ipv4_addresses().size(), 4u );
+        assert_equals( list.ipv4_addresses()[ 3 ], static_cast< ::std::uint32_t >( IPv4Address( "10.5.0.0" ) ) );
+        assert_equals( list.ipv4_lines()[ 0 ], 2u );
+        assert_equals( list.ipv4_lines()[ 2 ], 2u );
+        assert_equals( list.ipv4_lines()[ 3 ], 5u );
+        assert_equals( list.ipv6_addresses().size(), 1u );
+        assert_equals( list.ipv6_prefix_lengths()[ 0 ], 10u );
+        assert_equals( list.ipv6_lines()[ 0 ], 4u );
+        assert_that( list.errors().empty() );
+
+        AddressList const empty( "\n# nothing here\n , \n" );
+        assert_that( empty.ipv4_addresses().empty() );
+        assert_that( empty.ipv6_addresses().empty() );
+        assert_that( empty.errors().empty() );
+    }
+
+    void
+    test_errors()
+    {
+        ::std::string const text(
+            "10.0.0.1\n"
+            "10.0.0.256, 10.0.0.2/33\n"
+            "10.0.0.3/\n"
+            "2001:db8::1%eth0\n"
+            "/24, 2001:db8::/129, 2001:db8::/x\n"
+            "2001:0db8:0000:0000:0000:0000:0000:0000:0000:0000:0000:0000:0001\n"
+            "2001:db8::2\n" );
+        AddressList const list( text );
+
+        assert_equals( list.ipv4_addresses().size(), 1u );
+        assert_equals( list.ipv6_addresses().size(), 1u );
+        assert_equals( list.ipv6_lines()[ 0 ], 7u );
+
+        auto const & errors( list.errors() );
+        assert_equals( errors.size(), 8u );
+        assert_equals( errors[ 0 ].line, 2u );
+        assert_that( errors[ 0 ].error == ParseError::Malformed );
+        assert_equals( text.substr( errors[ 0 ].offset, errors[ 0 ].length ), "10.0.0.256" );
+        assert_equals( errors[ 1 ].line, 2u );
+        assert_that( errors[ 1 ].error == ParseError::InvalidPrefixLength );
+        assert_equals( text.substr( errors[ 1 ].offset, errors[ 1 ].length ), "10.0.0.2/33" );
+        assert_that( errors[ 2 ].error == ParseError::InvalidPrefixLength );
+        assert_equals( errors[ 3 ].line, 4u );
+        assert_that( errors[ 3 ].error == ParseError::Malformed );
+        assert_that( errors[ 4 ].error == ParseError::Malformed );
+        assert_that( errors[ 5 ].error == ParseError::InvalidPrefixLength );
+        assert_that( errors[ 6 ].error == ParseError::InvalidPrefixLength );
+        assert_equals( errors[ 6 ].line, 5u );
+        assert_that( errors[ 7 ].error == ParseError::TooLong );
+    }
+
+    void
+    test_threads_match_one_thread()
+    {
+        ::std::string text;
+        for ( ::std::uint32_t i = 0; i < 20000; ++i )
+        {
+            switch ( i % 5 )
+            {
+                case 0:
+                    text += "10." + ::std::to_string( i >> 8 ) + "." + ::std::to_string( i & 0xff ) + ".0/24\n";
+                    break;
+                case 1:
+                    text += "2001:db8:" + ::std::to_string( i ) + "::/48, 192.0.2." + ::std::to_string( i & 0xff );
+                    text += "\n";
+                    break;
+                case 2:
+                    text += "# comment " + ::std::to_string( i ) + "\n";
+                    break;
+                case 3:
+                    text += "10.0.0." + ::std::to_string( i ) + "\n";
+                    break;
+                default:
+                    text += "\n";
+                    break;
+            }
+        }
+
+        AddressList const single( text );
+        AddressListOptions options;
+        options.threads = 4;
+        options.min_bytes_per_thread = 1024;
+        AddressList const multiple( text, options );
+
+        // 10.0.0.i is invalid above 255, and 2001:db8:i:: is invalid once i has five digits
+        assert_equals( single.ipv4_addresses().size(), 8051u );
+        assert_equals( single.ipv6_addresses().size(), 2000u );
+        assert_equals( single.errors().size(), 5949u );
+        assert_that( single.ipv4_addresses() == multiple.ipv4_addresses() );
+        assert_that( single.ipv4_prefix_lengths() == multiple.ipv4_prefix_lengths() );
+        assert_that( single.ipv4_lines() == multiple.ipv4_lines() );
+        assert_that( single.ipv6_addresses() == multiple.ipv6_addresses() );
+        assert_that( single.ipv6_prefix_lengths() == multiple.ipv6_prefix_lengths() );
+        assert_that( single.ipv6_lines() == multiple.ipv6_lines() );
+        assert_equals( single.errors().size(), multiple.errors().size() );
+        for ( ::std::size_t i = 0; i < single.errors().size(); ++i )
+        {
+            assert_equals( single.errors()[ i ].line, multiple.errors()[ i ].line );
+            assert_equals( single.errors()[ i ].offset, multiple.errors()[ i ].offset );
+        }
+        assert_equals( multiple.ipv4_lines().back(), 19997u );
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Test >
+    create()
+    {
+        return std::make_unique< TestAddressList >();
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Tests::Test::Registrar< TestAddressList > registrar( "TestAddressList" );
+}
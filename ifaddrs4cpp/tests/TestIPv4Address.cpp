@@ -17,7 +17,11 @@
 #include <oddsource/network/interfaces/IpAddress.hpp>
 #include "main.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
+#include <random>
+#include <string>
 
 #ifdef ODDSOURCE_IS_WINDOWS
 #include <netioapi.h>
@@ -38,6 +42,7 @@ public:
         add_test( test_string_round_trip );
         add_test( test_in_addr_round_trip );
         add_test( test_uint_round_trip );
+        add_test( test_value_semantics_without_allocating );
         add_test( test_unspecified_address );
         add_test( test_loopback_addresses );
         add_test( test_link_local_addresses );
@@ -45,6 +50,11 @@ public:
         add_test( test_private_addresses );
         add_test( test_other_reserved_addresses );
         add_test( test_construct_malformed );
+        add_test( test_parse );
+        add_test( test_format_matches_inet_ntop );
+#ifndef ODDSOURCE_IS_WINDOWS
+        add_test( test_parse_matches_inet_aton );
+#endif /* ODDSOURCE_IS_WINDOWS */
 
 #ifdef ODDSOURCE_INCLUDE_BOOST
         add_test( test_boost_address_conversion );
@@ -106,6 +116,26 @@ public:
         assert_equals( static_cast< ::std::uint32_t >( address ), 1767959308u );
     }
 
+    void
+    test_value_semantics_without_allocating()
+    {
+        in_addr data {};
+        inet_pton( AF_INET, "172.19.52.141", &data );
+
+        auto const before( Tests::allocation_count() );
+        IPv4Address const address( &data );
+        IPv4Address copy( address );
+        IPv4Address moved( ::std::move( copy ) );
+        copy = IPv4Address( 1767959308u );
+        moved = copy;
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Constructing, copying, and moving addresses should not allocate." );
+        assert_equals( static_cast< ::std::string >( address ), "172.19.52.141" );
+        assert_equals( static_cast< ::std::string >( moved ), "105.96.235.12" );
+        assert_equals( moved, copy );
+    }
+
     void
     test_unspecified_address()
     {
@@ -271,6 +301,119 @@ public:
         assert_throws( IPv4Address( "192.168.0.256" ), InvalidIPAddress );
     }
 
+    void
+    test_parse()
+    {
+        static_cast< void >( IPv4Address::parse( "127.0.0.1" ) );
+
+        auto const before( Tests::allocation_count() );
+        auto const parsed( IPv4Address::parse( "192.168.0.1" ) );
+        auto const octal( IPv4Address::try_parse( "0300.0250.0.01" ) );
+        auto const empty( IPv4Address::parse( "" ) );
+        auto const incomplete( IPv4Address::parse( "192.168.0" ) );
+        auto const outOfRange( IPv4Address::parse( "192.168.0.256" ) );
+        auto const tooLong( IPv4Address::parse(
+            "192.168.0.1-and-then-enough-characters-to-make-it-too-long-for-any-address" ) );
+        auto const missing( IPv4Address::try_parse( "localhost" ) );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Parsing should not allocate, whether or not it succeeds." );
+        assert_that( static_cast< bool >( parsed ) );
+        assert_that( parsed.error == ParseError::None );
+        assert_equals( *parsed.address, IPv4Address( "192.168.0.1" ) );
+        assert_that( octal.has_value() );
+        assert_equals( *octal, IPv4Address( "192.168.0.1" ) );
+        assert_not_that( static_cast< bool >( empty ) );
+        assert_that( empty.error == ParseError::Empty );
+        assert_that( incomplete.error == ParseError::Malformed );
+        assert_that( outOfRange.error == ParseError::Malformed );
+        assert_not_that( outOfRange.address.has_value() );
+        assert_that( tooLong.error == ParseError::TooLong );
+        assert_not_that( missing.has_value() );
+    }
+
+    void
+    test_format_matches_inet_ntop()
+    {
+        ::std::mt19937 random( 4 );
+        ::std::uniform_int_distribution< ::std::uint32_t > octet( 0, 255 );
+        for ( size_t i = 0; i < 10000; ++i )
+        {
+            in_addr data{};
+            auto * const bytes( reinterpret_cast< ::std::uint8_t * >( &data ) );
+            for ( size_t j = 0; j < 4; ++j )
+            {
+                // favor one- and two-digit octets, which random bytes rarely are
+                auto const value( octet( random ) );
+                bytes[ j ] = static_cast< ::std::uint8_t >(
+                    value % 4 == 0 ? value % 10 : ( value % 4 == 1 ? value % 100 : value ) );
+            }
+            char expected[ INET_ADDRSTRLEN ];
+            assert_that( inet_ntop( AF_INET, &data, expected, sizeof( expected ) ) != nullptr );
+            assert_equals( static_cast< ::std::string >( IPv4Address( &data ) ), ::std::string( expected ) );
+        }
+    }
+
+#ifndef ODDSOURCE_IS_WINDOWS
+    void
+    test_parse_matches_inet_aton()
+    {
+        static constexpr char const MUTATIONS[]{ "0123456789abcfxX." };
+        ::std::mt19937 random( 4 );
+        for ( size_t i = 0; i < 20000; ++i )
+        {
+            ::std::string repr;
+            for ( size_t j = 0; j < 4; ++j )
+            {
+                auto const value( random() % 300 );
+                char part[ 16 ];
+                switch ( random() % 4 )
+                {
+                    case 0:
+                        ::std::snprintf( part, sizeof( part ), "0%o", static_cast< unsigned >( value ) );
+                        break;
+                    case 1:
+                        ::std::snprintf(
+                            part, sizeof( part ), random() % 2 ? "0x%x" : "0X%02X", static_cast< unsigned >( value ) );
+                        break;
+                    default:
+                        ::std::snprintf( part, sizeof( part ), "%u", static_cast< unsigned >( value ) );
+                        break;
+                }
+                repr += ( j > 0 ? "." : "" ) + ::std::string( part );
+            }
+            if ( random() % 2 )
+            {
+                auto const position( random() % ( repr.length() + 1 ) );
+                auto const mutation( MUTATIONS[ random() % ( sizeof( MUTATIONS ) - 1 ) ] );
+                switch ( random() % 3 )
+                {
+                    case 0:
+                        repr.insert( position, 1, mutation );
+                        break;
+                    case 1:
+                        if ( position < repr.length() ) repr[ position ] = mutation;
+                        break;
+                    default:
+                        if ( position < repr.length() ) repr.erase( position, 1 );
+                        break;
+                }
+            }
+
+            in_addr expected{};
+            // inet_aton also accepts addresses of fewer than four parts, which we do not
+            bool const valid(
+                ::std::count( repr.begin(), repr.end(), '.' ) == 3 && inet_aton( repr.c_str(), &expected ) == 1 );
+            auto const parsed( IPv4Address::try_parse( repr ) );
+            assert_equals( parsed.has_value(), valid, "Parsing '" + repr + "' should agree with inet_aton." );
+            if ( parsed )
+            {
+                assert_equals( static_cast< in_addr const * >( *parsed )->s_addr, expected.s_addr, repr );
+            }
+        }
+    }
+#endif /* ODDSOURCE_IS_WINDOWS */
+
 #ifdef ODDSOURCE_INCLUDE_BOOST
     void
     test_boost_address_conversion()
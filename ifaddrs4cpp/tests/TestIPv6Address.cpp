@@ -15,9 +15,14 @@
  */
 
 #include <oddsource/network/interfaces/IpAddress.hpp>
+#include <oddsource/network/interfaces/detail/ip_codec.hpp>
 #include "main.h"
 
 #include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 #ifdef ODDSOURCE_IS_WINDOWS
 #include <netioapi.h>
@@ -37,10 +42,13 @@ public:
         add_test( test_equals );
         add_test( test_string_round_trip_unscoped );
         add_test( test_string_round_trip_scoped );
+        add_test( test_long_scope_names );
         add_test( test_in_addr_round_trip_unscoped );
         add_test( test_in_addr_round_trip_scoped );
         add_test( test_bytes_round_trip_unscoped );
         add_test( test_bytes_round_trip_scoped );
+        add_test( test_value_semantics_without_allocating );
+        add_test( test_concurrent_formatting );
         add_test( test_normalize );
         add_test( test_unspecified_address );
         add_test( test_loopback_address );
@@ -52,7 +60,11 @@ public:
         add_test( test_v4_translated_addresses );
         add_test( test_v4_compatible_addresses );
         add_test( test_6to4_addresses );
+        add_test( test_other_reserved_addresses );
         add_test( test_construct_malformed );
+        add_test( test_parse );
+        add_test( test_format_matches_inet_ntop );
+        add_test( test_parse_matches_inet_pton );
 
 #ifdef ODDSOURCE_INCLUDE_BOOST
         add_test( test_boost_address_conversion );
@@ -119,6 +131,41 @@ public:
         assert_equals( address2.without_scope_id(), "fe80::f1:1612:447b:70c5" );
     }
 
+    void
+    test_long_scope_names()
+    {
+        // 15 characters is the longest name stored inline; longer names are stored on the heap
+        for ( ::std::string const name : { "abcdefghijklmno", "abcdefghijklmnop", "an_interface_name_that_is_long" } )
+        {
+            auto const text( "fe80::f1:1612:447b:70c5%" + name );
+            IPv6Address const address( text );
+            assert_equals( static_cast< ::std::string >( address ), text );
+            assert_equals( ::strcmp( static_cast< char const * >( address ), text.c_str() ), 0, "C strings differ." );
+            assert_equals( address.scope_name().value_or( "" ), name );
+            assert_equals( address.without_scope_id(), "fe80::f1:1612:447b:70c5" );
+
+            auto const parsed( IPv6Address::parse( text ) );
+            assert_that( parsed.error == ParseError::None );
+            assert_equals( static_cast< ::std::string >( *parsed.address ), text );
+            assert_equals( parsed.address->scope_name().value_or( "" ), name );
+
+            IPv6Address copy( address );
+            assert_equals( static_cast< ::std::string >( copy ), text );
+            assert_that( copy == address );
+            copy = IPv6Address( "fe80::1%en0" );
+            assert_equals( static_cast< ::std::string >( copy ), "fe80::1%en0" );
+            copy = address;
+            assert_equals( static_cast< ::std::string >( copy ), text );
+            IPv6Address const moved( ::std::move( copy ) );
+            assert_equals( static_cast< ::std::string >( moved ), text );
+
+            in6_addr data{};
+            ::inet_pton( AF_INET6, "fe80::f1:1612:447b:70c5", &data );
+            IPv6Address const fromData( &data, name );
+            assert_equals( static_cast< ::std::string >( fromData ), text );
+        }
+    }
+
     void
     test_in_addr_round_trip_unscoped()
     {
@@ -225,6 +272,57 @@ public:
         }
     }
 
+    void
+    test_value_semantics_without_allocating()
+    {
+        in6_addr data {};
+        inet_pton( AF_INET6, "2001:471:c2bd:bb61:6d7b:48a5:6304:31e5", &data );
+        IPv6Address::Bytes const bytes{ 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0x1f, 0x12, 0x16, 0x7b, 0x44, 0xc5, 0x70 };
+        IPv6Address const scoped( "fe80::f1:1612:447b:70c5%117" );
+
+        auto const before( Tests::allocation_count() );
+        IPv6Address const address( &data );
+        IPv6Address copy( address );
+        IPv6Address moved( ::std::move( copy ) );
+        copy = IPv6Address( bytes );
+        moved = copy;
+        IPv6Address const scopedCopy( scoped );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Constructing, copying, and moving addresses should not allocate." );
+        assert_equals( static_cast< ::std::string >( address ), "2001:471:c2bd:bb61:6d7b:48a5:6304:31e5" );
+        assert_equals( static_cast< ::std::string >( moved ), "fe80::1f:1216:7b44:c570" );
+        assert_equals( moved, copy );
+        assert_equals( static_cast< ::std::string >( scopedCopy ), "fe80::f1:1612:447b:70c5%117" );
+        assert_equals( scopedCopy.without_scope_id(), "fe80::f1:1612:447b:70c5" );
+    }
+
+    void
+    test_concurrent_formatting()
+    {
+        in6_addr data {};
+        inet_pton( AF_INET6, "fe80::f1:1612:447b:70c5", &data );
+        IPv6Address const address( &data, 117 );
+
+        ::std::vector< char const * > results( 8, nullptr );
+        ::std::vector< ::std::thread > threads;
+        for ( size_t i{ 0 }; i < results.size(); ++i )
+        {
+            threads.emplace_back( [ &address, &results, i ] { results[ i ] = static_cast< char const * >( address ); } );
+        }
+        for ( auto & thread : threads )
+        {
+            thread.join();
+        }
+
+        for ( auto const result : results )
+        {
+            assert_equals( ::std::string( result ), "fe80::f1:1612:447b:70c5%117", "Every thread should see the fully formatted string." );
+        }
+        assert_equals( address.without_scope_id(), "fe80::f1:1612:447b:70c5" );
+        assert_equals( static_cast< ::std::string >( IPv6Address( address ) ), "fe80::f1:1612:447b:70c5%117" );
+    }
+
     void
     test_normalize()
     {
@@ -903,6 +1001,38 @@ public:
             "2003::1 should not be 6to4." );
     }
 
+    void
+    test_other_reserved_addresses()
+    {
+        static ::std::vector< ::std::string > const reserved {
+            "64:ff9b::", "64:ff9b::192.0.2.33",
+            "64:ff9b:1::", "64:ff9b:1:ffff:ffff:ffff:ffff:ffff",
+            "100::", "100::ffff:ffff:ffff:ffff",
+            "2001::", "2001:0:ffff:ffff:ffff:ffff:ffff:ffff",
+            "2001:20::", "2001:2f:ffff:ffff:ffff:ffff:ffff:ffff",
+            "2001:db8::", "2001:db8:ffff:ffff:ffff:ffff:ffff:ffff",
+        };
+        for ( auto const & test : reserved )
+        {
+            IPv6Address const address( test );
+            assert_that( address.is_reserved(), test + " should be reserved." );
+            assert_that( !address.is_private(), test + " should not be private" );
+            assert_that( !address.is_multicast(), test + " should not be multicast." );
+            assert_that( !address.is_unspecified(), test + " should not be unspecified." );
+            assert_that( !address.is_loopback(), test + " should not be the loopback." );
+            assert_that( !address.is_link_local(), test + " should not be link-local." );
+            assert_that( !address.is_6to4(), test + " should not be 6to4." );
+        }
+
+        static ::std::vector< ::std::string > const unreserved {
+            "64:ff9b:100::", "64:ff9b:2::", "100:0:0:1::", "2001:1::", "2001:30::", "2001:db9::", "2600::1",
+        };
+        for ( auto const & test : unreserved )
+        {
+            assert_not_that( IPv6Address( test ).is_reserved(), test + " should not be reserved." );
+        }
+    }
+
     void
     test_construct_malformed()
     {
@@ -914,6 +1044,146 @@ public:
         assert_throws( IPv6Address( "ffff::1::2" ), InvalidIPAddress );
     }
 
+    void
+    test_parse()
+    {
+        static_cast< void >( IPv6Address::parse( "fe80::1%1" ) );
+
+        auto const before( Tests::allocation_count() );
+        auto const parsed( IPv6Address::parse( "2001:db8::8a2e:370:7334" ) );
+        auto const scoped( IPv6Address::parse( "fe80::f1:1612:447b:70c5%117" ) );
+        auto const named( IPv6Address::try_parse( "fe80::1%no-such-if" ) );
+        auto const emptyScope( IPv6Address::parse( "fe80::1%" ) );
+        auto const empty( IPv6Address::parse( "" ) );
+        auto const malformed( IPv6Address::parse( "ffff::1::2" ) );
+        auto const tooLong( IPv6Address::parse(
+            "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" ) );
+        auto const zeroScope( IPv6Address::parse( "fe80::1%0" ) );
+        auto const hugeScope( IPv6Address::parse( "fe80::1%4294967296" ) );
+        auto const missing( IPv6Address::try_parse( "fe80::1g" ) );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Parsing should not allocate, whether or not it succeeds." );
+        assert_that( static_cast< bool >( parsed ) );
+        assert_equals( static_cast< ::std::string >( *parsed.address ), "2001:db8::8a2e:370:7334" );
+        assert_that( scoped.error == ParseError::None );
+        assert_equals( scoped.address->scope_id().value_or( 0 ), 117u );
+        assert_equals( static_cast< ::std::string >( *scoped.address ), "fe80::f1:1612:447b:70c5%117" );
+        assert_that( named.has_value() );
+        assert_equals( named->scope_name().value_or( "" ), "no-such-if" );
+        assert_that( emptyScope.error == ParseError::None );
+        assert_not_that( emptyScope.address->has_scope_id() );
+        assert_that( empty.error == ParseError::Empty );
+        assert_that( malformed.error == ParseError::Malformed );
+        assert_that( tooLong.error == ParseError::TooLong );
+        assert_that( zeroScope.error == ParseError::InvalidScope );
+        assert_that( hugeScope.error == ParseError::InvalidScope );
+        assert_not_that( missing.has_value() );
+
+        assert_throws( IPv6Address( "fe80::1%0" ), InvalidIPAddress );
+        assert_throws( IPv6Address( "fe80::1%4294967296" ), InvalidIPAddress );
+    }
+
+    static
+    in6_addr
+    random_address(
+        ::std::mt19937 & random )
+    {
+        in6_addr data{};
+        for ( size_t j = 0; j < 8; ++j )
+        {
+            // runs of zero groups and groups with leading zeros are what formatting has to get right, so favor them
+            auto const value( random() );
+            auto const word( static_cast< ::std::uint16_t >(
+                value % 2 == 0 ? 0 : value >> ( 4 * ( value % 4 ) + 16 ) ) );
+            data.s6_addr[ j * 2 ] = static_cast< ::std::uint8_t >( word >> 8 );
+            data.s6_addr[ j * 2 + 1 ] = static_cast< ::std::uint8_t >( word );
+        }
+        switch ( random() % 8 )
+        {
+            case 0:
+                // IPv4-mapped
+                ::std::memset( data.s6_addr, 0, 10 );
+                data.s6_addr[ 10 ] = data.s6_addr[ 11 ] = 0xff;
+                break;
+            case 1:
+                // IPv4-compatible
+                ::std::memset( data.s6_addr, 0, 12 );
+                break;
+            default:
+                break;
+        }
+        return data;
+    }
+
+    void
+    test_format_matches_inet_ntop()
+    {
+        ::std::mt19937 random( 6 );
+        for ( size_t i = 0; i < 20000; ++i )
+        {
+            auto const data( random_address( random ) );
+            char expected[ INET6_ADDRSTRLEN ];
+            assert_that( inet_ntop( AF_INET6, &data, expected, sizeof( expected ) ) != nullptr );
+            assert_equals( static_cast< ::std::string >( IPv6Address( &data ) ), ::std::string( expected ) );
+
+#ifdef ODDSOURCE_HAS_SSSE3
+            // formatting takes only one of the two hex paths, so compare them directly
+            if ( detail::hasSsse3() )
+            {
+                ::std::uint8_t bytes[ 16 ];
+                ::std::memcpy( bytes, &data, sizeof( bytes ) );
+                char scalar[ 32 ], simd[ 32 ];
+                detail::hexDigits( bytes, scalar );
+                detail::hexDigitsSsse3( bytes, simd );
+                assert_equals( ::std::string( scalar, 32 ), ::std::string( simd, 32 ) );
+            }
+#endif /* ODDSOURCE_HAS_SSSE3 */
+        }
+    }
+
+    void
+    test_parse_matches_inet_pton()
+    {
+        static constexpr char const MUTATIONS[]{ "0123456789abcdefABCDEFg:." };
+        ::std::mt19937 random( 6 );
+        for ( size_t i = 0; i < 20000; ++i )
+        {
+            auto const data( random_address( random ) );
+            char text[ INET6_ADDRSTRLEN ];
+            assert_that( inet_ntop( AF_INET6, &data, text, sizeof( text ) ) != nullptr );
+            ::std::string repr( text );
+            for ( auto mutations( random() % 3 ); mutations > 0; --mutations )
+            {
+                auto const position( random() % ( repr.length() + 1 ) );
+                auto const mutation( MUTATIONS[ random() % ( sizeof( MUTATIONS ) - 1 ) ] );
+                switch ( random() % 3 )
+                {
+                    case 0:
+                        repr.insert( position, 1, mutation );
+                        break;
+                    case 1:
+                        if ( position < repr.length() ) repr[ position ] = mutation;
+                        break;
+                    default:
+                        if ( position < repr.length() ) repr.erase( position, 1 );
+                        break;
+                }
+            }
+
+            in6_addr expected{};
+            bool const valid( inet_pton( AF_INET6, repr.c_str(), &expected ) == 1 );
+            auto const parsed( IPv6Address::try_parse( repr ) );
+            assert_equals( parsed.has_value(), valid, "Parsing '" + repr + "' should agree with inet_pton." );
+            if ( parsed )
+            {
+                assert_that(
+                    ::std::memcmp( static_cast< in6_addr const * >( *parsed ), &expected, sizeof( expected ) ) == 0,
+                    "Parsing '" + repr + "' should produce the same address as inet_pton." );
+            }
+        }
+    }
+
 #ifdef ODDSOURCE_INCLUDE_BOOST
     void
     test_boost_address_conversion()
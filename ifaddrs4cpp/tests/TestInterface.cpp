@@ -30,6 +30,7 @@ namespace OddSource::Interfaces
             add_test( test_mac_address );
             add_test( test_ipv4_addresses );
             add_test( test_ipv6_addresses );
+            add_test( test_name_views );
         }
 
         void
@@ -217,6 +218,39 @@ namespace OddSource::Interfaces
                 InterfaceIPAddress( IPv6Address( "fe80::f1:1612:447b:70c5%en0" ), 0, 64 ) );
         }
 
+        void
+        test_name_views()
+        {
+            Interface const posix( 2, "eth0", "eth0", "eth0", 0 );
+            assert_equals( posix.name_view(), "eth0" );
+            assert_equals( posix.friendly_name_view(), "eth0" );
+            assert_equals( posix.description_view(), "eth0" );
+            assert_equals( posix._names.size(), 4u );
+            assert_that( posix.name_view().data() == posix.description_view().data() );
+
+            Interface const windows(
+                12,
+                "{c9cc6972-a12b-43d6-9f99-fd7ea946ba5a}",
+                "Ethernet 1",
+                "Ethernet 1",
+                0 );
+            assert_equals( windows.name_view(), "{c9cc6972-a12b-43d6-9f99-fd7ea946ba5a}" );
+            assert_equals( windows.friendly_name_view(), "Ethernet 1" );
+            assert_equals( windows.description_view(), "Ethernet 1" );
+            assert_equals( windows._names.size(), 48u );
+
+            Interface const different( 3, "a", "b", "c", 0 );
+            assert_equals( different.name_view(), "a" );
+            assert_equals( different.friendly_name_view(), "b" );
+            assert_equals( different.description_view(), "c" );
+
+            Interface copy( windows );
+            Interface const moved( ::std::move( copy ) );
+            assert_equals( moved.name_view(), windows.name_view() );
+            assert_equals( moved.friendly_name_view(), "Ethernet 1" );
+            assert_equals( moved.description(), "Ethernet 1" );
+        }
+
         [[maybe_unused]]
         static
         std::unique_ptr< Test >
@@ -15,8 +15,12 @@
  */
 
 #include <oddsource/network/interfaces/Interfaces.hpp>
+#include <oddsource/network/interfaces/detail/netlink.hpp>
 #include "main.h"
 
+#include <set>
+#include <thread>
+
 using namespace OddSource::Interfaces;
 
 class TestInterfaceBrowser : public Tests::Test
@@ -28,6 +32,16 @@ public:
         add_test( test_get_by_name );
         add_test( test_get_by_index );
         add_test( test_get_interfaces );
+        add_test( test_backends );
+        add_test( test_netlink_matches_portable );
+        add_test( test_options_address_families );
+        add_test( test_options_skip_details );
+        add_test( test_options_up_only );
+        add_test( test_options_name_and_index );
+        add_test( test_lookup );
+        add_test( test_refresh_unchanged );
+        add_test( test_refresh_changed );
+        add_test( test_shared );
     }
 
     void
@@ -196,6 +210,321 @@ public:
         assert_that( nonLoopbackFound, "At least one non-loopback interface should have been found." );
     }
 
+    void
+    test_backends()
+    {
+        InterfaceBrowser const portable( EnumerationBackend::Portable );
+        assert_that( portable.backend() == EnumerationBackend::Portable );
+        assert_not_that( portable.get_interfaces().empty() );
+
+#ifdef ODDSOURCE_IS_LINUX
+        assert_that( this->_browser.backend() == EnumerationBackend::Netlink );
+
+        InterfaceBrowser const netlink( EnumerationBackend::Netlink );
+        assert_that( netlink.backend() == EnumerationBackend::Netlink );
+        assert_not_that( netlink.get_interfaces().empty() );
+#else /* ODDSOURCE_IS_LINUX */
+        assert_that( this->_browser.backend() == EnumerationBackend::Portable );
+        assert_throws( InterfaceBrowser( EnumerationBackend::Netlink ), InterfaceBrowserSystemError );
+#endif /* !ODDSOURCE_IS_LINUX */
+    }
+
+    void
+    test_netlink_matches_portable()
+    {
+#ifdef ODDSOURCE_IS_LINUX
+        InterfaceBrowser const portable( EnumerationBackend::Portable );
+        InterfaceBrowser const netlink( EnumerationBackend::Netlink );
+
+        assert_equals( netlink.get_interfaces().size(), portable.get_interfaces().size() );
+        for ( auto const & pExpected : portable.get_interfaces() )
+        {
+            auto const pActual( netlink.get_interface( pExpected->index() ) );
+            assert_not_equals( pActual, nullptr, "Netlink missing interface " + pExpected->name() );
+            if ( !pActual )
+            {
+                continue;
+            }
+
+            assert_equals( pActual->name(), pExpected->name() );
+            assert_equals( pActual->flags(), pExpected->flags() );
+            assert_equals( pActual->mtu().value_or( 0 ), pExpected->mtu().value_or( 0 ) );
+            assert_equals( pActual->has_mac_address(), pExpected->has_mac_address() );
+            if ( pExpected->has_mac_address() && pActual->has_mac_address() )
+            {
+                assert_equals( *pActual->mac_address(), *pExpected->mac_address() );
+            }
+            assert_equals( addresses( pActual->ipv4_addresses() ), addresses( pExpected->ipv4_addresses() ) );
+            assert_equals( addresses( pActual->ipv6_addresses() ), addresses( pExpected->ipv6_addresses() ) );
+        }
+#endif /* ODDSOURCE_IS_LINUX */
+    }
+
+    void
+    test_options_address_families()
+    {
+        for ( auto const backend : backends() )
+        {
+            EnumerationOptions options;
+            options.backend = backend;
+
+            options.address_families = AddressFamilies::IPv4;
+            InterfaceBrowser const ipv4( options );
+            assert_equals( ipv4.get_interfaces().size(), this->_browser.get_interfaces().size() );
+            size_t ipv4Count{ 0 };
+            for ( auto const & pInterface : ipv4.get_interfaces() )
+            {
+                ipv4Count += pInterface->ipv4_addresses().size();
+                assert_that( pInterface->ipv6_addresses().empty() );
+            }
+            assert_that( ipv4Count > 0 );
+
+            options.address_families = AddressFamilies::IPv6;
+            InterfaceBrowser const ipv6( options );
+            for ( auto const & pInterface : ipv6.get_interfaces() )
+            {
+                assert_that( pInterface->ipv4_addresses().empty() );
+            }
+
+            options.address_families = AddressFamilies::None;
+            InterfaceBrowser const none( options );
+            assert_equals( none.get_interfaces().size(), this->_browser.get_interfaces().size() );
+            for ( auto const & pInterface : none.get_interfaces() )
+            {
+                assert_that( pInterface->ipv4_addresses().empty() );
+                assert_that( pInterface->ipv6_addresses().empty() );
+            }
+        }
+    }
+
+    void
+    test_options_skip_details()
+    {
+        for ( auto const backend : backends() )
+        {
+            EnumerationOptions options;
+            options.backend = backend;
+            options.skip_mac_address = true;
+            options.skip_mtu = true;
+            options.skip_address_flags = true;
+
+            InterfaceBrowser const browser( options );
+            assert_equals( browser.get_interfaces().size(), this->_browser.get_interfaces().size() );
+            for ( auto const & pInterface : browser.get_interfaces() )
+            {
+                assert_not_that( pInterface->has_mac_address() );
+                assert_not_that( pInterface->mtu().has_value() );
+                for ( auto const & address : pInterface->ipv6_addresses() )
+                {
+                    assert_equals( address.flags(), 0u );
+                }
+            }
+        }
+    }
+
+    void
+    test_options_up_only()
+    {
+        for ( auto const backend : backends() )
+        {
+            EnumerationOptions options;
+            options.backend = backend;
+            options.up_only = true;
+
+            InterfaceBrowser const browser( options );
+            assert_not_that( browser.get_interfaces().empty() );
+            for ( auto const & pInterface : browser.get_interfaces() )
+            {
+                assert_that( pInterface->is_up(), pInterface->name() + " should be up" );
+            }
+        }
+    }
+
+    void
+    test_options_name_and_index()
+    {
+        auto const & pExpected( this->_browser.get_interfaces().back() );
+        for ( auto const backend : backends() )
+        {
+            EnumerationOptions options;
+            options.backend = backend;
+
+            options.name = pExpected->name();
+            InterfaceBrowser const byName( options );
+            assert_equals( byName.get_interfaces().size(), 1u );
+            assert_equals( byName[ pExpected->name() ].index(), pExpected->index() );
+            assert_equals( byName[ pExpected->index() ].ipv4_addresses().size(), pExpected->ipv4_addresses().size() );
+            assert_equals( byName[ pExpected->index() ].ipv6_addresses().size(), pExpected->ipv6_addresses().size() );
+
+            options.name.reset();
+            options.index = pExpected->index();
+            InterfaceBrowser const byIndex( options );
+            assert_equals( byIndex.get_interfaces().size(), 1u );
+            assert_equals( byIndex[ pExpected->index() ].name(), pExpected->name() );
+            assert_equals( byIndex[ pExpected->index() ].ipv4_addresses().size(), pExpected->ipv4_addresses().size() );
+            assert_equals( byIndex[ pExpected->index() ].ipv6_addresses().size(), pExpected->ipv6_addresses().size() );
+
+            options.index = 4'294'967'294;
+            InterfaceBrowser const missingIndex( options );
+            assert_that( missingIndex.get_interfaces().empty() );
+            assert_that( missingIndex.getWarnings().empty() );
+
+            options.index.reset();
+            options.name = "fooBar42";
+            InterfaceBrowser const missingName( options );
+            assert_that( missingName.get_interfaces().empty() );
+            assert_that( missingName.getWarnings().empty() );
+        }
+    }
+
+    void
+    test_lookup()
+    {
+        for ( auto const backend : backends() )
+        {
+            EnumerationOptions options;
+            options.backend = backend;
+            for ( auto const & pExpected : this->_browser.get_interfaces() )
+            {
+                auto const pByName( InterfaceBrowser::lookup( pExpected->name(), options ) );
+                assert_not_equals( pByName, nullptr, "Lookup failed for " + pExpected->name() );
+                if ( pByName )
+                {
+                    assert_equals( pByName->index(), pExpected->index() );
+                    assert_equals( pByName->flags(), pExpected->flags() );
+                    assert_equals( pByName->ipv4_addresses().size(), pExpected->ipv4_addresses().size() );
+                    assert_equals( pByName->ipv6_addresses().size(), pExpected->ipv6_addresses().size() );
+                }
+
+                auto const pByIndex( InterfaceBrowser::lookup( pExpected->index(), options ) );
+                assert_not_equals( pByIndex, nullptr, "Lookup failed for " + ::std::to_string( pExpected->index() ) );
+                if ( pByIndex )
+                {
+                    assert_equals( pByIndex->name(), pExpected->name() );
+                    assert_equals( pByIndex->ipv4_addresses().size(), pExpected->ipv4_addresses().size() );
+                    assert_equals( pByIndex->ipv6_addresses().size(), pExpected->ipv6_addresses().size() );
+                }
+            }
+
+            // the options' own filters must not leak into a lookup
+            options.name = "fooBar42";
+            options.index = 4'294'967'294;
+            auto const & pFirst( this->_browser.get_interfaces().front() );
+            assert_not_equals( InterfaceBrowser::lookup( pFirst->name(), options ), nullptr );
+            assert_not_equals( InterfaceBrowser::lookup( pFirst->index(), options ), nullptr );
+
+            assert_equals( InterfaceBrowser::lookup( "fooBar42", options ), nullptr );
+            assert_equals( InterfaceBrowser::lookup( 4'294'967'294, options ), nullptr );
+            assert_equals( InterfaceBrowser::lookup( 0, options ), nullptr );
+        }
+    }
+
+    void
+    test_refresh_unchanged()
+    {
+        for ( auto const backend : backends() )
+        {
+            InterfaceBrowser browser( backend );
+            ::std::vector< Interface const * > before;
+            for ( auto const & pInterface : browser.get_interfaces() )
+            {
+                before.push_back( pInterface.get() );
+            }
+
+            auto const changes( browser.refresh() );
+            assert_equals( changes.size(), 0u );
+            assert_that( browser.backend() == backend );
+
+            ::std::vector< Interface const * > after;
+            for ( auto const & pInterface : browser.get_interfaces() )
+            {
+                after.push_back( pInterface.get() );
+                assert_equals( browser.get_interface( pInterface->index() ), pInterface );
+                assert_equals( browser.get_interface( pInterface->name() ), pInterface );
+            }
+            assert_that( before == after, "Unchanged interfaces should keep the same objects." );
+        }
+    }
+
+    void
+    test_refresh_changed()
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        EnumerationOptions options;
+        options.name = "lo";
+        InterfaceBrowser browser( options );
+        if ( browser.get_interfaces().empty() )
+        {
+            ::std::cout << "No loopback interface named lo; skipping." << ::std::endl;
+            return;
+        }
+        auto const pBefore( browser.get_interfaces().front() );
+
+        if ( !changeLoopbackAddress( RTM_NEWADDR, pBefore->index() ) )
+        {
+            ::std::cout << "Not permitted to add addresses; skipping." << ::std::endl;
+            return;
+        }
+        auto const added( browser.refresh() );
+        changeLoopbackAddress( RTM_DELADDR, pBefore->index() );
+        auto const removed( browser.refresh() );
+
+        assert_equals( added.size(), 1u );
+        if ( added.size() == 1 )
+        {
+            assert_that( added[ 0 ].type == InterfaceEventType::AddressAdded );
+            assert_equals( added[ 0 ].index, pBefore->index() );
+            assert_equals( added[ 0 ].name, "lo" );
+            assert_that( added[ 0 ].ipv4_address.has_value() );
+            if ( added[ 0 ].ipv4_address )
+            {
+                assert_equals( ::std::string( added[ 0 ].ipv4_address->address() ), "127.0.0.78" );
+            }
+        }
+
+        assert_equals( removed.size(), 1u );
+        if ( removed.size() == 1 )
+        {
+            assert_that( removed[ 0 ].type == InterfaceEventType::AddressRemoved );
+            assert_that( removed[ 0 ].ipv4_address.has_value() );
+        }
+
+        // the loopback interface changed twice, so it is a new object with the original addresses
+        auto const pAfter( browser.get_interfaces().front() );
+        assert_not_equals( pAfter, pBefore );
+        assert_that( pAfter->ipv4_addresses() == pBefore->ipv4_addresses() );
+#endif /* ODDSOURCE_HAS_NETLINK */
+    }
+
+    void
+    test_shared()
+    {
+        using namespace ::std::chrono_literals;
+
+        // concurrent callers all get the one enumeration in flight (or its cached result)
+        auto const pFresh( InterfaceBrowser::shared( 0ms ) );
+        ::std::vector< ::std::shared_ptr< InterfaceBrowser const > > results( 16 );
+        ::std::vector< ::std::thread > threads;
+        for ( auto & result : results )
+        {
+            threads.emplace_back( [ &result ] { result = InterfaceBrowser::shared( 1h ); } );
+        }
+        for ( auto & thread : threads )
+        {
+            thread.join();
+        }
+        for ( auto const & result : results )
+        {
+            assert_equals( result, pFresh );
+        }
+        assert_equals( InterfaceBrowser::shared( 1h ), pFresh );
+
+        // an expired snapshot is replaced, sharing the interfaces that did not change
+        auto const pNext( InterfaceBrowser::shared( 0ms ) );
+        assert_not_equals( pNext, pFresh );
+        assert_that( pNext->get_interfaces() == pFresh->get_interfaces() );
+    }
+
     [[maybe_unused]]
     static
     std::unique_ptr< Test >
@@ -205,6 +534,75 @@ public:
     }
 
 private:
+#ifdef ODDSOURCE_HAS_NETLINK
+    /**
+     * Adds or removes 127.0.0.78/8 on the loopback interface, returning false if not permitted.
+     */
+    static
+    bool
+    changeLoopbackAddress(
+        ::std::uint16_t const type,
+        ::std::uint32_t const index )
+    {
+        ifaddrmsg header {};
+        header.ifa_family = AF_INET;
+        header.ifa_prefixlen = 8;
+        header.ifa_scope = RT_SCOPE_HOST; // the kernel rejects loopback addresses with any other scope
+        header.ifa_index = index;
+        ::std::uint16_t const flags( type == RTM_NEWADDR ? NLM_F_CREATE | NLM_F_EXCL | NLM_F_ACK : NLM_F_ACK );
+        detail::NetlinkRequest< ifaddrmsg > request( type, flags, header );
+        ::std::uint8_t const address[ 4 ] { 127, 0, 0, 78 };
+        request.addAttribute( IFA_LOCAL, address, sizeof( address ) );
+        request.addAttribute( IFA_ADDRESS, address, sizeof( address ) );
+
+        try
+        {
+            detail::NetlinkSocket socket;
+            socket.get( request, []( nlmsghdr const & ) {} );
+            return true;
+        }
+        catch ( InterfaceBrowserSystemError const & e )
+        {
+            ::std::cout << e.what() << ::std::endl;
+            return false;
+        }
+    }
+#endif /* ODDSOURCE_HAS_NETLINK */
+
+    static
+    ::std::vector< EnumerationBackend >
+    backends()
+    {
+#ifdef ODDSOURCE_IS_LINUX
+        return { EnumerationBackend::Portable, EnumerationBackend::Netlink };
+#else /* ODDSOURCE_IS_LINUX */
+        return { EnumerationBackend::Portable };
+#endif /* !ODDSOURCE_IS_LINUX */
+    }
+
+    template< class IPAddressT >
+    static
+    ::std::string
+    addresses(
+        ::std::vector< InterfaceIPAddress< IPAddressT > > const & list )
+    {
+        // address flags are excluded because getifaddrs cannot report them on Linux
+        ::std::set< ::std::string > sorted;
+        for ( auto const & address : list )
+        {
+            sorted.insert(
+                ::std::string( address.address() ) + "/" +
+                ::std::to_string( address.prefix_length().value_or( 0 ) ) );
+        }
+
+        ::std::string joined;
+        for ( auto const & address : sorted )
+        {
+            joined += address + " ";
+        }
+        return joined;
+    }
+
     InterfaceBrowser _browser;
 };
 
@@ -0,0 +1,322 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <oddsource/network/interfaces/InterfaceAsio.hpp>
+#include <oddsource/network/interfaces/Interfaces.hpp>
+#include <oddsource/network/interfaces/detail/netlink.hpp>
+#include "main.h"
+
+#ifdef ODDSOURCE_HAS_NETLINK
+#include <poll.h>
+#endif /* ODDSOURCE_HAS_NETLINK */
+
+#ifdef ODDSOURCE_INCLUDE_BOOST
+#include ODDSOURCE_BOOST_HEADER(asio/io_context.hpp)
+#endif /* ODDSOURCE_INCLUDE_BOOST */
+
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace OddSource::Interfaces;
+
+class TestInterfaceEnumeration : public Tests::Test
+{
+public:
+    TestInterfaceEnumeration()
+    {
+        add_test( test_matches_browser );
+        add_test( test_options_name_and_index );
+        add_test( test_result_before_done );
+        add_test( test_async_enumerate );
+        add_test( test_async_wait_change );
+    }
+
+    void
+    test_matches_browser()
+    {
+        for ( auto const backend : backends() )
+        {
+            EnumerationOptions options;
+            options.backend = backend;
+            InterfaceEnumeration enumeration( options );
+            auto const pActual( drive( enumeration ) );
+            InterfaceBrowser const expected( options );
+
+            assert_not_equals( pActual, nullptr );
+            assert_that( pActual->backend() == expected.backend() );
+            assert_equals( pActual->get_interfaces().size(), expected.get_interfaces().size() );
+            for ( auto const & pExpected : expected.get_interfaces() )
+            {
+                auto const pInterface( pActual->get_interface( pExpected->index() ) );
+                assert_not_equals( pInterface, nullptr, "Missing interface " + pExpected->name() );
+                if ( !pInterface )
+                {
+                    continue;
+                }
+
+                assert_equals( pInterface->name(), pExpected->name() );
+                assert_equals( pInterface->flags(), pExpected->flags() );
+                assert_equals( pInterface->mtu().value_or( 0 ), pExpected->mtu().value_or( 0 ) );
+                assert_equals( pInterface->has_mac_address(), pExpected->has_mac_address() );
+                assert_equals( addresses( pInterface->ipv4_addresses() ), addresses( pExpected->ipv4_addresses() ) );
+                assert_equals( addresses( pInterface->ipv6_addresses() ), addresses( pExpected->ipv6_addresses() ) );
+            }
+            assert_that( enumeration.native_handle() == -1 );
+        }
+    }
+
+    void
+    test_options_name_and_index()
+    {
+        InterfaceBrowser const browser;
+        auto const & pExpected( browser.get_interfaces().back() );
+        for ( auto const backend : backends() )
+        {
+            EnumerationOptions options;
+            options.backend = backend;
+
+            options.name = pExpected->name();
+            InterfaceEnumeration byName( options );
+            auto const pByName( drive( byName ) );
+            assert_equals( pByName->get_interfaces().size(), 1u );
+            assert_equals( ( *pByName )[ pExpected->name() ].index(), pExpected->index() );
+            assert_equals(
+                ( *pByName )[ pExpected->index() ].ipv4_addresses().size(),
+                pExpected->ipv4_addresses().size() );
+
+            options.name.reset();
+            options.index = pExpected->index();
+            InterfaceEnumeration byIndex( options );
+            auto const pByIndex( drive( byIndex ) );
+            assert_equals( pByIndex->get_interfaces().size(), 1u );
+            assert_equals( ( *pByIndex )[ pExpected->index() ].name(), pExpected->name() );
+
+            options.index.reset();
+            options.name = "fooBar42";
+            InterfaceEnumeration missingName( options );
+            auto const pMissingName( drive( missingName ) );
+            assert_that( pMissingName->get_interfaces().empty() );
+            assert_that( pMissingName->getWarnings().empty() );
+        }
+    }
+
+    void
+    test_result_before_done()
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        EnumerationOptions options;
+        options.backend = EnumerationBackend::Netlink;
+        InterfaceEnumeration enumeration( options );
+        assert_not_that( enumeration.done() );
+        assert_that( enumeration.native_handle() >= 0 );
+        assert_throws( static_cast< void >( enumeration.result() ), ::std::logic_error );
+        assert_not_equals( drive( enumeration ), nullptr );
+#else /* ODDSOURCE_HAS_NETLINK */
+        InterfaceEnumeration enumeration;
+        assert_that( enumeration.done() );
+        assert_equals( enumeration.native_handle(), -1 );
+        assert_not_equals( enumeration.result(), nullptr );
+#endif /* !ODDSOURCE_HAS_NETLINK */
+    }
+
+    void
+    test_async_enumerate()
+    {
+#if defined( ODDSOURCE_INCLUDE_BOOST ) && defined( BOOST_ASIO_HAS_POSIX_STREAM_DESCRIPTOR )
+        for ( auto const backend : backends() )
+        {
+            EnumerationOptions options;
+            options.backend = backend;
+            ODDSOURCE_BOOST_NAMESPACE_ROOT::asio::io_context context;
+            ::std::shared_ptr< InterfaceBrowser const > pBrowser;
+            bool completed{ false };
+            async_enumerate(
+                context.get_executor(),
+                options,
+                [ & ]( ::std::exception_ptr error, ::std::shared_ptr< InterfaceBrowser const > result )
+                {
+                    completed = true;
+                    assert_that( error == nullptr );
+                    pBrowser = ::std::move( result );
+                } );
+            assert_not_that( completed );
+            context.run();
+
+            assert_that( completed );
+            assert_not_equals( pBrowser, nullptr );
+            if ( pBrowser )
+            {
+                assert_equals( pBrowser->get_interfaces().size(), InterfaceBrowser( options ).get_interfaces().size() );
+            }
+        }
+#endif /* ODDSOURCE_INCLUDE_BOOST && BOOST_ASIO_HAS_POSIX_STREAM_DESCRIPTOR */
+    }
+
+    void
+    test_async_wait_change()
+    {
+#if defined( ODDSOURCE_INCLUDE_BOOST ) && defined( ODDSOURCE_HAS_NETLINK )
+        auto const pLoopback( InterfaceBrowser::lookup( "lo" ) );
+        if ( !pLoopback )
+        {
+            ::std::cout << "No loopback interface named lo; skipping." << ::std::endl;
+            return;
+        }
+
+        EnumerationOptions options;
+        options.address_families = AddressFamilies::IPv4;
+        options.name = "lo";
+        InterfaceMonitor monitor( options );
+
+        ODDSOURCE_BOOST_NAMESPACE_ROOT::asio::io_context context;
+        ::std::vector< InterfaceEvent > events;
+        bool completed{ false };
+        async_wait_change(
+            monitor,
+            context.get_executor(),
+            [ & ]( ::std::exception_ptr error, ::std::vector< InterfaceEvent > result )
+            {
+                completed = true;
+                assert_that( error == nullptr );
+                events = ::std::move( result );
+            } );
+
+        // nothing has changed, so the wait must still be pending
+        context.poll();
+        assert_not_that( completed );
+
+        if ( !changeAddress( RTM_NEWADDR, pLoopback->index() ) )
+        {
+            ::std::cout << "Not permitted to add addresses; skipping." << ::std::endl;
+            return;
+        }
+        changeAddress( RTM_DELADDR, pLoopback->index() );
+        context.run_for( ::std::chrono::seconds( 5 ) );
+
+        assert_that( completed );
+        assert_not_that( events.empty() );
+        if ( !events.empty() )
+        {
+            assert_that( events.front().type == InterfaceEventType::AddressAdded );
+            assert_equals( ::std::string( events.front().ipv4_address->address() ), "127.0.0.79" );
+        }
+#endif /* ODDSOURCE_INCLUDE_BOOST && ODDSOURCE_HAS_NETLINK */
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Test >
+    create()
+    {
+        return std::make_unique< TestInterfaceEnumeration >();
+    }
+
+private:
+    /**
+     * Waits for the enumeration to become readable until it is done, the way an event loop would.
+     */
+    static
+    ::std::shared_ptr< InterfaceBrowser const >
+    drive(
+        InterfaceEnumeration & enumeration )
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        while ( !enumeration.done() )
+        {
+            pollfd descriptor { enumeration.native_handle(), POLLIN, 0 };
+            ::poll( &descriptor, 1, 1000 );
+            enumeration.on_readable();
+        }
+#endif /* ODDSOURCE_HAS_NETLINK */
+        return enumeration.result();
+    }
+
+#ifdef ODDSOURCE_HAS_NETLINK
+    /**
+     * Adds or removes 127.0.0.79/8 on the loopback interface, returning false if not permitted.
+     */
+    static
+    bool
+    changeAddress(
+        ::std::uint16_t const type,
+        ::std::uint32_t const index )
+    {
+        ifaddrmsg header {};
+        header.ifa_family = AF_INET;
+        header.ifa_prefixlen = 8;
+        header.ifa_index = index;
+        header.ifa_scope = RT_SCOPE_HOST; // the kernel rejects loopback addresses with any other scope
+        ::std::uint16_t const flags( type == RTM_NEWADDR ? NLM_F_CREATE | NLM_F_EXCL | NLM_F_ACK : NLM_F_ACK );
+        detail::NetlinkRequest< ifaddrmsg > request( type, flags, header );
+        ::std::uint8_t const address[ 4 ] { 127, 0, 0, 79 };
+        request.addAttribute( IFA_LOCAL, address, sizeof( address ) );
+        request.addAttribute( IFA_ADDRESS, address, sizeof( address ) );
+
+        try
+        {
+            detail::NetlinkSocket socket;
+            socket.get( request, []( nlmsghdr const & ) {} );
+            return true;
+        }
+        catch ( InterfaceBrowserSystemError const & e )
+        {
+            ::std::cout << e.what() << ::std::endl;
+            return false;
+        }
+    }
+#endif /* ODDSOURCE_HAS_NETLINK */
+
+    static
+    ::std::vector< EnumerationBackend >
+    backends()
+    {
+#ifdef ODDSOURCE_IS_LINUX
+        return { EnumerationBackend::Automatic, EnumerationBackend::Portable, EnumerationBackend::Netlink };
+#else /* ODDSOURCE_IS_LINUX */
+        return { EnumerationBackend::Automatic, EnumerationBackend::Portable };
+#endif /* !ODDSOURCE_IS_LINUX */
+    }
+
+    template< class IPAddressT >
+    static
+    ::std::string
+    addresses(
+        ::std::vector< InterfaceIPAddress< IPAddressT > > const & list )
+    {
+        ::std::set< ::std::string > sorted;
+        for ( auto const & address : list )
+        {
+            sorted.insert(
+                ::std::string( address.address() ) + "/" +
+                ::std::to_string( address.prefix_length().value_or( 0 ) ) );
+        }
+
+        ::std::string joined;
+        for ( auto const & address : sorted )
+        {
+            joined += address + " ";
+        }
+        return joined;
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Tests::Test::Registrar< TestInterfaceEnumeration > registrar( "TestInterfaceEnumeration" );
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <oddsource/network/interfaces/Interfaces.hpp>
+#include <oddsource/network/interfaces/detail/netlink.hpp>
+#include "main.h"
+
+#include <vector>
+
+using namespace OddSource::Interfaces;
+
+class TestInterfaceMonitor : public Tests::Test
+{
+public:
+    TestInterfaceMonitor()
+    {
+        add_test( test_wait_without_changes );
+        add_test( test_address_events );
+    }
+
+    void
+    test_wait_without_changes()
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        InterfaceMonitor monitor;
+        assert_that( monitor.native_handle() >= 0 );
+
+        // drain anything that was already in flight, then nothing should be waiting
+        monitor.poll_events( []( InterfaceEvent && ) {} );
+        size_t const delivered( monitor.wait_for_events(
+            []( InterfaceEvent && ) {},
+            ::std::chrono::milliseconds( 0 ) ) );
+        assert_equals( delivered, 0u );
+        assert_that( monitor.getWarnings().empty() );
+#else /* ODDSOURCE_HAS_NETLINK */
+        assert_throws( InterfaceMonitor(), InterfaceBrowserSystemError );
+#endif /* !ODDSOURCE_HAS_NETLINK */
+    }
+
+    void
+    test_address_events()
+    {
+#ifdef ODDSOURCE_HAS_NETLINK
+        auto const pLoopback( InterfaceBrowser::lookup( "lo" ) );
+        if ( !pLoopback )
+        {
+            ::std::cout << "No loopback interface named lo; skipping." << ::std::endl;
+            return;
+        }
+
+        EnumerationOptions options;
+        options.address_families = AddressFamilies::IPv4;
+        options.name = "lo";
+        InterfaceMonitor monitor( options );
+
+        if ( !changeAddress( RTM_NEWADDR, pLoopback->index() ) )
+        {
+            ::std::cout << "Not permitted to add addresses; skipping." << ::std::endl;
+            return;
+        }
+        changeAddress( RTM_DELADDR, pLoopback->index() );
+
+        ::std::vector< InterfaceEvent > events;
+        for ( int attempt{ 0 }; attempt < 10 && events.size() < 2; ++attempt )
+        {
+            monitor.wait_for_events(
+                [ &events ]( InterfaceEvent && event )
+                {
+                    if ( event.ipv4_address && ::std::string( event.ipv4_address->address() ) == "127.0.0.77" )
+                    {
+                        events.push_back( ::std::move( event ) );
+                    }
+                },
+                ::std::chrono::milliseconds( 100 ) );
+        }
+
+        assert_equals( events.size(), 2u );
+        if ( events.size() == 2 )
+        {
+            assert_that( events[ 0 ].type == InterfaceEventType::AddressAdded );
+            assert_that( events[ 1 ].type == InterfaceEventType::AddressRemoved );
+            for ( auto const & event : events )
+            {
+                assert_equals( event.index, pLoopback->index() );
+                assert_equals( event.name, "lo" );
+                assert_equals( event.ipv4_address->prefix_length().value_or( 0 ), 8 );
+                assert_not_that( event.ipv6_address.has_value() );
+                assert_equals( event.link, nullptr );
+            }
+        }
+#endif /* ODDSOURCE_HAS_NETLINK */
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Test >
+    create()
+    {
+        return std::make_unique< TestInterfaceMonitor >();
+    }
+
+#ifdef ODDSOURCE_HAS_NETLINK
+private:
+    /**
+     * Adds or removes 127.0.0.77/8 on the loopback interface, returning false if not permitted.
+     */
+    static
+    bool
+    changeAddress(
+        ::std::uint16_t const type,
+        ::std::uint32_t const index )
+    {
+        ifaddrmsg header {};
+        header.ifa_family = AF_INET;
+        header.ifa_prefixlen = 8;
+        header.ifa_index = index;
+        header.ifa_scope = RT_SCOPE_HOST; // the kernel rejects loopback addresses with any other scope
+        ::std::uint16_t const flags( type == RTM_NEWADDR ? NLM_F_CREATE | NLM_F_EXCL | NLM_F_ACK : NLM_F_ACK );
+        detail::NetlinkRequest< ifaddrmsg > request( type, flags, header );
+        ::std::uint8_t const address[ 4 ] { 127, 0, 0, 77 };
+        request.addAttribute( IFA_LOCAL, address, sizeof( address ) );
+        request.addAttribute( IFA_ADDRESS, address, sizeof( address ) );
+
+        try
+        {
+            detail::NetlinkSocket socket;
+            socket.get( request, []( nlmsghdr const & ) {} );
+            return true;
+        }
+        catch ( InterfaceBrowserSystemError const & e )
+        {
+            ::std::cout << e.what() << ::std::endl;
+            return false;
+        }
+    }
+#endif /* ODDSOURCE_HAS_NETLINK */
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Tests::Test::Registrar< TestInterfaceMonitor > registrar( "TestInterfaceMonitor" );
+}
@@ -0,0 +1,441 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <oddsource/network/interfaces/InterfaceProvider.hpp>
+#include <oddsource/network/interfaces/Interfaces.hpp>
+#include "main.h"
+
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <memory>
+
+using namespace OddSource::Interfaces;
+
+class TestInterfaceProvider : public Tests::Test
+{
+public:
+    TestInterfaceProvider()
+    {
+        add_test( test_synthetic );
+        add_test( test_synthetic_options );
+        add_test( test_synthetic_refresh );
+        add_test( test_synthetic_enumeration );
+        add_test( test_custom_provider );
+        add_test( test_provider_backend_without_provider );
+        add_test( test_arena );
+        add_test( test_arena_refresh );
+        add_test( test_arena_bounded_across_refreshes );
+        add_test( test_name_views_without_allocating );
+        add_test( test_sparse_lookups );
+        add_test( test_visitors_and_ranges );
+    }
+
+    void
+    test_synthetic()
+    {
+        InterfaceBrowser const browser( options( 1000, 2, 3 ) );
+        assert_that( browser.backend() == EnumerationBackend::Provider );
+        assert_equals( browser.get_interfaces().size(), 1000u );
+        assert_that( browser.getWarnings().empty() );
+
+        auto const & first( browser[ 1 ] );
+        assert_equals( first.name(), "syn0" );
+        assert_equals( first.mtu().value_or( 0 ), 1500u );
+        assert_that( first.is_up() );
+        assert_equals( static_cast< ::std::string >( *first.mac_address() ), "02:00:00:00:00:00" );
+        assert_equals( first.ipv4_addresses().size(), 2u );
+        assert_equals( static_cast< ::std::string >( first.ipv4_addresses()[ 0 ] ), "10.0.0.1/8 broadcast 10.255.255.255" );
+        assert_equals( first.ipv6_addresses().size(), 3u );
+        assert_equals( ::std::string( first.ipv6_addresses()[ 0 ].address() ), "fd00::1" );
+
+        auto const & last( browser[ "syn999" ] );
+        assert_equals( last.index(), 1000u );
+        assert_equals( static_cast< ::std::string >( *last.mac_address() ), "02:00:00:00:03:e7" );
+        assert_equals( ::std::string( last.ipv4_addresses()[ 1 ].address() ), "10.0.7.208" );
+        assert_equals( ::std::string( last.ipv6_addresses()[ 2 ].address() ), "fd00:0:0:3e7::3" );
+    }
+
+    void
+    test_synthetic_options()
+    {
+        auto opts( options( 100, 1, 1 ) );
+        opts.address_families = AddressFamilies::IPv6;
+        opts.skip_mac_address = true;
+        opts.skip_mtu = true;
+        InterfaceBrowser const filtered( opts );
+        assert_equals( filtered.get_interfaces().size(), 100u );
+        assert_that( filtered[ 50 ].ipv4_addresses().empty() );
+        assert_equals( filtered[ 50 ].ipv6_addresses().size(), 1u );
+        assert_not_that( filtered[ 50 ].has_mac_address() );
+        assert_not_that( filtered[ 50 ].mtu().has_value() );
+
+        auto const pByName( InterfaceBrowser::lookup( "syn42", options( 100, 1, 1 ) ) );
+        assert_not_equals( pByName, nullptr );
+        assert_equals( pByName->index(), 43u );
+        assert_equals( pByName->ipv4_addresses().size(), 1u );
+
+        auto const pByIndex( InterfaceBrowser::lookup( 7, options( 100, 1, 1 ) ) );
+        assert_not_equals( pByIndex, nullptr );
+        assert_equals( pByIndex->name(), "syn6" );
+
+        assert_equals( InterfaceBrowser::lookup( "eth0", options( 100, 1, 1 ) ), nullptr );
+    }
+
+    void
+    test_synthetic_refresh()
+    {
+        InterfaceBrowser browser( options( 500, 1, 1 ) );
+        auto const pBefore( browser.get_interface( 250 ) );
+        auto const changes( browser.refresh() );
+        assert_that( changes.empty() );
+        assert_equals( browser.get_interface( 250 ), pBefore );
+    }
+
+    void
+    test_synthetic_enumeration()
+    {
+        InterfaceEnumeration enumeration( options( 10, 1, 0 ) );
+        assert_that( enumeration.done() );
+        assert_equals( enumeration.native_handle(), -1 );
+        assert_equals( enumeration.result()->get_interfaces().size(), 10u );
+        assert_that( enumeration.result()->backend() == EnumerationBackend::Provider );
+    }
+
+    void
+    test_custom_provider()
+    {
+        class Provider : public InterfaceProvider
+        {
+        public:
+            void
+            populate(
+                InterfaceCollector & collector ) const override
+            {
+                collector.add_warning( "partial" );
+                collector.add_interface( 3, "down0", 0 );
+                Interface * const pInterface( collector.add_interface( 4, "tun0", IFF_UP | IFF_POINTOPOINT, 1400 ) );
+                if ( pInterface != nullptr )
+                {
+                    collector.add_ipv6_address( *pInterface, InterfaceIPv6Address(
+                        IPv6Address( "fd00::1" ),
+                        IN6_IFF_TEMPORARY,
+                        64,
+                        PointToPoint,
+                        IPv6Address( "fd00::2" ) ) );
+                }
+            }
+        };
+
+        EnumerationOptions opts;
+        opts.provider = ::std::make_shared< Provider >();
+        InterfaceBrowser const all( opts );
+        assert_equals( all.get_interfaces().size(), 2u );
+        assert_equals( all.getWarnings().size(), 1u );
+        assert_that( all[ "tun0" ].ipv6_addresses()[ 0 ].is_flag_enabled( InterfaceIPAddressFlag::Temporary ) );
+
+        opts.up_only = true;
+        opts.skip_address_flags = true;
+        InterfaceBrowser const up( opts );
+        assert_equals( up.get_interfaces().size(), 1u );
+        auto const & address( up[ 4 ].ipv6_addresses()[ 0 ] );
+        assert_equals( address.flags(), 0u );
+        assert_equals( address.prefix_length().value_or( 0 ), 64 );
+        assert_equals( static_cast< ::std::string >( *address.point_to_point_destination() ), "fd00::2" );
+    }
+
+    void
+    test_provider_backend_without_provider()
+    {
+        EnumerationOptions opts;
+        opts.backend = EnumerationBackend::Provider;
+        assert_throws( InterfaceBrowser browser( opts ), InterfaceBrowserSystemError );
+    }
+
+    void
+    test_arena()
+    {
+        auto heapOptions( options( 1000, 2, 2 ) );
+        heapOptions.arena = false;
+        auto before( Tests::allocation_count() );
+        auto pHeap( ::std::make_shared< InterfaceBrowser const >( heapOptions ) );
+        auto const heapAllocations( Tests::allocation_count() - before );
+
+        before = Tests::allocation_count();
+        auto pArena( ::std::make_shared< InterfaceBrowser const >( options( 1000, 2, 2 ) ) );
+        auto const arenaAllocations( Tests::allocation_count() - before );
+
+        // each interface itself comes from the arena; its address lists are on the heap either way
+        assert_that(
+            arenaAllocations + 900 < heapAllocations,
+            "Expected about one fewer allocation per interface with the arena, but it made " +
+                ::std::to_string( arenaAllocations ) + " against " + ::std::to_string( heapAllocations ) + "." );
+
+        // interfaces outlive their browser, and copies of them are independent of the arena
+        auto const pInterface( pArena->get_interface( 500 ) );
+        pArena.reset();
+        Interface const copy( *pInterface );
+        assert_equals( pInterface->name(), "syn499" );
+        assert_equals( copy.name(), "syn499" );
+        assert_that( pInterface->ipv4_addresses() == pHeap->get_interface( 500 )->ipv4_addresses() );
+        assert_that( copy.ipv6_addresses() == pHeap->get_interface( 500 )->ipv6_addresses() );
+        assert_equals( ::std::string( copy.ipv6_addresses()[ 1 ].address() ), "fd00:0:0:1f3::2" );
+    }
+
+    void
+    test_arena_refresh()
+    {
+        class Provider : public InterfaceProvider
+        {
+        public:
+            void
+            populate(
+                InterfaceCollector & collector ) const override
+            {
+                auto const generation( this->_generation++ );
+                for ( ::std::uint32_t index{ 1 }; index <= 100; ++index )
+                {
+                    collector.add_interface(
+                        index, "if" + ::std::to_string( index ), IFF_UP, index == 7 ? 1500 + generation : 1500 );
+                }
+            }
+
+        private:
+            mutable ::std::atomic< ::std::uint32_t > _generation{ 0 };
+        };
+
+        EnumerationOptions opts;
+        opts.provider = ::std::make_shared< Provider >();
+        InterfaceBrowser browser( opts );
+        auto const pUnchanged( browser.get_interface( 8 ) );
+
+        auto const changes( browser.refresh() );
+        assert_equals( changes.size(), 1u );
+        assert_that( changes[ 0 ].type == InterfaceEventType::LinkChanged );
+        assert_equals( changes[ 0 ].link, browser.get_interface( 7 ) );
+        assert_equals( browser.get_interface( 7 )->mtu().value_or( 0 ), 1501u );
+        assert_equals( browser.get_interface( 8 ), pUnchanged );
+    }
+
+    void
+    test_arena_bounded_across_refreshes()
+    {
+        // half of the interfaces change on every refresh, and one more of the rest changes once and then stays,
+        // so that every snapshot has interfaces that are kept for the rest of the test
+        class Provider : public InterfaceProvider
+        {
+        public:
+            void
+            populate(
+                InterfaceCollector & collector ) const override
+            {
+                auto const generation( this->_generation++ );
+                for ( ::std::uint32_t index{ 1 }; index <= 1000; ++index )
+                {
+                    auto const mtu( index <= 500 ? 1500 + generation : ( index - 500 <= generation ? 9000 : 1500 ) );
+                    collector.add_interface( index, "if" + ::std::to_string( index ), IFF_UP, mtu );
+                }
+            }
+
+        private:
+            mutable ::std::atomic< ::std::uint32_t > _generation{ 0 };
+        };
+
+        EnumerationOptions opts;
+        opts.provider = ::std::make_shared< Provider >();
+        InterfaceBrowser browser( opts );
+        for ( size_t i{ 0 }; i < 10; ++i )
+        {
+            static_cast< void >( browser.refresh() );
+        }
+        auto const before( Tests::allocated_bytes() );
+        for ( size_t i{ 0 }; i < 100; ++i )
+        {
+            static_cast< void >( browser.refresh() );
+        }
+        auto const after( Tests::allocated_bytes() );
+
+        assert_equals( browser.get_interface( 600 )->mtu().value_or( 0 ), 9000u );
+        assert_that(
+            after < before + 64 * 1024,
+            "Expected refreshes to keep no more memory alive, but 100 of them kept " +
+                ::std::to_string( after - before ) + " more bytes." );
+    }
+
+    void
+    test_name_views_without_allocating()
+    {
+        InterfaceBrowser const browser( options( 1000, 1, 1 ) );
+
+        auto const before( Tests::allocation_count() );
+        ::std::size_t characters{ 0 };
+        ::std::size_t matches{ 0 };
+        for ( auto const & pInterface : browser.get_interfaces() )
+        {
+            characters += pInterface->name_view().size() + pInterface->description_view().size();
+            matches += pInterface->name_view().substr( 0, 3 ) == "syn";
+        }
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Walking the names of a snapshot should not allocate." );
+        assert_equals( matches, 1000u );
+        assert_equals( characters, 2u * ( 10 * 4 + 90 * 5 + 900 * 6 ) );
+    }
+
+    void
+    test_sparse_lookups()
+    {
+        class Provider : public InterfaceProvider
+        {
+        public:
+            void
+            populate(
+                InterfaceCollector & collector ) const override
+            {
+                collector.add_interface( 300, "vlan300", IFF_UP );
+                collector.add_interface( 1, "lo", IFF_UP | IFF_LOOPBACK );
+                collector.add_interface( 4000000000, "an-interface-with-a-name-too-long-to-store-inline", IFF_UP );
+                collector.add_interface( 70000, "veth70000", IFF_UP );
+                collector.add_interface( 2, "eth0", IFF_UP, 1500 );
+                collector.add_interface( 5, "eth0", IFF_UP, 9000 );
+                collector.add_interface( 2, "eth1", IFF_UP );
+            }
+        };
+
+        EnumerationOptions opts;
+        opts.provider = ::std::make_shared< Provider >();
+        InterfaceBrowser const browser( opts );
+
+        auto const before( Tests::allocation_count() );
+        auto const pLoopback( browser.get_interface( 1 ) );
+        auto const pVlan( browser.get_interface( 300 ) );
+        auto const pVeth( browser.get_interface( 70000 ) );
+        auto const pLong( browser.get_interface( 4000000000 ) );
+        auto const pMissingIndex( browser.get_interface( 3 ) );
+        auto const pMissingHighIndex( browser.get_interface( 4000000001 ) );
+        auto const pLongByName( browser.get_interface( "an-interface-with-a-name-too-long-to-store-inline" ) );
+        auto const pMissingName( browser.get_interface( "an-interface-with-a-name-too-long-to-store-inline!" ) );
+        auto const & ethernet( browser[ "eth0" ] );
+        auto const & second( browser[ 2 ] );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Lookups should not allocate." );
+        assert_equals( pLoopback->name(), "lo" );
+        assert_equals( pVlan->name(), "vlan300" );
+        assert_equals( pVeth->name(), "veth70000" );
+        assert_equals( pLong, pLongByName );
+        assert_equals( pLong->index(), 4000000000u );
+        assert_that( pMissingIndex == nullptr );
+        assert_that( pMissingHighIndex == nullptr );
+        assert_that( pMissingName == nullptr );
+
+        // the first interface enumerated wins a duplicated index or name
+        assert_equals( ethernet.index(), 2u );
+        assert_equals( second.name(), "eth0" );
+        assert_equals( browser[ "eth1" ].index(), 2u );
+        assert_equals( browser[ 5 ].mtu().value_or( 0 ), 9000u );
+        assert_throws( static_cast< void >( browser[ 6 ] ), ::std::out_of_range );
+        assert_throws( static_cast< void >( browser[ "eth2" ] ), ::std::out_of_range );
+    }
+
+    void
+    test_visitors_and_ranges()
+    {
+        InterfaceBrowser const browser( options( 100, 2, 3 ) );
+        ::std::function< bool( Interface const & ) > const countUp( []( Interface const & rInterface )
+        {
+            return rInterface.is_up();
+        } );
+
+        auto const before( Tests::allocation_count() );
+        ::std::uint32_t ranged{ 0 };
+        bool ordered{ true };
+        for ( Interface const & rInterface : browser )
+        {
+            ordered = ordered && rInterface.index() == ++ranged;
+        }
+        ::std::uint32_t visited{ 0 };
+        bool const visitedAll( browser.for_each_interface( [ &visited ]( Interface const & )
+        {
+            return ++visited < 1000;
+        } ) );
+        ::std::uint32_t stoppedAfter{ 0 };
+        bool const stopped( browser.for_each_interface( [ &stoppedAfter ]( Interface const & rInterface )
+        {
+            ++stoppedAfter;
+            return rInterface.index() < 10;
+        } ) );
+        ::std::size_t ipv4{ 0 };
+        bool const visitedIPv4( browser.for_each_ipv4_address(
+            [ &ipv4 ]( Interface const & rInterface, InterfaceIPv4Address const & address )
+            {
+                auto const & addresses( rInterface.ipv4_addresses() );
+                ipv4 += &address >= &addresses.front() && &address <= &addresses.back();
+                return true;
+            } ) );
+        ::std::size_t ipv6{ 0 };
+        bool const stoppedIPv6( browser.for_each_ipv6_address(
+            [ &ipv6 ]( Interface const &, InterfaceIPv6Address const & )
+            {
+                return ++ipv6 < 7;
+            } ) );
+        bool const allUp( browser.for_each_interface( countUp ) );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Visiting and iterating over a snapshot should not allocate." );
+        assert_equals( ranged, 100u );
+        assert_that( ordered, "Range iteration should follow enumeration order." );
+        assert_equals( ::std::distance( browser.begin(), browser.end() ), 100 );
+        assert_equals( ( --browser.end() )->name(), "syn99" );
+        assert_that( visitedAll );
+        assert_equals( visited, 100u );
+        assert_not_that( stopped );
+        assert_equals( stoppedAfter, 10u );
+        assert_that( visitedIPv4 );
+        assert_equals( ipv4, 200u );
+        assert_not_that( stoppedIPv6 );
+        assert_equals( ipv6, 7u );
+        assert_that( allUp );
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Test >
+    create()
+    {
+        return std::make_unique< TestInterfaceProvider >();
+    }
+
+private:
+    static
+    EnumerationOptions
+    options(
+        size_t const interfaces,
+        size_t const ipv4Addresses,
+        size_t const ipv6Addresses )
+    {
+        EnumerationOptions options;
+        options.provider = ::std::make_shared< SyntheticInterfaceProvider >( interfaces, ipv4Addresses, ipv6Addresses );
+        return options;
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Tests::Test::Registrar< TestInterfaceProvider > registrar( "TestInterfaceProvider" );
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <oddsource/network/interfaces/InterfaceProvider.hpp>
+#include <oddsource/network/interfaces/InterfaceRefresher.hpp>
+#include "main.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace OddSource::Interfaces;
+using namespace ::std::chrono_literals;
+
+namespace
+{
+    // thrown by the test provider and callback, to check that the refresher survives types it cannot describe
+    struct NotAnException
+    {
+    };
+
+    /**
+     * Reports one interface, except that the second call throws and the third reports two.
+     */
+    class ThrowingProvider final : public InterfaceProvider
+    {
+    public:
+        void
+        populate(
+            InterfaceCollector & collector ) const final
+        {
+            auto const call( ++this->_calls );
+            if ( call == 2 )
+            {
+                throw NotAnException();
+            }
+            for ( ::std::uint32_t i{ 1 }; i <= ( call == 3 ? 2u : 1u ); ++i )
+            {
+                static_cast< void >( collector.add_interface( i, "thr" + ::std::to_string( i ), 0 ) );
+            }
+        }
+
+    private:
+        mutable ::std::atomic< ::std::uint32_t > _calls{ 0 };
+    };
+}
+
+class TestInterfaceRefresher : public Tests::Test
+{
+public:
+    TestInterfaceRefresher()
+    {
+        add_test( test_initial_snapshot );
+        add_test( test_manual_triggers_coalesce );
+        add_test( test_timer );
+        add_test( test_min_interval );
+        add_test( test_survives_any_exception );
+    }
+
+    void
+    test_initial_snapshot()
+    {
+        RefresherOptions options;
+        options.interval = ::std::nullopt;
+        InterfaceRefresher const refresher( options );
+        assert_not_equals( refresher.latest(), nullptr );
+        assert_that( refresher.latest()->get_interfaces().size() > 1 );
+
+        InterfaceSnapshots::Reader reader( refresher.snapshots() );
+        assert_that( &reader.get() == refresher.latest().get() );
+
+        auto const statistics( refresher.statistics() );
+        assert_equals( statistics.refreshes, 0u );
+        assert_not_that( statistics.last_refresh.has_value() );
+    }
+
+    void
+    test_manual_triggers_coalesce()
+    {
+        RefresherOptions options;
+        options.interval = ::std::nullopt;
+        options.monitor = false;
+        options.coalesce_window = 100ms;
+        options.min_interval = 0ms;
+        InterfaceRefresher refresher( options );
+
+        for ( int i{ 0 }; i < 50; ++i )
+        {
+            refresher.trigger();
+        }
+        assert_that( waitForRefreshes( refresher, 1 ), "The refresher never refreshed." );
+
+        // let any straggling refresh finish, then check that the burst produced just one
+        ::std::this_thread::sleep_for( 200ms );
+        auto const statistics( refresher.statistics() );
+        assert_equals( statistics.manual_triggers, 50u );
+        assert_equals( statistics.refreshes, 1u );
+        assert_equals( statistics.failures, 0u );
+        assert_that( statistics.last_refresh.has_value() );
+        assert_that( statistics.last_latency > 0ns );
+        assert_that( statistics.max_latency >= statistics.last_latency );
+        assert_that( statistics.total_latency >= statistics.max_latency );
+        assert_equals( refresher.snapshots().version(), 2u );
+    }
+
+    void
+    test_timer()
+    {
+        RefresherOptions options;
+        options.interval = 20ms;
+        options.monitor = false;
+        options.coalesce_window = 0ms;
+        options.min_interval = 0ms;
+        InterfaceRefresher const refresher( options );
+
+        assert_that( waitForRefreshes( refresher, 3 ), "The timer did not keep refreshing." );
+        auto const statistics( refresher.statistics() );
+        assert_that( statistics.timer_triggers >= 3 );
+        assert_equals( statistics.manual_triggers, 0u );
+    }
+
+    void
+    test_min_interval()
+    {
+        RefresherOptions options;
+        options.interval = 1ms;
+        options.monitor = false;
+        options.coalesce_window = 0ms;
+        options.min_interval = 100ms;
+        InterfaceRefresher const refresher( options );
+
+        ::std::this_thread::sleep_for( 350ms );
+        auto const statistics( refresher.statistics() );
+        // one refresh at about 1ms, then at most one per 100ms
+        assert_that( statistics.refreshes >= 1, "Expected at least one refresh." );
+        assert_that(
+            statistics.refreshes <= 4,
+            "Expected at most 4 refreshes but got " + ::std::to_string( statistics.refreshes ) );
+    }
+
+    void
+    test_survives_any_exception()
+    {
+        RefresherOptions options;
+        options.interval = ::std::nullopt;
+        options.monitor = false;
+        options.coalesce_window = 0ms;
+        options.min_interval = 0ms;
+        options.enumeration.provider = ::std::make_shared< ThrowingProvider >();
+        ::std::atomic< int > callbacks{ 0 };
+        options.on_change = [ &callbacks ]( ::std::vector< InterfaceEvent > const & )
+        {
+            ++callbacks;
+            throw NotAnException();
+        };
+        InterfaceRefresher refresher( options );
+        assert_equals( refresher.latest()->get_interfaces().size(), 1u );
+
+        // the provider throws
+        refresher.trigger();
+        assert_that( waitForRefreshes( refresher, 1 ), "The refresher never refreshed." );
+        auto statistics( refresher.statistics() );
+        assert_equals( statistics.failures, 1u );
+        assert_that( statistics.last_error.has_value() );
+
+        // the provider reports a new interface, and the callback throws
+        refresher.trigger();
+        assert_that( waitForRefreshes( refresher, 2 ), "The refresher stopped after a failed refresh." );
+        for ( int i{ 0 }; i < 500 && callbacks.load() < 1; ++i )
+        {
+            ::std::this_thread::sleep_for( 10ms );
+        }
+        assert_equals( callbacks.load(), 1 );
+        assert_equals( refresher.latest()->get_interfaces().size(), 2u );
+
+        // and the refresher keeps going
+        refresher.trigger();
+        assert_that( waitForRefreshes( refresher, 3 ), "The refresher stopped after a failed callback." );
+        for ( int i{ 0 }; i < 500 && callbacks.load() < 2; ++i )
+        {
+            ::std::this_thread::sleep_for( 10ms );
+        }
+        assert_equals( callbacks.load(), 2 );
+        statistics = refresher.statistics();
+        assert_equals( statistics.failures, 1u );
+        assert_that( statistics.last_error->find( "on_change" ) != ::std::string::npos );
+        assert_equals( refresher.latest()->get_interfaces().size(), 1u );
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Test >
+    create()
+    {
+        return std::make_unique< TestInterfaceRefresher >();
+    }
+
+private:
+    static
+    bool
+    waitForRefreshes(
+        InterfaceRefresher const & refresher,
+        ::std::uint64_t const count )
+    {
+        for ( int i{ 0 }; i < 500; ++i )
+        {
+            if ( refresher.statistics().refreshes >= count )
+            {
+                return true;
+            }
+            ::std::this_thread::sleep_for( 10ms );
+        }
+        return false;
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Tests::Test::Registrar< TestInterfaceRefresher > registrar( "TestInterfaceRefresher" );
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <oddsource/network/interfaces/InterfaceProvider.hpp>
+#include <oddsource/network/interfaces/InterfaceSnapshots.hpp>
+#include "main.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace OddSource::Interfaces;
+
+namespace
+{
+    /**
+     * Reports a single interface whose index is the number of times populate has been called, so that every
+     * enumeration differs from the one before it.
+     */
+    class CountingProvider final : public InterfaceProvider
+    {
+    public:
+        void
+        populate(
+            InterfaceCollector & collector ) const final
+        {
+            auto const index( ++this->_calls );
+            // give concurrent refreshes time to overlap, even on one core
+            ::std::this_thread::sleep_for( ::std::chrono::microseconds( 100 ) );
+            static_cast< void >( collector.add_interface( index, "cnt" + ::std::to_string( index ), 0 ) );
+        }
+
+    private:
+        mutable ::std::atomic< ::std::uint32_t > _calls{ 0 };
+    };
+}
+
+class TestInterfaceSnapshots : public Tests::Test
+{
+public:
+    TestInterfaceSnapshots()
+    {
+        add_test( test_publish );
+        add_test( test_refresh );
+        add_test( test_concurrent_refreshes );
+        add_test( test_readers_and_writer_stress );
+    }
+
+    void
+    test_publish()
+    {
+        auto const pFirst( ::std::make_shared< InterfaceBrowser const >() );
+        InterfaceSnapshots snapshots( pFirst );
+        assert_equals( snapshots.version(), 1u );
+        assert_equals( snapshots.load(), pFirst );
+
+        InterfaceSnapshots::Reader reader( snapshots );
+        assert_that( &reader.get() == pFirst.get() );
+        assert_that( &reader.get() == pFirst.get() );
+        assert_equals( reader.pointer(), pFirst );
+
+        auto const pSecond( ::std::make_shared< InterfaceBrowser const >() );
+        snapshots.publish( pSecond );
+        assert_equals( snapshots.version(), 2u );
+        assert_equals( snapshots.load(), pSecond );
+        assert_that( &reader.get() == pSecond.get() );
+        assert_equals( reader.pointer(), pSecond );
+    }
+
+    void
+    test_refresh()
+    {
+        InterfaceSnapshots snapshots;
+        InterfaceSnapshots::Reader reader( snapshots );
+        auto const pBefore( reader.pointer() );
+
+        auto const changes( snapshots.refresh() );
+        assert_equals( changes.size(), 0u );
+        assert_equals( snapshots.version(), 2u );
+
+        // a new snapshot, but made of the same interface objects
+        auto const & after( reader.get() );
+        assert_that( &after != pBefore.get() );
+        assert_that( after.get_interfaces() == pBefore->get_interfaces() );
+    }
+
+    void
+    test_concurrent_refreshes()
+    {
+        EnumerationOptions options;
+        options.provider = ::std::make_shared< CountingProvider >();
+        InterfaceSnapshots snapshots( options );
+
+        static constexpr ::std::uint32_t writers{ 4 }, refreshes{ 50 }, total{ writers * refreshes };
+        ::std::mutex mutex;
+        ::std::vector< int > added( total + 2, 0 ), removed( total + 2, 0 );
+        ::std::vector< ::std::thread > threads;
+        for ( ::std::uint32_t w{ 0 }; w < writers; ++w )
+        {
+            threads.emplace_back( [ & ]
+            {
+                for ( ::std::uint32_t r{ 0 }; r < refreshes; ++r )
+                {
+                    auto const changes( snapshots.refresh() );
+                    ::std::lock_guard< ::std::mutex > const lock( mutex );
+                    for ( auto const & change : changes )
+                    {
+                        if ( change.type == InterfaceEventType::LinkAdded )
+                        {
+                            ++added[ change.index ];
+                        }
+                        else if ( change.type == InterfaceEventType::LinkRemoved )
+                        {
+                            ++removed[ change.index ];
+                        }
+                    }
+                }
+            } );
+        }
+        for ( auto & thread : threads )
+        {
+            thread.join();
+        }
+
+        // each refresh replaced the interface the previous one installed, so each was added and removed once
+        for ( ::std::uint32_t index{ 1 }; index <= total + 1; ++index )
+        {
+            auto const which( " for interface " + ::std::to_string( index ) );
+            assert_equals( added[ index ], index == 1 ? 0 : 1, "LinkAdded count wrong" + which );
+            assert_equals( removed[ index ], index == total + 1 ? 0 : 1, "LinkRemoved count wrong" + which );
+        }
+        assert_equals( snapshots.version(), total + 1 );
+        assert_equals( snapshots.load()->get_interfaces().front()->index(), total + 1 );
+    }
+
+    void
+    test_readers_and_writer_stress()
+    {
+        static constexpr size_t const READERS{ 8 };
+        static constexpr int const PUBLICATIONS{ 200 };
+
+        EnumerationOptions options;
+        options.backend = EnumerationBackend::Portable;
+        InterfaceSnapshots snapshots( options );
+        ::std::atomic< bool > done{ false };
+        ::std::atomic< size_t > inconsistencies{ 0 };
+        ::std::atomic< size_t > reads{ 0 };
+
+        ::std::vector< ::std::thread > readers;
+        for ( size_t r{ 0 }; r < READERS; ++r )
+        {
+            readers.emplace_back(
+                [ &snapshots, &done, &inconsistencies, &reads ]
+                {
+                    InterfaceSnapshots::Reader reader( snapshots );
+                    size_t count{ 0 };
+                    while ( !done.load( ::std::memory_order_relaxed ) )
+                    {
+                        // every snapshot must be internally consistent and must stay alive while in use
+                        auto const & browser( reader.get() );
+                        for ( auto const & pInterface : browser.get_interfaces() )
+                        {
+                            if ( browser.get_interface( pInterface->index() ) != pInterface ||
+                                 browser.get_interface( pInterface->name() ) != pInterface )
+                            {
+                                inconsistencies.fetch_add( 1, ::std::memory_order_relaxed );
+                            }
+                        }
+                        ++count;
+                    }
+                    reads.fetch_add( count, ::std::memory_order_relaxed );
+                } );
+        }
+
+        for ( int p{ 0 }; p < PUBLICATIONS; ++p )
+        {
+            if ( p % 2 == 0 )
+            {
+                snapshots.publish( ::std::make_shared< InterfaceBrowser const >( options ) );
+            }
+            else
+            {
+                snapshots.refresh();
+            }
+        }
+        done = true;
+        for ( auto & thread : readers )
+        {
+            thread.join();
+        }
+
+        assert_equals( inconsistencies.load(), 0u );
+        assert_that( reads.load() >= READERS );
+        assert_equals( snapshots.version(), static_cast< ::std::uint64_t >( PUBLICATIONS + 1 ) );
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Test >
+    create()
+    {
+        return std::make_unique< TestInterfaceSnapshots >();
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Tests::Test::Registrar< TestInterfaceSnapshots > registrar( "TestInterfaceSnapshots" );
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <oddsource/network/interfaces/InterfaceProvider.hpp>
+#include <oddsource/network/interfaces/InterfaceTable.hpp>
+#include "main.h"
+
+#include <memory>
+
+using namespace OddSource::Interfaces;
+
+class TestInterfaceTable : public Tests::Test
+{
+public:
+    TestInterfaceTable()
+    {
+        add_test( test_columns );
+        add_test( test_scans );
+        add_test( test_synthetic );
+        add_test( test_system );
+    }
+
+    void
+    test_columns()
+    {
+        InterfaceBrowser const browser( options() );
+        InterfaceTable const table( browser );
+
+        assert_equals( table.size(), 3u );
+        assert_equals( table.interfaces()[ 1 ], browser.get_interface( 4 ) );
+        assert_equals( table.indexes()[ 0 ], 3u );
+        assert_equals( table.indexes()[ 2 ], 5u );
+        assert_equals( table.flags()[ 0 ], 0u );
+        assert_equals( table.flags()[ 1 ], static_cast< ::std::uint32_t >( IFF_UP | IFF_POINTOPOINT ) );
+        assert_equals( table.mtus()[ 0 ], InterfaceTable::NO_MTU );
+        assert_equals( table.mtus()[ 2 ], 9000u );
+
+        assert_equals( table.ipv4_offsets().size(), 4u );
+        assert_equals( table.ipv4_offsets()[ 0 ], 0u );
+        assert_equals( table.ipv4_offsets()[ 1 ], 0u );
+        assert_equals( table.ipv4_offsets()[ 2 ], 1u );
+        assert_equals( table.ipv4_offsets()[ 3 ], 3u );
+        assert_equals( table.ipv4_rows()[ 0 ], 1u );
+        assert_equals( table.ipv4_rows()[ 2 ], 2u );
+        assert_equals( table.ipv4_addresses()[ 0 ], static_cast< ::std::uint32_t >( IPv4Address( "10.1.0.1" ) ) );
+        assert_equals( table.ipv4_prefix_lengths()[ 0 ], 16u );
+        assert_equals( table.ipv4_prefix_lengths()[ 1 ], 0u );
+        assert_equals( table.ipv4_addresses()[ 2 ], static_cast< ::std::uint32_t >( IPv4Address( "192.168.4.20" ) ) );
+
+        assert_equals( table.ipv6_offsets().size(), 4u );
+        assert_equals( table.ipv6_offsets()[ 1 ], 0u );
+        assert_equals( table.ipv6_offsets()[ 2 ], 1u );
+        assert_equals( table.ipv6_offsets()[ 3 ], 3u );
+        assert_that( table.ipv6_addresses()[ 0 ] == static_cast< IPv6Address::Bytes >( IPv6Address( "fd00::1" ) ) );
+        assert_equals( table.ipv6_flags()[ 0 ], static_cast< ::std::uint16_t >( IN6_IFF_TEMPORARY ) );
+        assert_equals( table.ipv6_prefix_lengths()[ 0 ], 64u );
+        assert_equals( table.ipv6_scope_ids()[ 0 ], 0u );
+        assert_equals( table.ipv6_scope_ids()[ 1 ], 5u );
+        assert_equals( table.ipv6_rows()[ 2 ], 2u );
+    }
+
+    void
+    test_scans()
+    {
+        InterfaceTable const table( ( InterfaceBrowser( options() ) ) );
+
+        // up interfaces with jumbo frames
+        ::std::vector< ::std::uint32_t > jumbo;
+        for ( size_t row{ 0 }; row < table.size(); ++row )
+        {
+            if ( ( table.flags()[ row ] & IFF_UP ) && table.mtus()[ row ] >= 9000 )
+            {
+                jumbo.push_back( table.indexes()[ row ] );
+            }
+        }
+        assert_equals( jumbo.size(), 1u );
+        assert_equals( jumbo[ 0 ], 5u );
+
+        // global unicast (2000::/3) IPv6 addresses
+        ::std::vector< ::std::uint32_t > global;
+        for ( size_t i{ 0 }; i < table.ipv6_addresses().size(); ++i )
+        {
+            if ( ( table.ipv6_addresses()[ i ][ 0 ] & 0xe0 ) == 0x20 )
+            {
+                global.push_back( table.indexes()[ table.ipv6_rows()[ i ] ] );
+            }
+        }
+        assert_equals( global.size(), 1u );
+        assert_equals( global[ 0 ], 5u );
+    }
+
+    void
+    test_synthetic()
+    {
+        EnumerationOptions opts;
+        opts.provider = ::std::make_shared< SyntheticInterfaceProvider >( 1000, 2, 3 );
+        InterfaceBrowser const browser( opts );
+        InterfaceTable const table( browser );
+
+        assert_equals( table.size(), 1000u );
+        assert_equals( table.ipv4_addresses().size(), 2000u );
+        assert_equals( table.ipv6_addresses().size(), 3000u );
+        assert_equals( table.ipv4_offsets()[ 1000 ], 2000u );
+        assert_equals( table.ipv6_offsets()[ 1000 ], 3000u );
+        assert_equals( table.ipv6_offsets()[ 999 ], 2997u );
+        assert_equals( table.ipv4_addresses()[ 1999 ], static_cast< ::std::uint32_t >( IPv4Address( "10.0.7.208" ) ) );
+        assert_that( table.ipv6_addresses()[ 2999 ] == static_cast< IPv6Address::Bytes >( IPv6Address( "fd00:0:0:3e7::3" ) ) );
+    }
+
+    void
+    test_system()
+    {
+        InterfaceBrowser const browser;
+        InterfaceTable const table( browser );
+        assert_equals( table.size(), browser.get_interfaces().size() );
+
+        size_t row{ 0 };
+        for ( auto const & pInterface : browser.get_interfaces() )
+        {
+            assert_equals( table.indexes()[ row ], pInterface->index() );
+            assert_equals( table.flags()[ row ], pInterface->flags() );
+            assert_equals( table.ipv4_offsets()[ row + 1 ] - table.ipv4_offsets()[ row ],
+                           static_cast< ::std::uint32_t >( pInterface->ipv4_addresses().size() ) );
+            assert_equals( table.ipv6_offsets()[ row + 1 ] - table.ipv6_offsets()[ row ],
+                           static_cast< ::std::uint32_t >( pInterface->ipv6_addresses().size() ) );
+            ++row;
+        }
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Test >
+    create()
+    {
+        return std::make_unique< TestInterfaceTable >();
+    }
+
+private:
+    static
+    EnumerationOptions
+    options()
+    {
+        class Provider : public InterfaceProvider
+        {
+        public:
+            void
+            populate(
+                InterfaceCollector & collector ) const override
+            {
+                collector.add_interface( 3, "down0", 0 );
+                Interface * const pTunnel( collector.add_interface( 4, "tun0", IFF_UP | IFF_POINTOPOINT, 1400 ) );
+                collector.add_ipv4_address( *pTunnel, InterfaceIPv4Address( IPv4Address( "10.1.0.1" ), 0, 16 ) );
+                collector.add_ipv6_address( *pTunnel, InterfaceIPv6Address(
+                    IPv6Address( "fd00::1" ), IN6_IFF_TEMPORARY, 64 ) );
+
+                Interface * const pJumbo( collector.add_interface( 5, "jumbo0", IFF_UP, 9000 ) );
+                collector.add_ipv4_address( *pJumbo, InterfaceIPv4Address( IPv4Address( "10.2.0.1" ), 0 ) );
+                collector.add_ipv4_address( *pJumbo, InterfaceIPv4Address( IPv4Address( "192.168.4.20" ), 0, 24 ) );
+                collector.add_ipv6_address( *pJumbo, InterfaceIPv6Address(
+                    IPv6Address( IPv6Address::Bytes { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5 }, v6Scope { 5, "jumbo0" } ),
+                    0, 64 ) );
+                collector.add_ipv6_address( *pJumbo, InterfaceIPv6Address( IPv6Address( "2001:db8::5" ), 0, 64 ) );
+            }
+        };
+
+        EnumerationOptions opts;
+        opts.provider = ::std::make_shared< Provider >();
+        return opts;
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Tests::Test::Registrar< TestInterfaceTable > registrar( "TestInterfaceTable" );
+}
@@ -18,6 +18,8 @@
 #include "main.h"
 
 #include <cstring>
+#include <thread>
+#include <vector>
 
 using namespace OddSource::Interfaces;
 
@@ -29,7 +31,12 @@ public:
         add_test( test_equals );
         add_test( test_string_round_trip );
         add_test( test_data_round_trip );
+        add_test( test_value_semantics_without_allocating );
+        add_test( test_concurrent_formatting );
         add_test( test_construct_malformed );
+        add_test( test_parse );
+        add_test( test_parse_formats );
+        add_test( test_parse_all );
     }
 
     void
@@ -92,12 +99,57 @@ public:
         }
     }
 
+    void
+    test_value_semantics_without_allocating()
+    {
+        static constexpr uint8_t data[ 8 ] { 0x00, 0x0f, 0x10, 0x7f, 0x80, 0xa9, 0xf0, 0xff };
+
+        auto const before( Tests::allocation_count() );
+        MacAddress const address( data, 8 );
+        MacAddress copy( address );
+        MacAddress const moved( ::std::move( copy ) );
+        auto const formatted( static_cast< char const * >( moved ) );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Constructing, copying, moving, and formatting should not allocate." );
+        assert_equals( ::std::string( formatted ), "00:0f:10:7f:80:a9:f0:ff" );
+        assert_equals( moved, address );
+        assert_equals( MacAddress( data, 6 ), MacAddress( "00:0F:10:7F:80:A9" ) );
+        assert_not_equals( MacAddress( data, 6 ), MacAddress( data, 7 ) );
+    }
+
+    void
+    test_concurrent_formatting()
+    {
+        ::std::uint8_t const data[ MAX_ADAPTER_ADDRESS_LENGTH ] { 0xa4, 0x83, 0xe7, 0x2e, 0xa1, 0x67 };
+        MacAddress const address( data, 6 );
+
+        ::std::vector< char const * > results( 8, nullptr );
+        ::std::vector< ::std::thread > threads;
+        for ( size_t i{ 0 }; i < results.size(); ++i )
+        {
+            threads.emplace_back( [ &address, &results, i ] { results[ i ] = static_cast< char const * >( address ); } );
+        }
+        for ( auto & thread : threads )
+        {
+            thread.join();
+        }
+
+        for ( auto const result : results )
+        {
+            assert_equals( ::std::string( result ), "a4:83:e7:2e:a1:67", "Every thread should see the fully formatted string." );
+        }
+        assert_equals( static_cast< ::std::string >( MacAddress( address ) ), "a4:83:e7:2e:a1:67" );
+    }
+
     void
     test_construct_malformed()
     {
         assert_throws( MacAddress( "67:a1:2e:ff:e5" ), ::std::invalid_argument );
         assert_throws( MacAddress( "67:a1:2e:ff:e5:e6:e7:e8:e9" ), ::std::invalid_argument );
-        assert_throws( MacAddress( "67a12ef1a4e7" ), ::std::invalid_argument );
+        assert_throws( MacAddress( "67a12ef1a4e" ), ::std::invalid_argument );
+        assert_throws( MacAddress( "67:a1-2e:ff:e5:e6.e7" ), ::std::invalid_argument );
+        assert_throws( MacAddress( "67:a1:2e:ff:e5:e6 " ), ::std::invalid_argument );
 
         static constexpr uint8_t data1[ 5 ] { 0xa4, 0xe7, 0x83, 0xa1, 0x2e };
         static constexpr uint8_t data2[ 9 ] { 0xb2, 0xb8, 0xfb, 0x84, 0x5b, 0xff, 0xe8, 0xe7, 0xbb };
@@ -106,6 +158,123 @@ public:
         assert_throws( MacAddress( data2, 9 ), ::std::invalid_argument );
     }
 
+    void
+    test_parse()
+    {
+        auto const before( Tests::allocation_count() );
+        auto const parsed( MacAddress::parse( "67:A1:2E:ff:e5:e6" ) );
+        auto const dashed( MacAddress::try_parse( "67-a1-2e-ff-e5-e6-e7-e8" ) );
+        auto const empty( MacAddress::parse( "" ) );
+        auto const tooShort( MacAddress::parse( "67:a1:2e:ff:e5" ) );
+        auto const tooLong( MacAddress::parse( "67:a1:2e:ff:e5:e6:e7:e8:e9" ) );
+        auto const wrapped( MacAddress::parse( ::std::string_view(
+            "::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::"
+            "::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::"
+            ":::::::::::::::::::::::::::::::::::::::::::::::01:02:03:04:05:06:07:08:09:10:11:12:13:14:15:16:17" ) ) );
+        auto const badCharacter( MacAddress::parse( "67:a1:2e:fg:e5:e6" ) );
+        auto const badGroup( MacAddress::parse( "67:a1:2ef:f:e5:e6" ) );
+        auto const missing( MacAddress::try_parse( "67:a1:2e:ff:e5:" ) );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Parsing should not allocate, whether or not it succeeds." );
+        assert_that( static_cast< bool >( parsed ) );
+        assert_that( parsed.error == ParseError::None );
+        assert_equals( parsed.address->length(), 6u );
+        assert_equals( *parsed.address, MacAddress( "67:a1:2e:ff:e5:e6" ) );
+        assert_that( dashed.has_value() );
+        assert_equals( dashed->length(), 8u );
+        assert_that( empty.error == ParseError::Empty );
+        assert_that( tooShort.error == ParseError::InvalidLength );
+        assert_that( tooLong.error == ParseError::InvalidLength );
+        assert_not_that( static_cast< bool >( wrapped ) );
+        assert_that( badCharacter.error == ParseError::Malformed );
+        assert_that( badGroup.error == ParseError::Malformed );
+        assert_not_that( missing.has_value() );
+    }
+
+    void
+    test_parse_formats()
+    {
+        MacAddress const expected( "a4:83:e7:2e:a1:67" );
+        MacAddress const expected8( "a4:83:e7:ff:fe:2e:a1:67" );
+
+        auto const before( Tests::allocation_count() );
+        auto const cisco( MacAddress::parse( "a483.e72e.a167" ) );
+        auto const cisco8( MacAddress::parse( "A483.E7FF.FE2E.A167" ) );
+        auto const bare( MacAddress::parse( "A483E72EA167" ) );
+        auto const bare7( MacAddress::parse( "a483e72ea16700" ) );
+        auto const bare8( MacAddress::parse( "a483e7fffe2ea167" ) );
+        auto const mixed( MacAddress::parse( "a4:83:e7-2e-a1:67" ) );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Parsing any format should not allocate." );
+        assert_equals( *cisco.address, expected );
+        assert_equals( *cisco8.address, expected8 );
+        assert_equals( *bare.address, expected );
+        assert_equals( bare7.address->length(), 7u );
+        assert_equals( *bare8.address, expected8 );
+        assert_equals( *mixed.address, expected );
+        assert_equals( static_cast< ::std::string >( *cisco.address ), "a483.e72e.a167" );
+        assert_equals( static_cast< ::std::string >( MacAddress( "a483e72ea167" ) ), "a483e72ea167" );
+
+        assert_that( MacAddress::parse( "a483.e72e" ).error == ParseError::InvalidLength );
+        assert_that( MacAddress::parse( "a483.e72e.a167.ffff.0000" ).error == ParseError::InvalidLength );
+        assert_that( MacAddress::parse( "a483e72ea1" ).error == ParseError::InvalidLength );
+        assert_that( MacAddress::parse( "a483e72ea16700112233" ).error == ParseError::InvalidLength );
+        assert_that( MacAddress::parse( "a483e72ea16" ).error == ParseError::Malformed );
+        assert_that( MacAddress::parse( "a483.e72e.a16" ).error == ParseError::Malformed );
+        assert_that( MacAddress::parse( "a483.e72e.a1670" ).error == ParseError::Malformed );
+        assert_that( MacAddress::parse( "a48.3e72e.a167" ).error == ParseError::Malformed );
+        assert_that( MacAddress::parse( "a483.e72e:a167" ).error == ParseError::Malformed );
+        assert_that( MacAddress::parse( "a4:83:e7.2e:a1:67" ).error == ParseError::Malformed );
+        assert_that( MacAddress::parse( ".a483.e72e.a167" ).error == ParseError::Malformed );
+        assert_that( MacAddress::parse( "a4 83 e7 2e a1 67" ).error == ParseError::Malformed );
+    }
+
+    void
+    test_parse_all()
+    {
+        static constexpr size_t count{ 5 };
+        ::std::string_view const reprs[ count ] {
+            "a4:83:e7:2e:a1:67", "a483.e72e.a167", "nope", "a4-83-e7-ff-fe-2e-a1-67", "a4:83:e7:2e:a1",
+        };
+        ::std::uint8_t data[ count * MAX_ADAPTER_ADDRESS_LENGTH ];
+        ::std::memset( data, 0xcc, sizeof( data ) );
+        ::std::uint8_t lengths[ count ] {};
+        ParseError errors[ count ] {};
+
+        auto const before( Tests::allocation_count() );
+        auto const parsed( MacAddress::parse_all( reprs, count, data, lengths, errors ) );
+        auto const after( Tests::allocation_count() );
+
+        assert_equals( after - before, 0u, "Parsing a batch should not allocate." );
+        assert_equals( parsed, 3u );
+        assert_equals( lengths[ 0 ], 6u );
+        assert_equals( lengths[ 1 ], 6u );
+        assert_equals( lengths[ 2 ], 0u );
+        assert_equals( lengths[ 3 ], 8u );
+        assert_equals( lengths[ 4 ], 0u );
+        assert_that( errors[ 0 ] == ParseError::None );
+        assert_that( errors[ 2 ] == ParseError::Malformed );
+        assert_that( errors[ 4 ] == ParseError::InvalidLength );
+        for ( size_t i{ 0 }; i < count; i++ )
+        {
+            auto const expected( MacAddress::try_parse( reprs[ i ] ) );
+            auto const bytes( data + i * MAX_ADAPTER_ADDRESS_LENGTH );
+            if ( expected )
+            {
+                assert_equals( MacAddress( bytes, lengths[ i ] ), *expected );
+            }
+            for ( size_t j{ lengths[ i ] }; j < MAX_ADAPTER_ADDRESS_LENGTH; j++ )
+            {
+                assert_equals( bytes[ j ], 0u, "Bytes past the length should be zero." );
+            }
+        }
+
+        // the errors are optional
+        assert_equals( MacAddress::parse_all( reprs, 2, data, lengths ), 2u );
+    }
+
     [[maybe_unused]]
     static
     std::unique_ptr< Test > create()
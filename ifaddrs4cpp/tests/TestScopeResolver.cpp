@@ -0,0 +1,267 @@
+/*
+ * Copyright © 2010-2026 OddSource Code (license@oddsource.io)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <oddsource/network/interfaces/Interfaces.hpp>
+#include "main.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace OddSource::Interfaces;
+
+namespace
+{
+    /**
+     * Installs a resolver for the duration of a test and restores the previous one afterward.
+     */
+    class InstalledResolver
+    {
+    public:
+        explicit
+        InstalledResolver(
+            ::std::shared_ptr< ScopeResolver > resolver )
+            : _previous( ScopeResolver::install( ::std::move( resolver ) ) )
+        {
+        }
+
+        ~InstalledResolver()
+        {
+            ScopeResolver::install( ::std::move( this->_previous ) );
+        }
+
+    private:
+        ::std::shared_ptr< ScopeResolver > _previous;
+    };
+
+    /**
+     * Answers from a fixed table and counts how many times it was asked.
+     */
+    class CountingScopeResolver : public ScopeResolver
+    {
+    public:
+        mutable ::std::atomic< size_t > calls{ 0 };
+
+        [[nodiscard]]
+        ::std::optional< ::std::string >
+        scope_name(
+            ::std::uint32_t scopeId ) const override
+        {
+            ++this->calls;
+            return scopeId == 4242 ? ::std::optional< ::std::string >( "fake0" ) : ::std::nullopt;
+        }
+
+        [[nodiscard]]
+        ::std::optional< ::std::uint32_t >
+        scope_id(
+            ::std::string_view scopeName ) const override
+        {
+            ++this->calls;
+            return scopeName == "fake0" ? ::std::optional< ::std::uint32_t >( 4242 ) : ::std::nullopt;
+        }
+    };
+}
+
+class TestScopeResolver : public Tests::Test
+{
+public:
+    TestScopeResolver()
+    {
+        add_test( test_system_is_the_default );
+        add_test( test_table_resolves_without_the_system );
+        add_test( test_resolved_name_too_long );
+        add_test( test_caching_asks_once_per_scope );
+        add_test( test_caching_invalidation );
+        add_test( test_concurrent_cached_parsing );
+        add_test( test_browser_scope_resolver );
+    }
+
+    void
+    test_system_is_the_default()
+    {
+        auto const pPrevious( ScopeResolver::install( nullptr ) );
+        assert_that( dynamic_cast< SystemScopeResolver * >( &ScopeResolver::installed() ) != nullptr );
+        assert_not_that( ScopeResolver::installed().scope_id( "this-is-not-an-interface-name" ).has_value() );
+        assert_not_that( ScopeResolver::installed().scope_id( "a-name-much-longer-than-any-interface-name" ).has_value() );
+        ScopeResolver::install( pPrevious );
+    }
+
+    void
+    test_table_resolves_without_the_system()
+    {
+        InstalledResolver const installed(
+            ::std::make_shared< TableScopeResolver >(
+                ::std::vector< ::std::pair< ::std::uint32_t, ::std::string > > { { 4242, "fake0" }, { 4343, "fake1" } } ) );
+
+        IPv6Address const byName( "fe80::1%fake0" );
+        assert_equals( *byName.scope_id(), 4242u );
+        assert_equals( *byName.scope_name(), "fake0" );
+        assert_equals( static_cast< ::std::string >( byName ), "fe80::1%fake0" );
+
+        IPv6Address const byId( "fe80::1%4343" );
+        assert_equals( *byId.scope_id(), 4343u );
+        assert_equals( *byId.scope_name(), "fake1" );
+
+        IPv6Address const bytes( IPv6Address::Bytes { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 }, 4242 );
+        assert_equals( *bytes.scope_name(), "fake0" );
+
+        // a scope that the table does not have keeps only the half that was given
+        IPv6Address const unknown( "fe80::1%fake9" );
+        assert_not_that( unknown.scope_id().has_value() );
+        assert_equals( *unknown.scope_name(), "fake9" );
+    }
+
+    void
+    test_resolved_name_too_long()
+    {
+        InstalledResolver const installed(
+            ::std::make_shared< TableScopeResolver >(
+                ::std::vector< ::std::pair< ::std::uint32_t, ::std::string > > {
+                    { 7, "{4D36E972-E325-11CE-BFC1-08002BE10318}" } } ) );
+
+        // the caller gave only an ID, so a name from the resolver that is too long to keep is dropped, not an error
+        auto const parsed( IPv6Address::parse( "fe80::1%7" ) );
+        assert_that( static_cast< bool >( parsed ) );
+        assert_equals( *parsed.address->scope_id(), 7u );
+        assert_not_that( parsed.address->scope_name().has_value() );
+        assert_equals( static_cast< ::std::string >( *parsed.address ), "fe80::1%7" );
+
+        in6_addr address{};
+        address.s6_addr[ 0 ] = 0xfe;
+        address.s6_addr[ 1 ] = 0x80;
+        address.s6_addr[ 15 ] = 1;
+        IPv6Address const fromId( &address, 7 );
+        assert_equals( *fromId.scope_id(), 7u );
+        assert_not_that( fromId.scope_name().has_value() );
+        assert_equals( static_cast< ::std::string >( fromId ), "fe80::1%7" );
+    }
+
+    void
+    test_caching_asks_once_per_scope()
+    {
+        auto const pSource( ::std::make_shared< CountingScopeResolver >() );
+        InstalledResolver const installed( ::std::make_shared< CachingScopeResolver >( pSource ) );
+
+        for ( int i{ 0 }; i < 100; ++i )
+        {
+            IPv6Address const address( "fe80::1%fake0" );
+            assert_equals( *address.scope_id(), 4242u );
+        }
+        assert_equals( pSource->calls.load(), 1u );
+
+        // the name lookup also taught the cache the ID
+        IPv6Address const byId( "fe80::1%4242" );
+        assert_equals( *byId.scope_name(), "fake0" );
+        assert_equals( pSource->calls.load(), 1u );
+
+        // misses are asked every time, so that interfaces that appear later are found
+        IPv6Address const unknown1( "fe80::1%fake9" );
+        IPv6Address const unknown2( "fe80::1%fake9" );
+        assert_equals( pSource->calls.load(), 3u );
+    }
+
+    void
+    test_caching_invalidation()
+    {
+        auto const pSource( ::std::make_shared< CountingScopeResolver >() );
+        CachingScopeResolver resolver( pSource );
+
+        assert_equals( *resolver.scope_id( "fake0" ), 4242u );
+        assert_equals( *resolver.scope_name( 4242 ), "fake0" );
+        assert_equals( pSource->calls.load(), 1u );
+
+        // a renamed link is reported with its index and new name, which also forgets its old name
+        resolver.invalidate( 4242, "renamed0" );
+        assert_equals( *resolver.scope_name( 4242 ), "fake0" );
+        assert_equals( pSource->calls.load(), 2u );
+        assert_equals( *resolver.scope_id( "fake0" ), 4242u );
+        assert_equals( pSource->calls.load(), 2u );
+
+        resolver.invalidate( 0, "fake0" );
+        assert_equals( *resolver.scope_id( "fake0" ), 4242u );
+        assert_equals( pSource->calls.load(), 3u );
+
+        resolver.invalidate();
+        assert_equals( *resolver.scope_id( "fake0" ), 4242u );
+        assert_equals( *resolver.scope_name( 4242 ), "fake0" );
+        assert_equals( pSource->calls.load(), 4u );
+    }
+
+    void
+    test_concurrent_cached_parsing()
+    {
+        static constexpr size_t const THREADS{ 8 };
+        static constexpr int const PARSES{ 1'000 };
+
+        auto const pSource( ::std::make_shared< CountingScopeResolver >() );
+        InstalledResolver const installed( ::std::make_shared< CachingScopeResolver >( pSource ) );
+        ::std::atomic< size_t > wrong{ 0 };
+
+        ::std::vector< ::std::thread > threads;
+        for ( size_t t{ 0 }; t < THREADS; ++t )
+        {
+            threads.emplace_back(
+                [ &wrong ]
+                {
+                    for ( int i{ 0 }; i < PARSES; ++i )
+                    {
+                        IPv6Address const address( i % 2 == 0 ? "fe80::1%fake0" : "fe80::2%4242" );
+                        if ( address.scope_id() != 4242u || address.scope_name() != "fake0" )
+                        {
+                            wrong.fetch_add( 1, ::std::memory_order_relaxed );
+                        }
+                    }
+                } );
+        }
+        for ( auto & thread : threads )
+        {
+            thread.join();
+        }
+
+        assert_equals( wrong.load(), 0u );
+        // racing threads may each miss before the first answer is remembered, but no more than that
+        assert_that( pSource->calls.load() <= THREADS * 2 );
+    }
+
+    void
+    test_browser_scope_resolver()
+    {
+        InterfaceBrowser const browser;
+        auto const pResolver( browser.scope_resolver() );
+        for ( auto const & pInterface : browser.get_interfaces() )
+        {
+            assert_equals( *pResolver->scope_name( pInterface->index() ), pInterface->name() );
+            assert_equals( *pResolver->scope_id( pInterface->name() ), pInterface->index() );
+        }
+        assert_not_that( pResolver->scope_id( "this-is-not-an-interface-name" ).has_value() );
+    }
+
+    [[maybe_unused]]
+    static
+    std::unique_ptr< Test >
+    create()
+    {
+        return std::make_unique< TestScopeResolver >();
+    }
+};
+
+namespace
+{
+    [[maybe_unused]]
+    Tests::Test::Registrar< TestScopeResolver > registrar( "TestScopeResolver" );
+}
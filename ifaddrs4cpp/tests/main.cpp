@@ -16,8 +16,12 @@
 
 #include "main.h"
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdlib>
 #include <cstring>
+#include <new>
 
 #ifdef ODDSOURCE_IS_WINDOWS
 #include <io.h>
@@ -71,6 +75,102 @@ demangle(
 }
 #endif
 
+namespace
+{
+    thread_local ::std::uint64_t allocations( 0 );
+    ::std::atomic< ::std::uint64_t > allocatedBytes( 0 );
+
+    // each allocation is preceded by its size, in a header that keeps the memory after it aligned for any type
+    constexpr ::std::size_t const HEADER_SIZE{ alignof( ::std::max_align_t ) };
+
+    void *
+    allocate(
+        ::std::size_t size ) noexcept
+    {
+        ++allocations;
+        auto * const pHeader( static_cast< unsigned char * >( ::std::malloc( HEADER_SIZE + size ) ) );
+        if ( pHeader == nullptr )
+        {
+            return nullptr;
+        }
+        ::std::memcpy( pHeader, &size, sizeof( size ) );
+        allocatedBytes += size;
+        return pHeader + HEADER_SIZE;
+    }
+
+    void
+    deallocate(
+        void * ptr ) noexcept
+    {
+        if ( ptr == nullptr )
+        {
+            return;
+        }
+        auto * const pHeader( static_cast< unsigned char * >( ptr ) - HEADER_SIZE );
+        ::std::size_t size;
+        ::std::memcpy( &size, pHeader, sizeof( size ) );
+        allocatedBytes -= size;
+        ::std::free( pHeader );
+    }
+}
+
+// replaces the global allocation functions so that tests can count allocations
+void *
+operator new(
+    ::std::size_t size )
+{
+    if ( void * ptr = allocate( size ) )
+    {
+        return ptr;
+    }
+    throw ::std::bad_alloc();
+}
+
+void *
+operator new(
+    ::std::size_t size,
+    ::std::nothrow_t const & ) noexcept
+{
+    return allocate( size );
+}
+
+void
+operator delete(
+    void * ptr ) noexcept
+{
+    deallocate( ptr );
+}
+
+void
+operator delete(
+    void * ptr,
+    ::std::nothrow_t const & ) noexcept
+{
+    deallocate( ptr );
+}
+
+void
+operator delete(
+    void * ptr,
+    ::std::size_t ) noexcept
+{
+    deallocate( ptr );
+}
+
+::std::uint64_t
+OddSource::Interfaces::Tests::
+allocation_count()
+{
+    return allocations;
+}
+
+::std::uint64_t
+OddSource::Interfaces::Tests::
+allocated_bytes()
+{
+    return allocatedBytes;
+}
+
 OddSource::Interfaces::Tests::
 Test::
 Test()
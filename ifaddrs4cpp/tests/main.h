@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -37,6 +39,20 @@
 
 namespace OddSource::Interfaces::Tests
 {
+    /**
+     * Returns how many times the calling thread has called the global operator new, so that a
+     * test can take the difference across an operation to assert that it does not allocate.
+     */
+    ::std::uint64_t
+    allocation_count();
+
+    /**
+     * Returns how many bytes allocated with the global operator new, by any thread, have not yet been freed, so
+     * that a test can assert that repeating an operation does not keep more and more memory alive.
+     */
+    ::std::uint64_t
+    allocated_bytes();
+
     template< typename T >
     ::std::string
     type_id_string(
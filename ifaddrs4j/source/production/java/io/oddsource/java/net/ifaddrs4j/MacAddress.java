@@ -40,7 +40,9 @@ public final class MacAddress
 
     /**
      * Constructs the MAC address / hardware address from the given String representation, which should be
-     * at least 6 and at most 8 hexadecimal-formatted bytes separated by hyphens or colons.
+     * at least 6 and at most 8 hexadecimal-formatted bytes, either separated by hyphens or colons
+     * (a4:83:e7:2e:a1:67), in groups of four digits separated by dots as Cisco devices print them
+     * (a483.e72e.a167), or not separated at all (a483e72ea167).
      *
      * @param representation The string representation
      */
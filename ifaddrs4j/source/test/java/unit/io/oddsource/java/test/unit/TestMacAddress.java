@@ -63,6 +63,27 @@ public class TestMacAddress
         assertArrayEquals(address.getData(), bytes(0xb2, 0xfb, 0xb8, 0x5b, 0x84, 0xe8, 0xfe, 0xff));
     }
 
+    @Test
+    public void testConstructWithCiscoAndBareStrings()
+    {
+        MacAddress address = new MacAddress("a483.e72e.a167");
+
+        assertEquals(address.toString(), "a483.e72e.a167");
+        assertEquals(address.getLength(), 6);
+        assertArrayEquals(address.getData(), bytes(0xa4, 0x83, 0xe7, 0x2e, 0xa1, 0x67));
+
+        address = new MacAddress("67a12ef1a4e7");
+
+        assertEquals(address.toString(), "67a12ef1a4e7");
+        assertEquals(address.getLength(), 6);
+        assertArrayEquals(address.getData(), bytes(0x67, 0xa1, 0x2e, 0xf1, 0xa4, 0xe7));
+
+        address = new MacAddress("B2FB.B85B.84E8.FEFF");
+
+        assertEquals(address.getLength(), 8);
+        assertArrayEquals(address.getData(), bytes(0xb2, 0xfb, 0xb8, 0x5b, 0x84, 0xe8, 0xfe, 0xff));
+    }
+
     @Test
     public void testConstructWithData()
     {
@@ -86,7 +107,9 @@ public class TestMacAddress
     {
         assertThrows(IllegalArgumentException.class, () -> new MacAddress("67:a1:2e:ff:e5"));
         assertThrows(IllegalArgumentException.class, () -> new MacAddress("67:a1:2e:ff:e5:e6:e7:e8:e9"));
-        assertThrows(IllegalArgumentException.class, () -> new MacAddress("67a12ef1a4e7"));
+        assertThrows(IllegalArgumentException.class, () -> new MacAddress("67a12ef1a4e"));
+        assertThrows(IllegalArgumentException.class, () -> new MacAddress("67a1.2ef1.a4e"));
+        assertThrows(IllegalArgumentException.class, () -> new MacAddress("67:a1-2e:ff:e5:e6.e7"));
 
         assertThrows(
             IllegalArgumentException.class,
@@ -35,6 +35,24 @@ class TestMacAddress(TestCase):
         self.assertEqual(address.data_length, 8)
         self.assertEqual(address.data, (0xb2, 0xfb, 0xb8, 0x5b, 0x84, 0xe8, 0xfe, 0xff))
 
+    def test_construct_with_cisco_and_bare_strings(self) -> None:
+        address = MacAddress("a483.e72e.a167")
+
+        self.assertEqual(f"{address}", "a483.e72e.a167")
+        self.assertEqual(len(address), 6)
+        self.assertEqual(address.data, (0xa4, 0x83, 0xe7, 0x2e, 0xa1, 0x67))
+
+        address = MacAddress("67a12ef1a4e7")
+
+        self.assertEqual(f"{address}", "67a12ef1a4e7")
+        self.assertEqual(len(address), 6)
+        self.assertEqual(address.data, (0x67, 0xa1, 0x2e, 0xf1, 0xa4, 0xe7))
+
+        address = MacAddress("B2FB.B85B.84E8.FEFF")
+
+        self.assertEqual(len(address), 8)
+        self.assertEqual(address.data, (0xb2, 0xfb, 0xb8, 0x5b, 0x84, 0xe8, 0xfe, 0xff))
+
     def test_construct_with_data(self) -> None:
         address = MacAddress(data=(0x67, 0xa1, 0x2e, 0xff, 0xa4, 0xe7, 0xe3))
 
@@ -53,7 +71,9 @@ class TestMacAddress(TestCase):
     def test_construct_malformed(self) -> None:
         self.assertRaises(ValueError, lambda: MacAddress("67:a1:2e:ff:e5"))
         self.assertRaises(ValueError, lambda: MacAddress("67:a1:2e:ff:e5:e6:e7:e8:e9"))
-        self.assertRaises(ValueError, lambda: MacAddress("67a12ef1a4e7"))
+        self.assertRaises(ValueError, lambda: MacAddress("67a12ef1a4e"))
+        self.assertRaises(ValueError, lambda: MacAddress("67a1.2ef1.a4e"))
+        self.assertRaises(ValueError, lambda: MacAddress("67:a1-2e:ff:e5:e6.e7"))
 
         self.assertRaises(ValueError, lambda: MacAddress(data=(0x67, 0xa1, 0x2e, 0xff, 0xa4)))
         self.assertRaises(ValueError, lambda: MacAddress(data=(0x67, 0xa1, 0x2e, 0xff, 0xa4, 0xff, 0xa4, 0xe7, 0xbb)))